@@ -96,6 +96,11 @@ namespace ompl
                 return valid;
             }
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override
+            {
+                sampler_->setLocalStream(seed, stream);
+            }
+
         private:
             /** \brief Underlying constrained state sampler. */
             StateSamplerPtr sampler_;
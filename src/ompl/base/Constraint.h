@@ -44,7 +44,12 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace ompl
 {
@@ -75,6 +80,48 @@ namespace ompl
         class Constraint
         {
         public:
+            /** \brief The solver used for the Newton steps of the projection
+             routine. Each step is the minimum norm solution of \f$J \Delta x = F(x)\f$. */
+            enum class ProjectionSolver
+            {
+                /** \brief Singular value decomposition of the Jacobian. The
+                 most robust to ill-conditioned Jacobians, but the slowest.
+                 This is the default. */
+                SVD,
+                /** \brief Column pivoting QR decomposition of \f$J^T\f$, which
+                 gives the minimum norm step without forming \f$JJ^T\f$. */
+                QR,
+                /** \brief Robust Cholesky (LDLT) decomposition of \f$JJ^T\f$.
+                 The fastest solver, but forming \f$JJ^T\f$ squares the
+                 condition number of the Jacobian, so it is only suited to
+                 well-conditioned constraints. */
+                LDLT,
+                /** \brief As LDLT, but the Jacobian is only evaluated on the
+                 first iteration. It is then updated with Broyden's rank one
+                 update, unless an iteration does not at least halve the
+                 distance to the manifold. Useful when the Jacobian is expensive, e.g., when it
+                 is computed numerically. */
+                BROYDEN
+            };
+
+            /** \brief Statistics of the projection routine, accumulated over
+             all calls to project(). */
+            struct ProjectionStatistics
+            {
+                /** \brief Number of projections. */
+                std::uint64_t projections{0};
+
+                /** \brief Number of projections that did not reach the
+                 manifold. */
+                std::uint64_t failures{0};
+
+                /** \brief Number of Newton iterations. */
+                std::uint64_t iterations{0};
+
+                /** \brief Number of evaluations of the Jacobian. */
+                std::uint64_t jacobianEvaluations{0};
+            };
+
             /** \brief Constructor. The dimension of the ambient configuration
              space as well as the dimension of the function's output need to be
              specified (the co-dimension of the constraint manifold). I.E., for
@@ -135,7 +182,11 @@ namespace ompl
             virtual bool project(State *state) const;
 
             /** \brief Project a state \a x given the constraints. If a valid
-                projection cannot be found, this method will return false. */
+                projection cannot be found, this method will return false. The
+                default implementation uses Newton's method, with the solver set
+                by setProjectionSolver(). The temporary vectors and matrices it
+                uses are kept per thread, so projections do not allocate memory
+                once a thread has projected a state. */
             virtual bool project(Eigen::Ref<Eigen::VectorXd> x) const;
 
             /** \brief Returns the distance of \a state to the constraint
@@ -216,9 +267,73 @@ namespace ompl
                 maxIterations_ = iterations;
             }
 
+            /** \brief Returns the solver used by the projection routine. */
+            ProjectionSolver getProjectionSolver() const
+            {
+                return solver_;
+            }
+
+            /** \brief Sets the solver used by the projection routine. The
+             * default is ProjectionSolver::SVD. */
+            void setProjectionSolver(const ProjectionSolver solver)
+            {
+                solver_ = solver;
+            }
+
+            /** \brief Returns the statistics of the projection routine. */
+            ProjectionStatistics getProjectionStatistics() const;
+
+            /** \brief Resets the statistics of the projection routine. */
+            void clearProjectionStatistics();
+
             /** @} */
 
         protected:
+            /** \brief Newton's method for project(), with fixed-size temporaries
+             * for co-dimension \a K. */
+            template <int K>
+            bool newtonProject(Eigen::Ref<Eigen::VectorXd> x) const;
+
+            /** \brief Counters for the projection statistics. Each thread
+             * counts its projections in its own block, so projections from
+             * different threads do not write to shared memory. The blocks are
+             * added up by getProjectionStatistics(). A copied constraint
+             * starts with cleared statistics. */
+            struct ProjectionCounters
+            {
+                ProjectionCounters();
+                ProjectionCounters(const ProjectionCounters &);
+
+                /** \brief The counts of one thread, which only that thread
+                 * changes. */
+                struct ThreadCounts
+                {
+                    std::atomic<std::uint64_t> projections{0};
+                    std::atomic<std::uint64_t> failures{0};
+                    std::atomic<std::uint64_t> iterations{0};
+                    std::atomic<std::uint64_t> jacobianEvaluations{0};
+                };
+
+                /** \brief Identifier of these counters, never reused. */
+                const std::uint64_t id;
+
+                /** \brief Lock for the members below. */
+                std::mutex lock;
+
+                /** \brief The counts of the threads that may still project. */
+                std::vector<std::shared_ptr<ThreadCounts>> threads;
+
+                /** \brief The counts of the threads that are done. */
+                ProjectionStatistics folded;
+
+                /** \brief The counts at the last call to
+                 * clearProjectionStatistics(). */
+                ProjectionStatistics cleared;
+            };
+
+            /** \brief Get the counts of the calling thread. */
+            ProjectionCounters::ThreadCounts &threadCounts() const;
+
             /** \brief Ambient space dimension. */
             const unsigned int n_;
 
@@ -232,6 +347,12 @@ namespace ompl
             /** \brief Maximum number of iterations for Newton method used in
              * projection onto manifold. */
             unsigned int maxIterations_;
+
+            /** \brief Solver for the Newton steps of the projection routine. */
+            ProjectionSolver solver_{ProjectionSolver::SVD};
+
+            /** \brief Statistics of the projection routine. */
+            mutable ProjectionCounters counters_;
         };
 
         /// @cond IGNORE
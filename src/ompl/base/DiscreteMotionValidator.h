@@ -39,6 +39,9 @@
 
 #include "ompl/base/MotionValidator.h"
 #include "ompl/base/SpaceInformation.h"
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ompl
 {
@@ -61,16 +64,79 @@ namespace ompl
                 defaultSettings();
             }
 
-            ~DiscreteMotionValidator() override = default;
+            ~DiscreteMotionValidator() override;
 
             bool checkMotion(const State *s1, const State *s2) const override;
 
             bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const override;
 
+            /** \brief Set the number of states that are validated at once. If \e batchSize is larger than 1,
+                the intermediate states of a motion are generated into a reusable buffer (in bisection order
+                for checkMotion(s1, s2)) and passed to StateValidityChecker::isValidBatch() in groups of
+                \e batchSize states; checking stops at the first group that contains an invalid state.
+                A value of 0 (the default) or 1 checks one state at a time with StateValidityChecker::isValid(). */
+            void setBatchSize(unsigned int batchSize);
+
+            /** \brief Get the number of states that are validated at once */
+            unsigned int getBatchSize() const
+            {
+                return batchSize_;
+            }
+
         private:
+            /// @cond IGNORE
+            /** \brief Buffers used when validating states in batches */
+            struct BatchWorkspace
+            {
+                BatchWorkspace(const StateSpacePtr &space, unsigned int batchSize);
+                ~BatchWorkspace();
+
+                /** \brief Fill \e order with the indices of the intermediate states of a motion made of
+                    \e nd segments, in the order they are checked by bisection */
+                void computeBisectionOrder(int nd);
+
+                StateSpacePtr space;
+                std::vector<State *> states;
+                std::unique_ptr<bool[]> valid;
+                std::vector<int> order;
+                int orderSegments{0};
+            };
+            /// @endcond
+
             StateSpace *stateSpace_;
 
+            /** \brief The number of states validated at once (0 or 1 disables batching) */
+            unsigned int batchSize_{0};
+
+            /** \brief The buffers reused across calls when batching is enabled */
+            mutable std::unique_ptr<BatchWorkspace> workspace_;
+
+            /** \brief Lock protecting \e workspace_; calls that find it in use allocate their own buffers */
+            mutable std::mutex workspaceLock_;
+
             void defaultSettings();
+
+            /** \brief Batched version of checkMotion(s1, s2); \e s2 is assumed to be valid */
+            bool checkMotionBatch(const State *s1, const State *s2, int nd, BatchWorkspace &ws) const;
+
+            /** \brief Batched version of checkMotion(s1, s2, lastValid). Return the index of the first
+                invalid intermediate state, or \e nd if all intermediate states are valid */
+            int findFirstInvalidBatch(const State *s1, const State *s2, int nd, BatchWorkspace &ws) const;
+
+            /** \brief Run \e f with a batch workspace: the shared one if it is not in use, a temporary one otherwise */
+            template <typename Function>
+            auto withWorkspace(Function &&f) const -> decltype(f(*workspace_))
+            {
+                std::unique_lock<std::mutex> lock(workspaceLock_, std::try_to_lock);
+                if (lock.owns_lock())
+                {
+                    if (!workspace_)
+                        workspace_.reset(new BatchWorkspace(si_->getStateSpace(), batchSize_));
+                    return f(*workspace_);
+                }
+                BatchWorkspace ws(si_->getStateSpace(), batchSize_);
+                return f(ws);
+            }
         };
     }
 }
@@ -0,0 +1,215 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_BASE_FLAT_ROADMAP_
+#define OMPL_BASE_FLAT_ROADMAP_
+
+#include "ompl/base/PlannerData.h"
+#include "ompl/base/StateSpace.h"
+#include "ompl/util/ClassForward.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ompl
+{
+    namespace base
+    {
+        /// @cond IGNORE
+        /** \brief Forward declaration of ompl::base::FlatRoadmap */
+        OMPL_CLASS_FORWARD(FlatRoadmap);
+        /// @endcond
+
+        /** \brief A read-only view of a roadmap stored in a flat binary file
+            that is memory-mapped rather than deserialized.
+
+            Unlike PlannerDataStorage, which passes every vertex and edge
+            through a Boost archive and rebuilds a PlannerData graph, the
+            file holds fixed-size sections that are used in place: the
+            serialized states of all vertices one after the other, the
+            type (start, goal or regular) and tag of each vertex, and the
+            edges in compressed sparse row form (per-vertex offsets into
+            arrays of target vertices, sorted within each vertex, and
+            edge weights). Opening a roadmap validates the header and the
+            edge structure (offsets and targets), but the states and edge
+            weights are left in place: the operating system loads their
+            pages as they are accessed.
+
+            Only the accessors of this class use the mapping in place. The
+            planners that can be constructed from a FlatRoadmap (PRM,
+            PRMstar, LazyPRM and LazyPRMstar) deserialize every state into
+            their own graph and build their nearest-neighbor structure from
+            the states, as no index is stored in the file. What loading a
+            FlatRoadmap saves over PlannerDataStorage is the Boost archive
+            and the intermediate PlannerData. SPARS cannot load a
+            FlatRoadmap.
+
+            The file starts with a version number and the signature of the
+            state space (see StateSpace::computeSignature()); a roadmap
+            can only be opened with a state space that has the same
+            signature. Values are stored in the byte order of the machine
+            that wrote the file, which has to match the byte order of the
+            machine that reads it. */
+        class FlatRoadmap
+        {
+        public:
+            /** \brief The version of the file format written by store() */
+            static const std::uint32_t FORMAT_VERSION;
+
+            /** \brief Map the roadmap in \e filename, whose states belong to
+                \e space. Throws an Exception if the file cannot be mapped,
+                is not a roadmap in a supported version, was written
+                for a different state space, or has edges that do not
+                form a valid graph. */
+            FlatRoadmap(StateSpacePtr space, const std::string &filename);
+
+            ~FlatRoadmap();
+
+            FlatRoadmap(const FlatRoadmap &) = delete;
+            FlatRoadmap &operator=(const FlatRoadmap &) = delete;
+
+            /** \brief Write the vertices and edges of \e pd to \e filename in
+                the format read by this class. Vertex and edge objects are
+                not stored, apart from the tags of the vertices. */
+            static void store(const PlannerData &pd, const std::string &filename);
+
+            /** \brief The state space of the states in the roadmap */
+            const StateSpacePtr &getStateSpace() const
+            {
+                return space_;
+            }
+
+            /** \brief Get the number of vertices */
+            std::size_t numVertices() const
+            {
+                return vertexCount_;
+            }
+
+            /** \brief Get the number of (directed) edges */
+            std::size_t numEdges() const
+            {
+                return edgeCount_;
+            }
+
+            /** \brief Get the serialization of the state of vertex \e index
+                (StateSpace::getSerializationLength() bytes) */
+            const unsigned char *getSerializedState(std::size_t index) const
+            {
+                return states_ + index * stateLength_;
+            }
+
+            /** \brief Deserialize the state of vertex \e index into \e state */
+            void copyState(std::size_t index, State *state) const
+            {
+                space_->deserialize(state, getSerializedState(index));
+            }
+
+            /** \brief Check whether vertex \e index is a start vertex */
+            bool isStartVertex(std::size_t index) const;
+
+            /** \brief Check whether vertex \e index is a goal vertex */
+            bool isGoalVertex(std::size_t index) const;
+
+            /** \brief Get the tag of vertex \e index */
+            int getTag(std::size_t index) const
+            {
+                return tags_[index];
+            }
+
+            /** \brief Get the number of edges leaving vertex \e index */
+            std::size_t getNeighborCount(std::size_t index) const
+            {
+                return offsets_[index + 1] - offsets_[index];
+            }
+
+            /** \brief Get the targets of the edges leaving vertex \e index,
+                in increasing order (getNeighborCount() values) */
+            const std::uint32_t *getNeighbors(std::size_t index) const
+            {
+                return targets_ + offsets_[index];
+            }
+
+            /** \brief Get the weights of the edges leaving vertex \e index, in
+                the same order as getNeighbors() */
+            const double *getEdgeWeights(std::size_t index) const
+            {
+                return weights_ + offsets_[index];
+            }
+
+            /** \brief Check whether there is an edge from vertex \e from to vertex \e to */
+            bool edgeExists(std::size_t from, std::size_t to) const;
+
+        private:
+            /// @cond IGNORE
+            struct Mapping;
+            /// @endcond
+
+            /** \brief The state space of the roadmap */
+            StateSpacePtr space_;
+
+            /** \brief The mapped file */
+            std::unique_ptr<Mapping> mapping_;
+
+            /** \brief The number of vertices */
+            std::size_t vertexCount_{0};
+
+            /** \brief The number of edges */
+            std::size_t edgeCount_{0};
+
+            /** \brief The length of a serialized state */
+            std::size_t stateLength_{0};
+
+            /** \brief The type of each vertex */
+            const std::uint8_t *types_{nullptr};
+
+            /** \brief The tag of each vertex */
+            const std::int32_t *tags_{nullptr};
+
+            /** \brief The serialized states */
+            const unsigned char *states_{nullptr};
+
+            /** \brief The offset of the first edge of each vertex (and the number of edges, at the end) */
+            const std::uint64_t *offsets_{nullptr};
+
+            /** \brief The target vertex of each edge */
+            const std::uint32_t *targets_{nullptr};
+
+            /** \brief The weight of each edge */
+            const double *weights_{nullptr};
+        };
+    }
+}
+
+#endif
@@ -39,6 +39,7 @@
 
 #include "ompl/base/State.h"
 #include "ompl/util/ClassForward.h"
+#include <atomic>
 #include <utility>
 
 namespace ompl
@@ -101,25 +102,27 @@ namespace ompl
             /** \brief Get the number of segments that tested as valid */
             unsigned int getValidMotionCount() const
             {
-                return valid_;
+                return valid_.load(std::memory_order_relaxed);
             }
 
             /** \brief Get the number of segments that tested as invalid */
             unsigned int getInvalidMotionCount() const
             {
-                return invalid_;
+                return invalid_.load(std::memory_order_relaxed);
             }
 
             /** \brief Get the total number of segments tested, regardless of result */
             unsigned int getCheckedMotionCount() const
             {
-                return valid_ + invalid_;
+                return getValidMotionCount() + getInvalidMotionCount();
             }
 
             /** \brief Get the fraction of segments that tested as valid */
             double getValidMotionFraction() const
             {
-                return valid_ == 0 ? 0.0 : (double)valid_ / (double)(invalid_ + valid_);
+                const unsigned int valid = getValidMotionCount();
+                const unsigned int invalid = getInvalidMotionCount();
+                return valid == 0 ? 0.0 : (double)valid / (double)(invalid + valid);
             }
 
             /** \brief Reset the counters for valid and invalid segments */
@@ -132,11 +135,12 @@ namespace ompl
             /** \brief The instance of space information this state validity checker operates on */
             SpaceInformation *si_;
 
-            /** \brief Number of valid segments */
-            mutable unsigned int valid_;
+            /** \brief Number of valid segments. Motions may be checked from several threads at once, so the
+                counters are atomic; they are only statistics, so they are incremented with relaxed ordering. */
+            mutable std::atomic<unsigned int> valid_;
 
             /** \brief Number of invalid segments */
-            mutable unsigned int invalid_;
+            mutable std::atomic<unsigned int> invalid_;
         };
     }
 }
@@ -69,10 +69,16 @@ namespace ompl
             PlannerTerminationCondition(const PlannerTerminationConditionFn &fn);
 
             /** \brief Construct a termination condition that is evaluated every \e period seconds. The evaluation of
-                the condition consists of calling \e fn() in a separate thread. Calls to eval() will always return the
+                the condition consists of calling \e fn() in a separate thread owned by this condition, so that a
+                slow \e fn() delays neither the planner nor other conditions. Calls to eval() will always return the
                 last value computed by the call to \e fn(). */
             PlannerTerminationCondition(const PlannerTerminationConditionFn &fn, double period);
 
+            /** \brief Construct a termination condition that becomes true \e duration from now. The deadline is
+                expired by a timer thread that is shared by all termination conditions in the process, so eval() only
+                reads a flag and never queries the clock. */
+            explicit PlannerTerminationCondition(time::duration duration);
+
             ~PlannerTerminationCondition() = default;
 
             /** \brief Return true if the planner should stop its computation */
@@ -94,6 +100,12 @@ namespace ompl
             /** \brief The implementation of some termination condition. By default, this just calls \e fn_() */
             bool eval() const;
 
+            /** \brief Block the calling thread for at most \e seconds, returning early if terminate() is called or,
+                for timed and periodically evaluated conditions, as soon as the condition is met. Returns the value of
+                eval(). Conditions that only call a function cannot signal when it becomes true, so they are
+                evaluated again when the wait times out. */
+            bool waitFor(double seconds) const;
+
         private:
             class PlannerTerminationConditionImpl;
             std::shared_ptr<PlannerTerminationConditionImpl> impl_;
@@ -123,8 +135,8 @@ namespace ompl
         /** \brief Return a termination condition that will become true \e duration in the future (wall-time) */
         PlannerTerminationCondition timedPlannerTerminationCondition(time::duration duration);
 
-        /** \brief Return a termination condition that will become true \e duration seconds in the future (wall-time),
-         * but is checked in a separate thread, every \e interval seconds; \e interval must be less than \e duration */
+        /** \brief Return a termination condition that will become true \e duration seconds in the future (wall-time).
+         * The deadline is expired by the shared timer thread as soon as it passes, so \e interval is no longer used. */
         PlannerTerminationCondition timedPlannerTerminationCondition(double duration, double interval);
 
         /** \brief Return a termination condition that will become true as soon as the problem definition has an exact
@@ -96,6 +96,13 @@ namespace ompl
                 return stateValidityChecker_->isValid(state);
             }
 
+            /** \brief Check the validity of \e count states at once (see StateValidityChecker::isValidBatch()).
+                Return true if all the states are valid. */
+            bool isValidBatch(const State *const *states, std::size_t count, bool *valid) const
+            {
+                return stateValidityChecker_->isValidBatch(states, count, valid);
+            }
+
             /** \brief Return the instance of the used state space */
             const StateSpacePtr &getStateSpace() const
             {
@@ -0,0 +1,176 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_BASE_STATE_BATCH_
+#define OMPL_BASE_STATE_BATCH_
+
+#include "ompl/base/State.h"
+#include "ompl/util/ClassForward.h"
+#include <cstddef>
+#include <vector>
+
+namespace ompl
+{
+    namespace base
+    {
+        /// @cond IGNORE
+        OMPL_CLASS_FORWARD(StateSpace);
+        /// @endcond
+
+        /** \brief A collection of states from the same state space, used
+            to compute many distances with a single call to
+            StateSpace::distanceBatch().
+
+            Besides the pointers to the states, a batch keeps a packed
+            copy of the values of the states in structure-of-arrays
+            layout, if the state space supports it (see
+            StateSpace::getPackedValueCount()): value \e j of the \e i-th
+            state is stored at getValues()[j * getStride() + i]. This
+            layout allows the distance kernels of the state spaces to be
+            vectorized by the compiler. The values are copied when a
+            state is added, so the batch needs to be rebuilt if the
+            states it refers to are modified. */
+        class StateBatch
+        {
+        public:
+            /** \brief Construct an empty batch for states of \e space. If \e pack is false, or the space does not
+                support packing, only the pointers to the states are kept. */
+            StateBatch(const StateSpace *space, bool pack = true);
+
+            /** \brief Construct an empty batch for states of \e space. If \e pack is false, or the space does not
+                support packing, only the pointers to the states are kept. */
+            StateBatch(const StateSpacePtr &space, bool pack = true);
+
+            /** \brief Get the space the states in this batch belong to */
+            const StateSpace *getStateSpace() const
+            {
+                return space_;
+            }
+
+            /** \brief Add a state to the batch */
+            void add(const State *state);
+
+            /** \brief Add \e count states to the batch */
+            void add(const State *const *states, std::size_t count);
+
+            /** \brief Add a set of states to the batch */
+            void add(const std::vector<const State *> &states)
+            {
+                add(states.data(), states.size());
+            }
+
+            /** \brief Add a set of states to the batch */
+            void add(const std::vector<State *> &states)
+            {
+                add(states.data(), states.size());
+            }
+
+            /** \brief Reserve memory for \e capacity states */
+            void reserve(std::size_t capacity);
+
+            /** \brief Remove all the states from the batch (memory is kept for reuse) */
+            void clear();
+
+            /** \brief Get the number of states in the batch */
+            std::size_t size() const
+            {
+                return states_.size();
+            }
+
+            /** \brief Check whether the batch is empty */
+            bool empty() const
+            {
+                return states_.empty();
+            }
+
+            /** \brief Get the \e i-th state in the batch */
+            const State *operator[](std::size_t i) const
+            {
+                return states_[i];
+            }
+
+            /** \brief Get the array of states in the batch */
+            const State *const *getStates() const
+            {
+                return states_.data();
+            }
+
+            /** \brief Check whether the values of the states are also stored in packed form */
+            bool isPacked() const
+            {
+                return valueCount_ > 0;
+            }
+
+            /** \brief Get the number of packed values per state (0 if the batch is not packed) */
+            unsigned int getValueCount() const
+            {
+                return valueCount_;
+            }
+
+            /** \brief Get the packed values. Value \e j of state \e i is at index j * getStride() + i. */
+            const double *getValues() const
+            {
+                return values_.data();
+            }
+
+            /** \brief Get the distance (in number of doubles) between consecutive packed values of the same state */
+            std::size_t getStride() const
+            {
+                return stride_;
+            }
+
+        private:
+            /** \brief Change the stride of the packed values to \e stride, preserving the values already stored */
+            void setStride(std::size_t stride);
+
+            /** \brief The space the states belong to */
+            const StateSpace *space_;
+
+            /** \brief The states in the batch */
+            std::vector<const State *> states_;
+
+            /** \brief The number of packed values per state */
+            unsigned int valueCount_;
+
+            /** \brief The number of states the packed storage has room for */
+            std::size_t stride_{0};
+
+            /** \brief The packed values of the states, stored column by column */
+            std::vector<double> values_;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,194 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_BASE_STATE_POOL_
+#define OMPL_BASE_STATE_POOL_
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A thread-safe pool of fixed-size memory blocks,
+            used by state spaces to allocate states without a call
+            to the system allocator per state.
+
+            Blocks are carved out of large slabs of memory (whose
+            size grows geometrically) and recycled through free
+            lists when they are returned. Every thread allocates from
+            and returns blocks to its own shard of the free lists, so
+            threads that allocate states at the same time rarely wait
+            for each other; blocks move between the shards and a
+            shared free list in batches. Slabs are aligned to chunks
+            of memory that are tagged with the pool that owns them,
+            so owns() takes constant time and no lock. Every block is
+            aligned for any fundamental type. Memory is only given
+            back to the system when the pool is destroyed or when
+            release() is called and no blocks are in use.
+
+            See StateSpace::setStatePoolEnabled(). */
+        class StatePool
+        {
+        public:
+            // non-copyable
+            StatePool(const StatePool &) = delete;
+            StatePool &operator=(const StatePool &) = delete;
+
+            /** \brief Construct a pool that hands out blocks of at least \e blockSize bytes. The first slab holds
+                at least \e initialBlockCount blocks. */
+            StatePool(std::size_t blockSize, std::size_t initialBlockCount = 64);
+
+            ~StatePool();
+
+            /** \brief Get a block of memory from the pool */
+            void *allocate();
+
+            /** \brief Return a block previously obtained by allocate() to the pool */
+            void deallocate(void *block);
+
+            /** \brief Check whether \e block points inside memory managed by this pool */
+            bool owns(const void *block) const;
+
+            /** \brief Request the memory of the pool to be returned to the system. If no blocks are in use this
+                happens immediately. Otherwise the memory is released as soon as the last block in use is
+                deallocated. Returns true if the memory was released immediately. */
+            bool release();
+
+            /** \brief Get the size (in bytes) of the blocks handed out by this pool */
+            std::size_t getBlockSize() const
+            {
+                return blockSize_;
+            }
+
+            /** \brief Get the number of blocks currently in use */
+            std::size_t getUsedBlockCount() const;
+
+            /** \brief Get the number of blocks the pool has reserved memory for (used or not) */
+            std::size_t getReservedBlockCount() const;
+
+            /** \brief Round \e size up to the alignment used for the blocks of the pool */
+            static std::size_t alignSize(std::size_t size)
+            {
+                const std::size_t align = alignof(std::max_align_t);
+                return (size + align - 1) / align * align;
+            }
+
+        private:
+            /** \brief Element of the free lists; it overlays the memory of unused blocks */
+            struct FreeBlock
+            {
+                FreeBlock *next;
+            };
+
+            /** \brief A free list used by the threads assigned to it */
+            struct Shard
+            {
+                std::mutex lock;
+                FreeBlock *freeList{nullptr};
+                std::size_t count{0};
+                /** \brief Keep the shards on separate cache lines */
+                char padding[64];
+            };
+
+            /** \brief A slab of memory. Its blocks start at the chunk-aligned address \e begin */
+            struct Slab
+            {
+                char *memory;
+                char *begin;
+                char *end;
+            };
+
+            /** \brief Get the shard of the calling thread */
+            Shard &localShard();
+
+            /** \brief Move a batch of free blocks into \e shard, whose lock must be held */
+            void refill(Shard &shard);
+
+            /** \brief Return the memory of the pool to the system if no blocks are in use. The lock of
+                every shard must be held. */
+            bool releaseIfUnused();
+
+            /** \brief Allocate a new slab of memory, of twice the size of the previous one. The lock must be
+                held. */
+            void addSlab();
+
+            /** \brief Free all the slabs. The lock must be held and no blocks may be in use. */
+            void freeSlabs();
+
+            /** \brief The size of a block (aligned) */
+            const std::size_t blockSize_;
+
+            /** \brief The number of blocks the next slab will contain */
+            std::size_t nextSlabBlockCount_;
+
+            /** \brief The number of blocks the first slab contains */
+            const std::size_t initialBlockCount_;
+
+            /** \brief The free lists of the threads */
+            std::vector<Shard> shards_;
+
+            /** \brief The slabs of memory, as a map from the start of a slab to the slab */
+            std::map<char *, Slab> slabs_;
+
+            /** \brief Blocks returned by the shards, shared by all threads */
+            FreeBlock *freeList_{nullptr};
+
+            /** \brief The next never-used block in the most recent slab */
+            char *cursor_{nullptr};
+
+            /** \brief The end of the most recent slab */
+            char *cursorEnd_{nullptr};
+
+            /** \brief The number of blocks in use */
+            std::atomic<std::size_t> used_{0};
+
+            /** \brief The number of blocks memory is reserved for */
+            std::size_t reserved_{0};
+
+            /** \brief Flag indicating the memory should be released once no blocks are in use */
+            std::atomic<bool> releasePending_{false};
+
+            /** \brief Lock for the slabs, the shared free list and the cursor */
+            mutable std::mutex lock_;
+        };
+    }
+}
+
+#endif
@@ -99,6 +99,11 @@ namespace ompl
             */
             virtual void sampleGaussian(State *state, const State *mean, double stdDev) = 0;
 
+            /** \brief Draw the random numbers of this sampler from stream \e stream of seed \e seed (see
+                RNG::setLocalStream()), so that they do not depend on the order in which samplers were created.
+                Samplers that build on other samplers pass the stream on to them. */
+            virtual void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream);
+
         protected:
             /** \brief The state space this sampler samples */
             const StateSpace *space_;
@@ -137,6 +142,9 @@ namespace ompl
                 with stdDev scaled by the corresponding subspace weight. */
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
 
+            /** \brief Give each of the composed samplers its own seed, derived from \e seed, and stream \e stream */
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
         protected:
             /** \brief The samplers that are composed */
             std::vector<StateSamplerPtr> samplers_;
@@ -165,6 +173,8 @@ namespace ompl
 
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
         protected:
             /** \brief The subspace to sample */
             const StateSpace *subspace_;
@@ -38,8 +38,10 @@
 #define OMPL_BASE_STATE_SPACE_
 
 #include "ompl/base/State.h"
+#include "ompl/base/StateBatch.h"
 #include "ompl/base/StateSpaceTypes.h"
 #include "ompl/base/StateSampler.h"
+#include "ompl/base/StatePool.h"
 #include "ompl/base/ProjectionEvaluator.h"
 #include "ompl/base/GenericParam.h"
 #include "ompl/util/Console.h"
@@ -49,6 +51,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
 
 namespace ompl
 {
@@ -314,6 +317,40 @@ namespace ompl
                */
             virtual double distance(const State *state1, const State *state2) const = 0;
 
+            /** \brief Compute the distances from \e state to every state in \e batch, storing the distance to the
+                \e i-th state of the batch in \e distances[i]. If the batch is packed (and was constructed for this
+                space), accumulatePackedDistances() is used; otherwise the call is forwarded to the variant of this
+                function that takes an array of states. */
+            void distanceBatch(const State *state, const StateBatch &batch, double *distances) const;
+
+            /** \brief Compute the distances from \e state to each of the \e count states in \e states. The
+                default implementation calls distance() for every pair; spaces override it to avoid the cost of a
+                virtual call per pair. */
+            virtual void distanceBatch(const State *state, const State *const *states, std::size_t count,
+                                       double *distances) const;
+
+            /** \brief Get the number of values per state stored in a packed StateBatch for this space. The
+                default value of 0 means packing is not supported. Spaces that return a positive value must
+                implement packState() and accumulatePackedDistances(). */
+            virtual unsigned int getPackedValueCount() const;
+
+            /** \brief Write the getPackedValueCount() values of \e state to \e values, the \e j-th value going to
+                \e values[j * stride] */
+            virtual void packState(const State *state, double *values, std::size_t stride) const;
+
+            /** \brief For each of the \e count states packed in \e values (see StateBatch), add \e weight times
+                its distance from \e state to the corresponding element of \e distances. Compound spaces call this
+                for their components with the weight of each component. */
+            virtual void accumulatePackedDistances(const State *state, const double *values, std::size_t stride,
+                                                   std::size_t count, double weight, double *distances) const;
+
+            /** \brief Return a lower bound on the distance from the state whose packed values are \e values
+                (stored contiguously) to any state whose packed values all lie in the axis-aligned box
+                [\e low, \e high]. This is what allows spatial trees over packed coordinates to prune their
+                search. Spaces that support packing should override this function. */
+            virtual double packedDistanceLowerBound(const double *values, const double *low,
+                                                    const double *high) const;
+
             /** \brief Get the number of chars in the serialization of a state in this space */
             virtual unsigned int getSerializationLength() const;
 
@@ -355,6 +392,48 @@ namespace ompl
 
             /** @} */
 
+            /** @name Pooled state allocation
+                @{ */
+
+            /** \brief Enable or disable allocating the states of this space from a memory pool. When enabled, and
+                once setup() has been called, allocState() constructs every state in a single block of memory taken
+                from a StatePool (this includes the components of compound states) and freeState() returns the block
+                to the pool instead of the system allocator. States allocated before the pool is active, or after it
+                is disabled, can still be freed with freeState(). Only spaces that implement getStateMemorySize() and
+                constructStateAt() support pooling; for other spaces this setting has no effect. */
+            void setStatePoolEnabled(bool flag);
+
+            /** \brief Check whether pooled state allocation was requested for this space */
+            bool isStatePoolEnabled() const
+            {
+                return statePoolEnabled_;
+            }
+
+            /** \brief Get the pool states are allocated from (nullptr if no pool was created) */
+            const StatePool *getStatePool() const
+            {
+                return statePool_.get();
+            }
+
+            /** \brief Return the memory held by the state pool to the system. If states allocated from the pool
+                are still in use, the memory is released once the last of them is freed. This is called by
+                Planner::clear(). */
+            void releaseStatePool() const;
+
+            /** \brief Get the number of bytes needed to construct a state of this space with constructStateAt(). A
+                return value of 0 (the default) means the space does not support construction of states in
+                externally provided memory, and thus pooled allocation. */
+            virtual std::size_t getStateMemorySize() const;
+
+            /** \brief Construct a state in the block of memory \e memory, of at least getStateMemorySize() bytes,
+                aligned as the blocks of a StatePool. */
+            virtual State *constructStateAt(void *memory) const;
+
+            /** \brief Destruct a state constructed by constructStateAt(), without releasing its memory */
+            virtual void destructStateAt(State *state) const;
+
+            /** @} */
+
             /** @name Functionality specific to accessing real values in a state
                 @{ */
 
@@ -564,9 +643,40 @@ namespace ompl
             /** \brief All the known substat locations, by name. */
             std::map<std::string, SubstateLocation> substateLocationsByName_;
 
+            /** \brief Allocate a state from the state pool, if pooled allocation is active. Returns nullptr
+                otherwise. To be called by implementations of allocState(). */
+            State *allocPooledState() const
+            {
+                return statePoolActive_ ? constructStateAt(statePool_->allocate()) : nullptr;
+            }
+
+            /** \brief If \e state was allocated from the state pool, destruct it, return its memory to the pool
+                and return true. Return false otherwise. To be called by implementations of freeState(). */
+            bool freePooledState(State *state) const
+            {
+                if (!statePool_ || !statePool_->owns(state))
+                    return false;
+                destructStateAt(state);
+                statePool_->deallocate(state);
+                return true;
+            }
+
         private:
+            /** \brief Create (or re-create) the state pool if pooled allocation is enabled. Called by setup(). */
+            void setupStatePool();
+
             /** \brief State space name */
             std::string name_;
+
+            /** \brief Flag indicating whether pooled state allocation was requested */
+            bool statePoolEnabled_{false};
+
+            /** \brief Flag indicating whether new states are currently allocated from \e statePool_ */
+            bool statePoolActive_{false};
+
+            /** \brief The pool states are allocated from. This is kept (even if pooling is disabled) until the
+                space is destroyed, so that states allocated from it can be freed at any time */
+            std::unique_ptr<StatePool> statePool_;
         };
 
         /** \brief A space to allow the composition of state spaces */
@@ -693,6 +803,21 @@ namespace ompl
 
             double distance(const State *state1, const State *state2) const override;
 
+            using StateSpace::distanceBatch;
+
+            /** \brief Packing is supported if all the components support it. Spaces derived from
+                CompoundStateSpace need to override this function to enable packing, as they may define a different
+                distance. */
+            unsigned int getPackedValueCount() const override;
+
+            void packState(const State *state, double *values, std::size_t stride) const override;
+
+            void accumulatePackedDistances(const State *state, const double *values, std::size_t stride,
+                                           std::size_t count, double weight, double *distances) const override;
+
+            double packedDistanceLowerBound(const double *values, const double *low,
+                                            const double *high) const override;
+
             /** \brief When performing discrete validation of motions,
                 the length of the longest segment that does not
                 require state validation needs to be specified. This
@@ -715,6 +840,12 @@ namespace ompl
 
             void freeState(State *state) const override;
 
+            std::size_t getStateMemorySize() const override;
+
+            State *constructStateAt(void *memory) const override;
+
+            void destructStateAt(State *state) const override;
+
             double *getValueAddressAtIndex(State *state, unsigned int index) const override;
 
             /** @} */
@@ -731,6 +862,20 @@ namespace ompl
             /** \brief Allocate the state components. Called by allocState(). Usually called by derived state spaces. */
             void allocStateComponents(CompoundState *state) const;
 
+            /** \brief Get the number of bytes needed to store the components of a state (and the array of pointers
+                to them) after the compound state itself, or 0 if a component does not support construction in
+                provided memory. Usually called by derived state spaces implementing getStateMemorySize(). */
+            std::size_t getStateComponentsMemorySize() const;
+
+            /** \brief Get the sum of the packed value counts of the components, or 0 if a component does not
+                support packing. Usually called by derived state spaces implementing getPackedValueCount(). */
+            unsigned int getComponentsPackedValueCount() const;
+
+            /** \brief Construct the state components in the memory \e memory, which must have at least
+                getStateComponentsMemorySize() bytes. Called by constructStateAt(). Usually called by derived state
+                spaces. */
+            void constructStateComponentsAt(CompoundState *state, void *memory) const;
+
             /** \brief The state spaces that make up the compound state space */
             std::vector<StateSpacePtr> components_;
 
@@ -39,6 +39,7 @@
 
 #include "ompl/base/State.h"
 #include "ompl/util/ClassForward.h"
+#include <cstddef>
 
 namespace ompl
 {
@@ -131,6 +132,22 @@ namespace ompl
                 return isValid(state);
             }
 
+            /** \brief Check the validity of \e count states at once and store the result for \e states[i] in \e
+                valid[i]. Return true if all the states are valid. Collision checkers that can amortize work across
+                multiple queries (e.g., broadphase setup) should override this; the default implementation calls
+                isValid() for each state. */
+            virtual bool isValidBatch(const State *const *states, std::size_t count, bool *valid) const
+            {
+                bool result = true;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    valid[i] = isValid(states[i]);
+                    if (!valid[i])
+                        result = false;
+                }
+                return result;
+            }
+
             /** \brief Report the distance to the nearest invalid state when starting from \e state. If the distance is
                 negative, the value of clearance is the penetration depth.*/
             virtual double clearance(const State * /*state*/) const
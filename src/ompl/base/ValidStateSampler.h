@@ -40,6 +40,7 @@
 #include "ompl/base/State.h"
 #include "ompl/util/ClassForward.h"
 #include "ompl/base/GenericParam.h"
+#include <cstdint>
 #include <string>
 
 namespace ompl
@@ -90,6 +91,13 @@ namespace ompl
                 \note The memory for \e near must be disjoint from the memory for \e state */
             virtual bool sampleNear(State *state, const State *near, double distance) = 0;
 
+            /** \brief Draw the random numbers of this sampler from stream \e stream of seed \e seed (see
+                StateSampler::setLocalStream()). The default does nothing; samplers that build on a state sampler
+                pass the stream on to it. */
+            virtual void setLocalStream(std::uint_fast32_t /*seed*/, std::uint64_t /*stream*/)
+            {
+            }
+
             /** \brief Finding a valid sample usually requires
                 performing multiple attempts. This call allows setting
                 the number of such attempts. */
@@ -71,6 +71,8 @@ namespace ompl
             bool sample(State *state) override;
             bool sampleNear(State *state, const State *near, double distance) override;
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
             /** \brief Get the standard deviation used when sampling */
             double getStdDev() const
             {
@@ -57,6 +57,8 @@ namespace ompl
 
             bool sampleNear(State *state, const State *near, double distance) override;
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
             /** \brief The number of attempts at improving the clearance of the sampled state. */
             void setNrImproveAttempts(unsigned int attempts)
             {
@@ -65,6 +65,8 @@ namespace ompl
 
             bool sampleNear(State *state, const State *near, double distance) override;
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
             /** \brief Set the minimum required distance of sample from nearest obstacle to be considered valid */
             void setMinimumObstacleClearance(double clearance)
             {
@@ -56,6 +56,8 @@ namespace ompl
             bool sample(State *state) override;
             bool sampleNear(State *state, const State *near, double distance) override;
 
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
         protected:
             /** \brief The sampler to build upon */
             StateSamplerPtr sampler_;
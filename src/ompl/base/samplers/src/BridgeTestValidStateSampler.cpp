@@ -63,3 +63,8 @@ bool ompl::base::BridgeTestValidStateSampler::sampleNear(State *state, const Sta
     si_->freeState(endpoint);
     return valid;
 }
+
+void ompl::base::BridgeTestValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
@@ -100,3 +100,8 @@ bool ompl::base::GaussianValidStateSampler::sampleNear(State *state, const State
     si_->freeState(temp);
     return result;
 }
+
+void ompl::base::GaussianValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
@@ -122,3 +122,8 @@ bool ompl::base::MaximizeClearanceValidStateSampler::sampleNear(State *state, co
     }
     return false;
 }
+
+void ompl::base::MaximizeClearanceValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
@@ -98,3 +98,8 @@ bool ompl::base::MinimumClearanceValidStateSampler::sampleNear(State *state, con
 
     return valid;
 }
+
+void ompl::base::MinimumClearanceValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
@@ -114,3 +114,8 @@ bool ompl::base::ObstacleBasedValidStateSampler::sampleNear(State *state, const
 
     return valid;
 }
+
+void ompl::base::ObstacleBasedValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
@@ -68,3 +68,8 @@ bool ompl::base::UniformValidStateSampler::sampleNear(State *state, const State
     } while (!valid && attempts < attempts_);
     return valid;
 }
+
+void ompl::base::UniformValidStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
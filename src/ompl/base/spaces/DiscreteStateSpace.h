@@ -118,6 +118,12 @@ namespace ompl
 
             void freeState(State *state) const override;
 
+            std::size_t getStateMemorySize() const override;
+
+            State *constructStateAt(void *memory) const override;
+
+            void destructStateAt(State *state) const override;
+
             void printState(const State *state, std::ostream &out) const override;
 
             void printSettings(std::ostream &out) const override;
@@ -137,6 +137,17 @@ namespace ompl
 
             State *allocState() const override;
             void freeState(State *state) const override;
+            std::size_t getStateMemorySize() const override;
+            State *constructStateAt(void *memory) const override;
+
+            using CompoundStateSpace::distanceBatch;
+
+            void distanceBatch(const State *state, const State *const *states, std::size_t count,
+                               double *distances) const override;
+
+            /** \brief Packing is only supported by this class, not by spaces derived from it, as they may define
+                a different distance */
+            unsigned int getPackedValueCount() const override;
 
             void registerProjections() override;
         };
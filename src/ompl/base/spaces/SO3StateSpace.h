@@ -140,6 +140,23 @@ namespace ompl
 
             double distance(const State *state1, const State *state2) const override;
 
+            using StateSpace::distanceBatch;
+
+            void distanceBatch(const State *state, const State *const *states, std::size_t count,
+                               double *distances) const override;
+
+            /** \brief Packing is only supported by this class, not by spaces derived from it, as they may define
+                a different distance */
+            unsigned int getPackedValueCount() const override;
+
+            void packState(const State *state, double *values, std::size_t stride) const override;
+
+            void accumulatePackedDistances(const State *state, const double *values, std::size_t stride,
+                                           std::size_t count, double weight, double *distances) const override;
+
+            double packedDistanceLowerBound(const double *values, const double *low,
+                                            const double *high) const override;
+
             bool equalStates(const State *state1, const State *state2) const override;
 
             void interpolate(const State *from, const State *to, double t, State *state) const override;
@@ -150,6 +167,12 @@ namespace ompl
 
             void freeState(State *state) const override;
 
+            std::size_t getStateMemorySize() const override;
+
+            State *constructStateAt(void *memory) const override;
+
+            void destructStateAt(State *state) const override;
+
             double *getValueAddressAtIndex(State *state, unsigned int index) const override;
 
             void printState(const State *state, std::ostream &out) const override;
@@ -70,6 +70,9 @@ namespace ompl
             /** \brief Sample a state within a Gaussian distribution using underlying sampler. */
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
 
+            /** \brief Set the stream of the underlying sampler. */
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
         protected:
             /** \brief Underlying state sampler. */
             StateSamplerPtr sampler_;
@@ -46,6 +46,11 @@
 
 #include <Eigen/Core>
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace ompl
 {
     namespace magic
@@ -61,6 +66,119 @@ namespace ompl
         OMPL_CLASS_FORWARD(ConstrainedStateSpace);
         /// @endcond
 
+        /** \brief A bounded cache of discrete geodesics (see
+         * ConstrainedStateSpace::discreteGeodesic()), computed without
+         * collision checking. Geodesics are keyed by the addresses of their
+         * endpoints, and a cached geodesic is only returned if its endpoints
+         * still hold the values they had when it was computed, so endpoints
+         * that were modified, or freed and reallocated, are not an issue.
+         * When the cached geodesics hold more states than the capacity of the
+         * cache, the least recently used ones are evicted. All operations are
+         * thread safe. */
+        class GeodesicCache
+        {
+        public:
+            /** \brief A discrete geodesic. The states are freed with the geodesic. */
+            struct Geodesic
+            {
+                /** \brief Take ownership of \a states, the geodesic from
+                 * \a from to \a to. Copies of the endpoints are kept. */
+                Geodesic(const StateSpace *space, const State *from, const State *to, std::vector<State *> states,
+                         bool reached);
+
+                ~Geodesic();
+
+                Geodesic(const Geodesic &) = delete;
+                Geodesic &operator=(const Geodesic &) = delete;
+
+                /** \brief The space the states belong to. */
+                const StateSpace *space;
+
+                /** \brief Copies of the endpoints the geodesic was computed for. */
+                State *from;
+                State *to;
+
+                /** \brief The intermediate states, as returned by discreteGeodesic(). */
+                std::vector<State *> states;
+
+                /** \brief Whether the geodesic reached \a to. */
+                bool reached;
+            };
+
+            /** \brief A shared pointer to a cached geodesic, which remains
+             * valid if the geodesic is evicted from the cache. */
+            using GeodesicPtr = std::shared_ptr<const Geodesic>;
+
+            /** \brief Constructor. \a capacity is the maximum number of
+             * states stored in the cache. */
+            GeodesicCache(const StateSpace *space, std::size_t capacity);
+
+            /** \brief Return the cached geodesic from \a from to \a to, or
+             * nullptr if there is none. */
+            GeodesicPtr find(const State *from, const State *to);
+
+            /** \brief Cache the geodesic from \a from to \a to made of
+             * \a states, which the cache takes ownership of, and return it.
+             * Geodesics longer than the capacity of the cache are returned
+             * without being cached. */
+            GeodesicPtr insert(const State *from, const State *to, std::vector<State *> states, bool reached);
+
+            /** \brief Remove all geodesics from the cache. */
+            void clear();
+
+            /** \brief Get the maximum number of states stored in the cache. */
+            std::size_t getCapacity() const;
+
+            /** \brief Set the maximum number of states stored in the cache,
+             * evicting geodesics if needed. */
+            void setCapacity(std::size_t capacity);
+
+            /** \brief Get the number of states currently stored in the cache. */
+            std::size_t getStateCount() const;
+
+            /** \brief Get the number of calls to find() that returned a geodesic. */
+            std::size_t getHits() const;
+
+            /** \brief Get the number of calls to find() that returned nullptr. */
+            std::size_t getMisses() const;
+
+        private:
+            using Key = std::pair<const State *, const State *>;
+
+            struct KeyHash
+            {
+                std::size_t operator()(const Key &key) const
+                {
+                    std::size_t h = std::hash<const State *>()(key.first);
+                    return h ^ (std::hash<const State *>()(key.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+                }
+            };
+
+            using Entry = std::pair<Key, GeodesicPtr>;
+
+            /** \brief Remove the geodesic at \a it. */
+            void erase(std::list<Entry>::iterator it);
+
+            /** \brief Evict the least recently used geodesics until at most
+             * \a count states are stored. */
+            void shrink(std::size_t count);
+
+            const StateSpace *space_;
+
+            /** \brief The cached geodesics, most recently used first. */
+            std::list<Entry> entries_;
+
+            /** \brief The position of each cached geodesic in \e entries_. */
+            std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+
+            std::size_t capacity_;
+            std::size_t stateCount_{0};
+            std::size_t hits_{0};
+            std::size_t misses_{0};
+
+            mutable std::mutex lock_;
+        };
+
         /** \brief Constrained configuration space specific implementation of
          * checkMotion() that uses discreteGeodesic(). */
         class ConstrainedMotionValidator : public MotionValidator
@@ -85,9 +203,37 @@ namespace ompl
              * metric. */
             bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const override;
 
+            /** \brief Set the number of geodesic states that are validated at
+             * once. If \e batchSize is larger than 1, or if the space caches
+             * geodesics (see ConstrainedStateSpace::setGeodesicCacheSize()),
+             * motions are checked by computing (or looking up) the geodesic
+             * without collision checking and validating its states with
+             * SpaceInformation::isValidBatch() in groups of \e batchSize
+             * states, stopping at the first group that contains an invalid
+             * state. A value of 0 (the default) or 1 checks one state at a
+             * time. */
+            void setBatchSize(unsigned int batchSize)
+            {
+                batchSize_ = batchSize;
+            }
+
+            /** \brief Get the number of geodesic states that are validated at once. */
+            unsigned int getBatchSize() const
+            {
+                return batchSize_;
+            }
+
         protected:
+            /** \brief Return the number of states at the start of \a states
+             * that are valid. The first state is the start of the motion and
+             * is assumed to be valid. */
+            std::size_t countValid(const std::vector<State *> &states) const;
+
             /** \brief Space in which we check motion. */
             const ConstrainedStateSpace &ss_;
+
+            /** \brief The number of states validated at once. */
+            unsigned int batchSize_{0};
         };
 
         /**
@@ -258,6 +404,12 @@ namespace ompl
              * stateList. Returns a pointer to a state in \a geodesic. */
             virtual State *geodesicInterpolate(const std::vector<State *> &geodesic, double t) const;
 
+            /** \brief Return the geodesic computed by
+             * discreteGeodesic(\a from, \a to, true, ...). If geodesic
+             * caching is enabled (see setGeodesicCacheSize()), the geodesic is
+             * looked up in the cache first, and cached once computed. */
+            GeodesicCache::GeodesicPtr getGeodesic(const State *from, const State *to) const;
+
             /** @} */
 
             /** @name Setters and Getters
@@ -278,6 +430,8 @@ namespace ompl
                     throw ompl::Exception("ompl::base::AtlasStateSpace::setLambda(): "
                                           "lambda must be > 1.");
                 lambda_ = lambda;
+                if (geodesicCache_)
+                    geodesicCache_->clear();
             }
 
             /** \brief Get delta, the step size across the manifold. */
@@ -292,6 +446,26 @@ namespace ompl
                 return lambda_;
             }
 
+            /** \brief Set the maximum number of states in the geodesics that
+             * are cached for reuse by interpolate() and
+             * ConstrainedMotionValidator. Repeated interpolation along the same
+             * motion (e.g., during path simplification) then traverses the
+             * manifold once. Only the geodesics are cached, not the validity of
+             * their states. 0 (the default) disables the cache. */
+            void setGeodesicCacheSize(std::size_t states);
+
+            /** \brief Get the maximum number of states in cached geodesics (0 if caching is disabled). */
+            std::size_t getGeodesicCacheSize() const
+            {
+                return geodesicCache_ ? geodesicCache_->getCapacity() : 0;
+            }
+
+            /** \brief Get the geodesic cache, or nullptr if caching is disabled. */
+            GeodesicCache *getGeodesicCache() const
+            {
+                return geodesicCache_.get();
+            }
+
             /** \brief Returns the dimension of the ambient space. */
             unsigned int getAmbientDimension() const
             {
@@ -337,6 +511,9 @@ namespace ompl
 
             /** \brief Whether setup() has been called. */
             bool setup_{false};
+
+            /** \brief Cache of geodesics computed for interpolation, if enabled. */
+            std::unique_ptr<GeodesicCache> geodesicCache_;
         };
     }
 }
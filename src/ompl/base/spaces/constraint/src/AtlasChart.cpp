@@ -355,8 +355,7 @@ bool ompl::base::AtlasChart::estimateIsFrontier() const
     Eigen::VectorXd ru(k_);
     for (int k = 0; k < 1000; k++)
     {
-        for (int i = 0; i < ru.size(); i++)
-            ru[i] = rng.gaussian01();
+        rng.gaussian01(ru.data(), ru.size());
         ru *= radius_ / ru.norm();
         if (inPolytope(ru))
             return true;
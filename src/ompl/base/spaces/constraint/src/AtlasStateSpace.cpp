@@ -70,8 +70,7 @@ void ompl::base::AtlasStateSampler::sampleUniform(State *state)
             // Sample a point within rho_s of the center. This is done by
             // sampling uniformly on the surface and multiplying by a dist
             // whose distribution is biased according to spherical volume.
-            for (std::size_t i = 0; i < k; ++i)
-                ru[i] = rng_.gaussian01();
+            rng_.gaussian01(ru.data(), k);
 
             ru *= atlas_->getRho_s() * std::pow(rng_.uniform01(), 1.0 / k) / ru.norm();
         } while (tries-- > 0 && !c->inPolytope(ru));
@@ -38,6 +38,127 @@
 #include "ompl/base/spaces/constraint/ConstrainedStateSpace.h"
 #include "ompl/util/Exception.h"
 
+#include <algorithm>
+#include <iterator>
+
+/// GeodesicCache
+
+ompl::base::GeodesicCache::Geodesic::Geodesic(const StateSpace *space, const State *from, const State *to,
+                                              std::vector<State *> states, bool reached)
+  : space(space), from(space->cloneState(from)), to(space->cloneState(to)), states(std::move(states)), reached(reached)
+{
+}
+
+ompl::base::GeodesicCache::Geodesic::~Geodesic()
+{
+    space->freeState(from);
+    space->freeState(to);
+    for (auto s : states)
+        space->freeState(s);
+}
+
+ompl::base::GeodesicCache::GeodesicCache(const StateSpace *space, std::size_t capacity)
+  : space_(space), capacity_(capacity)
+{
+}
+
+ompl::base::GeodesicCache::GeodesicPtr ompl::base::GeodesicCache::find(const State *from, const State *to)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    auto it = index_.find(Key(from, to));
+    if (it == index_.end())
+    {
+        ++misses_;
+        return nullptr;
+    }
+
+    // The endpoints may have changed since the geodesic was computed.
+    const GeodesicPtr &geodesic = it->second->second;
+    if (!space_->equalStates(geodesic->from, from) || !space_->equalStates(geodesic->to, to))
+    {
+        erase(it->second);
+        ++misses_;
+        return nullptr;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    ++hits_;
+    return entries_.front().second;
+}
+
+ompl::base::GeodesicCache::GeodesicPtr ompl::base::GeodesicCache::insert(const State *from, const State *to,
+                                                                         std::vector<State *> states, bool reached)
+{
+    // Count the stored copies of the endpoints as well.
+    const std::size_t count = states.size() + 2;
+    auto geodesic = std::make_shared<const Geodesic>(space_, from, to, std::move(states), reached);
+
+    std::lock_guard<std::mutex> lock(lock_);
+    if (count > capacity_)
+        return geodesic;
+
+    const Key key(from, to);
+    auto it = index_.find(key);
+    if (it != index_.end())
+        erase(it->second);
+
+    shrink(capacity_ - count);
+    entries_.emplace_front(key, geodesic);
+    index_[key] = entries_.begin();
+    stateCount_ += count;
+    return geodesic;
+}
+
+void ompl::base::GeodesicCache::clear()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    shrink(0);
+}
+
+std::size_t ompl::base::GeodesicCache::getCapacity() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return capacity_;
+}
+
+void ompl::base::GeodesicCache::setCapacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    capacity_ = capacity;
+    shrink(capacity_);
+}
+
+std::size_t ompl::base::GeodesicCache::getStateCount() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return stateCount_;
+}
+
+std::size_t ompl::base::GeodesicCache::getHits() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return hits_;
+}
+
+std::size_t ompl::base::GeodesicCache::getMisses() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return misses_;
+}
+
+void ompl::base::GeodesicCache::erase(std::list<Entry>::iterator it)
+{
+    stateCount_ -= it->second->states.size() + 2;
+    index_.erase(it->first);
+    entries_.erase(it);
+}
+
+void ompl::base::GeodesicCache::shrink(std::size_t count)
+{
+    while (stateCount_ > count)
+        erase(std::prev(entries_.end()));
+}
+
 /// ConstrainedMotionValidator
 
 /// Public
@@ -54,12 +175,49 @@ ompl::base::ConstrainedMotionValidator::ConstrainedMotionValidator(const SpaceIn
 
 bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const State *s2) const
 {
+    if (batchSize_ > 1 || ss_.getGeodesicCache() != nullptr)
+    {
+        if (!ss_.getConstraint()->isSatisfied(s2))
+            return false;
+        auto geodesic = ss_.getGeodesic(s1, s2);
+        return geodesic->reached && countValid(geodesic->states) == geodesic->states.size();
+    }
+
     return ss_.getConstraint()->isSatisfied(s2) && ss_.discreteGeodesic(s1, s2, false);
 }
 
 bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const State *s2,
                                                          std::pair<State *, double> &lastValid) const
 {
+    if (batchSize_ > 1 || ss_.getGeodesicCache() != nullptr)
+    {
+        auto geodesic = ss_.getGeodesic(s1, s2);
+        const std::vector<State *> &states = geodesic->states;
+        const std::size_t valid = countValid(states);
+        if (valid == 0)
+        {
+            if (lastValid.first != nullptr)
+                ss_.copyState(lastValid.first, s1);
+
+            lastValid.second = 0;
+            return false;
+        }
+
+        const bool reached = geodesic->reached && valid == states.size();
+        if (!reached && (lastValid.first != nullptr))
+        {
+            double distanceTraveled = 0;
+            for (std::size_t i = 1; i < valid; ++i)
+                distanceTraveled += ss_.distance(states[i - 1], states[i]);
+
+            ss_.copyState(lastValid.first, states[valid - 1]);
+            double approxDistanceRemaining = ss_.distance(lastValid.first, s2);
+            lastValid.second = distanceTraveled / (distanceTraveled + approxDistanceRemaining);
+        }
+
+        return ss_.getConstraint()->isSatisfied(s2) && reached;
+    }
+
     // Invoke the manifold-traversing algorithm to save intermediate states
     std::vector<ompl::base::State *> stateList;
     bool reached = ss_.discreteGeodesic(s1, s2, false, &stateList);
@@ -99,6 +257,31 @@ bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const
     return ss_.getConstraint()->isSatisfied(s2) && reached;
 }
 
+std::size_t ompl::base::ConstrainedMotionValidator::countValid(const std::vector<State *> &states) const
+{
+    if (states.empty())
+        return 0;
+
+    if (batchSize_ <= 1)
+    {
+        std::size_t i = 1;
+        while (i < states.size() && si_->isValid(states[i]))
+            ++i;
+        return i;
+    }
+
+    std::unique_ptr<bool[]> valid(new bool[batchSize_]);
+    for (std::size_t i = 1; i < states.size(); i += batchSize_)
+    {
+        const std::size_t count = std::min<std::size_t>(batchSize_, states.size() - i);
+        if (!si_->isValidBatch(&states[i], count, valid.get()))
+            for (std::size_t j = 0; j < count; ++j)
+                if (!valid[j])
+                    return i + j;
+    }
+    return states.size();
+}
+
 ompl::base::ConstrainedStateSpace::ConstrainedStateSpace(const StateSpacePtr &space, const ConstraintPtr &constraint)
   : WrapperStateSpace(space)
   , constraint_(constraint)
@@ -215,6 +398,9 @@ void ompl::base::ConstrainedStateSpace::setDelta(double delta)
                               "delta must be positive.");
     delta_ = delta;
 
+    if (geodesicCache_)
+        geodesicCache_->clear();
+
     if (setup_)
     {
         setLongestValidSegmentFraction(delta_ / getMaximumExtent());
@@ -260,6 +446,18 @@ void ompl::base::ConstrainedStateSpace::setup()
 
 void ompl::base::ConstrainedStateSpace::clear()
 {
+    if (geodesicCache_)
+        geodesicCache_->clear();
+}
+
+void ompl::base::ConstrainedStateSpace::setGeodesicCacheSize(std::size_t states)
+{
+    if (states == 0)
+        geodesicCache_.reset();
+    else if (geodesicCache_)
+        geodesicCache_->setCapacity(states);
+    else
+        geodesicCache_.reset(new GeodesicCache(this, states));
 }
 
 ompl::base::State *ompl::base::ConstrainedStateSpace::allocState() const
@@ -270,6 +468,13 @@ ompl::base::State *ompl::base::ConstrainedStateSpace::allocState() const
 void ompl::base::ConstrainedStateSpace::interpolate(const State *from, const State *to, const double t,
                                                     State *state) const
 {
+    if (geodesicCache_)
+    {
+        auto geodesic = getGeodesic(from, to);
+        copyState(state, geodesic->reached ? geodesicInterpolate(geodesic->states, t) : from);
+        return;
+    }
+
     // Get the list of intermediate states along the manifold.
     std::vector<State *> geodesic;
 
@@ -284,6 +489,20 @@ void ompl::base::ConstrainedStateSpace::interpolate(const State *from, const Sta
         freeState(s);
 }
 
+ompl::base::GeodesicCache::GeodesicPtr ompl::base::ConstrainedStateSpace::getGeodesic(const State *from,
+                                                                                     const State *to) const
+{
+    if (geodesicCache_)
+        if (auto geodesic = geodesicCache_->find(from, to))
+            return geodesic;
+
+    std::vector<State *> states;
+    bool reached = discreteGeodesic(from, to, true, &states);
+    if (geodesicCache_)
+        return geodesicCache_->insert(from, to, std::move(states), reached);
+    return std::make_shared<const GeodesicCache::Geodesic>(this, from, to, std::move(states), reached);
+}
+
 ompl::base::State *ompl::base::ConstrainedStateSpace::geodesicInterpolate(const std::vector<State *> &geodesic,
                                                                           const double t) const
 {
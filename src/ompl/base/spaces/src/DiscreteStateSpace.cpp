@@ -136,14 +136,33 @@ ompl::base::StateSamplerPtr ompl::base::DiscreteStateSpace::allocDefaultStateSam
 
 ompl::base::State *ompl::base::DiscreteStateSpace::allocState() const
 {
+    if (State *state = allocPooledState())
+        return state;
     return new StateType();
 }
 
 void ompl::base::DiscreteStateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     delete static_cast<StateType *>(state);
 }
 
+std::size_t ompl::base::DiscreteStateSpace::getStateMemorySize() const
+{
+    return sizeof(StateType);
+}
+
+ompl::base::State *ompl::base::DiscreteStateSpace::constructStateAt(void *memory) const
+{
+    return new (memory) StateType();
+}
+
+void ompl::base::DiscreteStateSpace::destructStateAt(State *state) const
+{
+    static_cast<StateType *>(state)->~StateType();
+}
+
 void ompl::base::DiscreteStateSpace::registerProjections()
 {
     class DiscreteDefaultProjection : public ProjectionEvaluator
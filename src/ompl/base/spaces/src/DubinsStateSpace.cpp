@@ -376,9 +376,9 @@ bool ompl::base::DubinsMotionValidator::checkMotion(const State *s1, const State
         }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
@@ -428,9 +428,9 @@ bool ompl::base::DubinsMotionValidator::checkMotion(const State *s1, const State
     }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
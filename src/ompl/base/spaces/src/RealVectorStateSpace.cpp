@@ -41,6 +41,7 @@
 #include <cstring>
 #include <limits>
 #include <cmath>
+#include <typeinfo>
 
 void ompl::base::RealVectorStateSampler::sampleUniform(State *state)
 {
@@ -48,8 +49,9 @@ void ompl::base::RealVectorStateSampler::sampleUniform(State *state)
     const RealVectorBounds &bounds = static_cast<const RealVectorStateSpace *>(space_)->getBounds();
 
     auto *rstate = static_cast<RealVectorStateSpace::StateType *>(state);
+    rng_.uniform01(rstate->values, dim);
     for (unsigned int i = 0; i < dim; ++i)
-        rstate->values[i] = rng_.uniformReal(bounds.low[i], bounds.high[i]);
+        rstate->values[i] = (bounds.high[i] - bounds.low[i]) * rstate->values[i] + bounds.low[i];
 }
 
 void ompl::base::RealVectorStateSampler::sampleUniformNear(State *state, const State *near, const double distance)
@@ -241,6 +243,70 @@ double ompl::base::RealVectorStateSpace::distance(const State *state1, const Sta
     return sqrt(dist);
 }
 
+void ompl::base::RealVectorStateSpace::distanceBatch(const State *state, const State *const *states,
+                                                     std::size_t count, double *distances) const
+{
+    if (typeid(*this) != typeid(RealVectorStateSpace))
+    {
+        StateSpace::distanceBatch(state, states, count, distances);
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+        distances[i] = RealVectorStateSpace::distance(state, states[i]);
+}
+
+unsigned int ompl::base::RealVectorStateSpace::getPackedValueCount() const
+{
+    return typeid(*this) == typeid(RealVectorStateSpace) ? dimension_ : 0u;
+}
+
+void ompl::base::RealVectorStateSpace::packState(const State *state, double *values, std::size_t stride) const
+{
+    const double *s = static_cast<const StateType *>(state)->values;
+    for (unsigned int j = 0; j < dimension_; ++j)
+        values[j * stride] = s[j];
+}
+
+void ompl::base::RealVectorStateSpace::accumulatePackedDistances(const State *state, const double *values,
+                                                                 std::size_t stride, std::size_t count,
+                                                                 double weight, double *distances) const
+{
+    // process the states in blocks, so that the squared distances fit in a local buffer; the inner loops are
+    // over consecutive memory and are vectorized by the compiler
+    const std::size_t blockSize = 64;
+    double sq[blockSize];
+    const double *s = static_cast<const StateType *>(state)->values;
+    for (std::size_t start = 0; start < count; start += blockSize)
+    {
+        const std::size_t n = std::min(blockSize, count - start);
+        std::fill(sq, sq + n, 0.0);
+        for (unsigned int j = 0; j < dimension_; ++j)
+        {
+            const double *column = values + j * stride + start;
+            const double v = s[j];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                double diff = column[i] - v;
+                sq[i] += diff * diff;
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            distances[start + i] += weight * std::sqrt(sq[i]);
+    }
+}
+
+double ompl::base::RealVectorStateSpace::packedDistanceLowerBound(const double *values, const double *low,
+                                                                  const double *high) const
+{
+    double sq = 0.0;
+    for (unsigned int j = 0; j < dimension_; ++j)
+    {
+        double gap = std::max(std::max(low[j] - values[j], values[j] - high[j]), 0.0);
+        sq += gap * gap;
+    }
+    return std::sqrt(sq);
+}
+
 bool ompl::base::RealVectorStateSpace::equalStates(const State *state1, const State *state2) const
 {
     const double *s1 = static_cast<const StateType *>(state1)->values;
@@ -271,6 +337,8 @@ ompl::base::StateSamplerPtr ompl::base::RealVectorStateSpace::allocDefaultStateS
 
 ompl::base::State *ompl::base::RealVectorStateSpace::allocState() const
 {
+    if (State *state = allocPooledState())
+        return state;
     auto *rstate = new StateType();
     rstate->values = new double[dimension_];
     return rstate;
@@ -278,11 +346,30 @@ ompl::base::State *ompl::base::RealVectorStateSpace::allocState() const
 
 void ompl::base::RealVectorStateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     auto *rstate = static_cast<StateType *>(state);
     delete[] rstate->values;
     delete rstate;
 }
 
+std::size_t ompl::base::RealVectorStateSpace::getStateMemorySize() const
+{
+    return StatePool::alignSize(sizeof(StateType)) + stateBytes_;
+}
+
+ompl::base::State *ompl::base::RealVectorStateSpace::constructStateAt(void *memory) const
+{
+    auto *rstate = new (memory) StateType();
+    rstate->values = reinterpret_cast<double *>(static_cast<char *>(memory) + StatePool::alignSize(sizeof(StateType)));
+    return rstate;
+}
+
+void ompl::base::RealVectorStateSpace::destructStateAt(State *state) const
+{
+    static_cast<StateType *>(state)->~StateType();
+}
+
 double *ompl::base::RealVectorStateSpace::getValueAddressAtIndex(State *state, const unsigned int index) const
 {
     return index < dimension_ ? static_cast<StateType *>(state)->values + index : nullptr;
@@ -651,9 +651,9 @@ bool ompl::base::ReedsSheppMotionValidator::checkMotion(const State *s1, const S
         }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
@@ -703,9 +703,9 @@ bool ompl::base::ReedsSheppMotionValidator::checkMotion(const State *s1, const S
     }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
@@ -37,9 +37,12 @@
 #include "ompl/base/spaces/SE2StateSpace.h"
 #include "ompl/tools/config/MagicConstants.h"
 #include <cstring>
+#include <typeinfo>
 
 ompl::base::State *ompl::base::SE2StateSpace::allocState() const
 {
+    if (State *pooled = allocPooledState())
+        return pooled;
     auto *state = new StateType();
     allocStateComponents(state);
     return state;
@@ -50,6 +53,44 @@ void ompl::base::SE2StateSpace::freeState(State *state) const
     CompoundStateSpace::freeState(state);
 }
 
+std::size_t ompl::base::SE2StateSpace::getStateMemorySize() const
+{
+    std::size_t components = getStateComponentsMemorySize();
+    return components > 0 ? StatePool::alignSize(sizeof(StateType)) + components : 0;
+}
+
+ompl::base::State *ompl::base::SE2StateSpace::constructStateAt(void *memory) const
+{
+    auto *state = new (memory) StateType();
+    constructStateComponentsAt(state, static_cast<char *>(memory) + StatePool::alignSize(sizeof(StateType)));
+    return state;
+}
+
+void ompl::base::SE2StateSpace::distanceBatch(const State *state, const State *const *states, std::size_t count,
+                                              double *distances) const
+{
+    if (typeid(*this) != typeid(SE2StateSpace))
+    {
+        CompoundStateSpace::distanceBatch(state, states, count, distances);
+        return;
+    }
+    const auto *position = components_[0]->as<RealVectorStateSpace>();
+    const auto *rotation = components_[1]->as<SO2StateSpace>();
+    const auto *cstate = static_cast<const CompoundState *>(state);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto *other = static_cast<const CompoundState *>(states[i]);
+        distances[i] =
+            weights_[0] * position->RealVectorStateSpace::distance(cstate->components[0], other->components[0]) +
+            weights_[1] * rotation->SO2StateSpace::distance(cstate->components[1], other->components[1]);
+    }
+}
+
+unsigned int ompl::base::SE2StateSpace::getPackedValueCount() const
+{
+    return typeid(*this) == typeid(SE2StateSpace) ? getComponentsPackedValueCount() : 0u;
+}
+
 void ompl::base::SE2StateSpace::registerProjections()
 {
     class SE2DefaultProjection : public ProjectionEvaluator
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <typeinfo>
 #include "ompl/tools/config/MagicConstants.h"
 #include <boost/math/constants/constants.hpp>
 
@@ -127,6 +128,52 @@ double ompl::base::SO2StateSpace::distance(const State *state1, const State *sta
     return (d > pi) ? 2.0 * pi - d : d;
 }
 
+void ompl::base::SO2StateSpace::distanceBatch(const State *state, const State *const *states, std::size_t count,
+                                              double *distances) const
+{
+    if (typeid(*this) != typeid(SO2StateSpace))
+    {
+        StateSpace::distanceBatch(state, states, count, distances);
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+        distances[i] = SO2StateSpace::distance(state, states[i]);
+}
+
+unsigned int ompl::base::SO2StateSpace::getPackedValueCount() const
+{
+    return typeid(*this) == typeid(SO2StateSpace) ? 1u : 0u;
+}
+
+void ompl::base::SO2StateSpace::packState(const State *state, double *values, std::size_t /*stride*/) const
+{
+    values[0] = state->as<StateType>()->value;
+}
+
+void ompl::base::SO2StateSpace::accumulatePackedDistances(const State *state, const double *values,
+                                                          std::size_t /*stride*/, std::size_t count, double weight,
+                                                          double *distances) const
+{
+    const double v = state->as<StateType>()->value;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        double d = std::fabs(values[i] - v);
+        distances[i] += weight * ((d > pi) ? 2.0 * pi - d : d);
+    }
+}
+
+double ompl::base::SO2StateSpace::packedDistanceLowerBound(const double *values, const double *low,
+                                                           const double *high) const
+{
+    const double v = values[0];
+    if (v >= low[0] && v <= high[0])
+        return 0.0;
+    // the closest angle in the interval is one of its end points, reached in either direction around the circle
+    double d1 = std::fabs(low[0] - v);
+    double d2 = std::fabs(high[0] - v);
+    return std::min((d1 > pi) ? 2.0 * pi - d1 : d1, (d2 > pi) ? 2.0 * pi - d2 : d2);
+}
+
 bool ompl::base::SO2StateSpace::equalStates(const State *state1, const State *state2) const
 {
     return fabs(state1->as<StateType>()->value - state2->as<StateType>()->value) <
@@ -161,14 +208,33 @@ ompl::base::StateSamplerPtr ompl::base::SO2StateSpace::allocDefaultStateSampler(
 
 ompl::base::State *ompl::base::SO2StateSpace::allocState() const
 {
+    if (State *state = allocPooledState())
+        return state;
     return new StateType();
 }
 
 void ompl::base::SO2StateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     delete static_cast<StateType *>(state);
 }
 
+std::size_t ompl::base::SO2StateSpace::getStateMemorySize() const
+{
+    return sizeof(StateType);
+}
+
+ompl::base::State *ompl::base::SO2StateSpace::constructStateAt(void *memory) const
+{
+    return new (memory) StateType();
+}
+
+void ompl::base::SO2StateSpace::destructStateAt(State *state) const
+{
+    static_cast<StateType *>(state)->~StateType();
+}
+
 void ompl::base::SO2StateSpace::registerProjections()
 {
     class SO2DefaultProjection : public ProjectionEvaluator
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <typeinfo>
 #include "ompl/tools/config/MagicConstants.h"
 #include <boost/math/constants/constants.hpp>
 #include <boost/assert.hpp>
@@ -276,6 +277,63 @@ double ompl::base::SO3StateSpace::distance(const State *state1, const State *sta
     return arcLength(state1, state2);
 }
 
+void ompl::base::SO3StateSpace::distanceBatch(const State *state, const State *const *states, std::size_t count,
+                                              double *distances) const
+{
+    if (typeid(*this) != typeid(SO3StateSpace))
+    {
+        StateSpace::distanceBatch(state, states, count, distances);
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+        distances[i] = arcLength(state, states[i]);
+}
+
+unsigned int ompl::base::SO3StateSpace::getPackedValueCount() const
+{
+    return typeid(*this) == typeid(SO3StateSpace) ? 4u : 0u;
+}
+
+void ompl::base::SO3StateSpace::packState(const State *state, double *values, std::size_t stride) const
+{
+    const auto *qs = static_cast<const StateType *>(state);
+    values[0] = qs->x;
+    values[stride] = qs->y;
+    values[2 * stride] = qs->z;
+    values[3 * stride] = qs->w;
+}
+
+void ompl::base::SO3StateSpace::accumulatePackedDistances(const State *state, const double *values,
+                                                          std::size_t stride, std::size_t count, double weight,
+                                                          double *distances) const
+{
+    const auto *qs = static_cast<const StateType *>(state);
+    const double *x = values, *y = values + stride, *z = values + 2 * stride, *w = values + 3 * stride;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        double dq = std::fabs(qs->x * x[i] + qs->y * y[i] + qs->z * z[i] + qs->w * w[i]);
+        if (dq <= 1.0 - MAX_QUATERNION_NORM_ERROR)
+            distances[i] += weight * acos(dq);
+    }
+}
+
+double ompl::base::SO3StateSpace::packedDistanceLowerBound(const double *values, const double *low,
+                                                           const double *high) const
+{
+    // For unit quaternions q and p at an angle a (in R^4), the chord length |q - p| = 2 sin(a / 2) is at most a,
+    // and likewise |q + p| is at most pi - a. The distance min(a, pi - a) is therefore bounded from below by the
+    // distance from q or -q to the box, minus a small slack for quaternions that are not exactly normalized.
+    double sqPos = 0.0, sqNeg = 0.0;
+    for (unsigned int j = 0; j < 4; ++j)
+    {
+        double gapPos = std::max(std::max(low[j] - values[j], values[j] - high[j]), 0.0);
+        double gapNeg = std::max(std::max(low[j] + values[j], -values[j] - high[j]), 0.0);
+        sqPos += gapPos * gapPos;
+        sqNeg += gapNeg * gapNeg;
+    }
+    return std::max(std::sqrt(std::min(sqPos, sqNeg)) - 2.0 * std::sqrt(MAX_QUATERNION_NORM_ERROR), 0.0);
+}
+
 bool ompl::base::SO3StateSpace::equalStates(const State *state1, const State *state2) const
 {
     return arcLength(state1, state2) < std::numeric_limits<double>::epsilon();
@@ -324,14 +382,33 @@ ompl::base::StateSamplerPtr ompl::base::SO3StateSpace::allocDefaultStateSampler(
 
 ompl::base::State *ompl::base::SO3StateSpace::allocState() const
 {
+    if (State *state = allocPooledState())
+        return state;
     return new StateType();
 }
 
 void ompl::base::SO3StateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     delete static_cast<StateType *>(state);
 }
 
+std::size_t ompl::base::SO3StateSpace::getStateMemorySize() const
+{
+    return sizeof(StateType);
+}
+
+ompl::base::State *ompl::base::SO3StateSpace::constructStateAt(void *memory) const
+{
+    return new (memory) StateType();
+}
+
+void ompl::base::SO3StateSpace::destructStateAt(State *state) const
+{
+    static_cast<StateType *>(state)->~StateType();
+}
+
 void ompl::base::SO3StateSpace::registerProjections()
 {
     class SO3DefaultProjection : public ProjectionEvaluator
@@ -149,14 +149,33 @@ ompl::base::StateSamplerPtr ompl::base::TimeStateSpace::allocDefaultStateSampler
 
 ompl::base::State *ompl::base::TimeStateSpace::allocState() const
 {
+    if (State *state = allocPooledState())
+        return state;
     return new StateType();
 }
 
 void ompl::base::TimeStateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     delete static_cast<StateType *>(state);
 }
 
+std::size_t ompl::base::TimeStateSpace::getStateMemorySize() const
+{
+    return sizeof(StateType);
+}
+
+ompl::base::State *ompl::base::TimeStateSpace::constructStateAt(void *memory) const
+{
+    return new (memory) StateType();
+}
+
+void ompl::base::TimeStateSpace::destructStateAt(State *state) const
+{
+    static_cast<StateType *>(state)->~StateType();
+}
+
 void ompl::base::TimeStateSpace::registerProjections()
 {
     class TimeDefaultProjection : public ProjectionEvaluator
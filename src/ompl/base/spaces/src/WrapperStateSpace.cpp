@@ -53,6 +53,11 @@ void ompl::base::WrapperStateSampler::sampleGaussian(State *state, const State *
                              mean->as<ompl::base::WrapperStateSpace::StateType>()->getState(), stdDev);
 }
 
+void ompl::base::WrapperStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
+
 ompl::base::WrapperProjectionEvaluator::WrapperProjectionEvaluator(const ompl::base::WrapperStateSpace *space)
   : ompl::base::ProjectionEvaluator(space), projection_(space->getSpace()->getDefaultProjection())
 {
@@ -36,6 +36,7 @@
 
 #include "ompl/base/Constraint.h"
 #include "ompl/base/spaces/constraint/ConstrainedStateSpace.h"
+#include <algorithm>
 
 void ompl::base::Constraint::function(const State *state, Eigen::Ref<Eigen::VectorXd> out) const
 {
@@ -90,25 +91,218 @@ bool ompl::base::Constraint::project(State *state) const
     return project(*state->as<ConstrainedStateSpace::StateType>());
 }
 
+namespace
+{
+    /* Temporary storage of the projection routine. The Jacobian is always
+       dynamic, while the vectors and the matrix that is factorized have a fixed
+       size for small co-dimensions K. */
+    template <int K>
+    struct ProjectionWorkspace
+    {
+        using Vector = Eigen::Matrix<double, K, 1>;
+        using Matrix = Eigen::Matrix<double, K, K>;
+
+        void resize(unsigned int k, unsigned int n)
+        {
+            f.resize(k);
+            fPrevious.resize(k);
+            y.resize(k);
+            jjt.resize(k, k);
+            j.resize(k, n);
+            step.resize(n);
+        }
+
+        Vector f;
+        Vector fPrevious;
+        Vector y;
+        Matrix jjt;
+        Eigen::MatrixXd j;
+        Eigen::VectorXd step;
+        Eigen::LDLT<Matrix> ldlt;
+        Eigen::ColPivHouseholderQR<Eigen::Matrix<double, Eigen::Dynamic, K>> qr;
+    };
+
+    /* Source of the identifiers of the projection counters. */
+    std::atomic<std::uint64_t> nextCountersId{0};
+
+    template <typename Counts>
+    void addCounts(ompl::base::Constraint::ProjectionStatistics &statistics, const Counts &counts)
+    {
+        statistics.projections += counts.projections.load(std::memory_order_relaxed);
+        statistics.failures += counts.failures.load(std::memory_order_relaxed);
+        statistics.iterations += counts.iterations.load(std::memory_order_relaxed);
+        statistics.jacobianEvaluations += counts.jacobianEvaluations.load(std::memory_order_relaxed);
+    }
+
+    /* Add to a counter that only the calling thread changes. */
+    void increment(std::atomic<std::uint64_t> &counter, std::uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    template <int K>
+    ProjectionWorkspace<K> &projectionWorkspace(unsigned int k, unsigned int n)
+    {
+        static thread_local ProjectionWorkspace<K> workspace;
+        workspace.resize(k, n);
+        return workspace;
+    }
+}
+
 bool ompl::base::Constraint::project(Eigen::Ref<Eigen::VectorXd> x) const
 {
+    switch (getCoDimension())
+    {
+        case 1:
+            return newtonProject<1>(x);
+        case 2:
+            return newtonProject<2>(x);
+        case 3:
+            return newtonProject<3>(x);
+        default:
+            return newtonProject<Eigen::Dynamic>(x);
+    }
+}
+
+template <int K>
+bool ompl::base::Constraint::newtonProject(Eigen::Ref<Eigen::VectorXd> x) const
+{
+    ProjectionWorkspace<K> &w = projectionWorkspace<K>(getCoDimension(), n_);
+
     // Newton's method
     unsigned int iter = 0;
+    unsigned int iterations = 0;
+    unsigned int jacobians = 0;
     double norm = 0;
-    Eigen::VectorXd f(getCoDimension());
-    Eigen::MatrixXd j(getCoDimension(), n_);
+    bool updateJacobian = false;
 
     const double squaredTolerance = tolerance_ * tolerance_;
 
-    function(x, f);
-    while ((norm = f.squaredNorm()) > squaredTolerance && iter++ < maxIterations_)
+    function(x, w.f);
+    while ((norm = w.f.squaredNorm()) > squaredTolerance && iter++ < maxIterations_)
+    {
+        ++iterations;
+        if (updateJacobian)
+        {
+            // Broyden's update for the last step, which moved x by -step
+            w.y = w.f - w.fPrevious;
+            w.y.noalias() += w.j * w.step;
+            w.j.noalias() -= (w.y / w.step.squaredNorm()) * w.step.transpose();
+        }
+        else
+        {
+            jacobian(x, w.j);
+            ++jacobians;
+        }
+
+        if (solver_ == ProjectionSolver::SVD)
+            w.step = w.j.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(w.f);
+        else if (solver_ == ProjectionSolver::QR)
+        {
+            // Minimum norm step from J^T P = Q R, which is Q R^-T P^T F(x)
+            // restricted to the rank of J
+            w.qr.compute(w.j.transpose());
+            const Eigen::Index rank = w.qr.rank();
+            w.y.noalias() = w.qr.colsPermutation().transpose() * w.f;
+            w.step.setZero();
+            w.step.head(rank) = w.qr.matrixR()
+                                    .topLeftCorner(rank, rank)
+                                    .template triangularView<Eigen::Upper>()
+                                    .transpose()
+                                    .solve(w.y.head(rank));
+            w.qr.householderQ().applyThisOnTheLeft(w.step);
+        }
+        else
+        {
+            // Minimum norm step J^T (J J^T)^-1 F(x)
+            w.jjt.noalias() = w.j * w.j.transpose();
+            w.y = w.ldlt.compute(w.jjt).solve(w.f);
+            w.step.noalias() = w.j.transpose() * w.y;
+        }
+
+        x -= w.step;
+        w.fPrevious = w.f;
+        function(x, w.f);
+
+        // Keep updating the Jacobian as long as each step at least halves the distance to the manifold
+        updateJacobian = solver_ == ProjectionSolver::BROYDEN && w.f.squaredNorm() < 0.25 * norm;
+    }
+
+    const bool projected = norm < squaredTolerance;
+    ProjectionCounters::ThreadCounts &counts = threadCounts();
+    increment(counts.projections, 1);
+    increment(counts.iterations, iterations);
+    increment(counts.jacobianEvaluations, jacobians);
+    if (!projected)
+        increment(counts.failures, 1);
+    return projected;
+}
+
+ompl::base::Constraint::ProjectionCounters::ProjectionCounters() : id(nextCountersId++)
+{
+}
+
+ompl::base::Constraint::ProjectionCounters::ProjectionCounters(const ProjectionCounters &) : ProjectionCounters()
+{
+}
+
+ompl::base::Constraint::ProjectionCounters::ThreadCounts &ompl::base::Constraint::threadCounts() const
+{
+    // The counts of this thread for each constraint it projected with, by the
+    // identifier of the counters. Most threads project with few constraints.
+    static thread_local std::vector<std::pair<std::uint64_t, std::shared_ptr<ProjectionCounters::ThreadCounts>>>
+        cache;
+
+    for (const auto &entry : cache)
+        if (entry.first == counters_.id)
+            return *entry.second;
+
+    // Forget the counts of destroyed constraints, which only this thread still holds
+    cache.erase(std::remove_if(cache.begin(), cache.end(),
+                               [](const decltype(cache)::value_type &entry) { return entry.second.use_count() == 1; }),
+                cache.end());
+
+    auto counts = std::make_shared<ProjectionCounters::ThreadCounts>();
     {
-        jacobian(x, j);
-        x -= j.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(f);
-        function(x, f);
+        std::lock_guard<std::mutex> lock(counters_.lock);
+        counters_.threads.push_back(counts);
     }
+    cache.emplace_back(counters_.id, counts);
+    return *counts;
+}
+
+ompl::base::Constraint::ProjectionStatistics ompl::base::Constraint::getProjectionStatistics() const
+{
+    std::lock_guard<std::mutex> lock(counters_.lock);
+
+    // Fold in the counts of threads that exited, which will not change anymore
+    auto done = std::partition(counters_.threads.begin(), counters_.threads.end(),
+                               [](const std::shared_ptr<ProjectionCounters::ThreadCounts> &counts)
+                               { return counts.use_count() > 1; });
+    for (auto it = done; it != counters_.threads.end(); ++it)
+        addCounts(counters_.folded, **it);
+    counters_.threads.erase(done, counters_.threads.end());
+
+    ProjectionStatistics statistics = counters_.folded;
+    for (const auto &counts : counters_.threads)
+        addCounts(statistics, *counts);
 
-    return norm < squaredTolerance;
+    statistics.projections -= counters_.cleared.projections;
+    statistics.failures -= counters_.cleared.failures;
+    statistics.iterations -= counters_.cleared.iterations;
+    statistics.jacobianEvaluations -= counters_.cleared.jacobianEvaluations;
+    return statistics;
+}
+
+void ompl::base::Constraint::clearProjectionStatistics()
+{
+    // The counts of each thread only grow, so remember where they were
+    ProjectionStatistics current;
+    std::lock_guard<std::mutex> lock(counters_.lock);
+    current = counters_.folded;
+    for (const auto &counts : counters_.threads)
+        addCounts(current, *counts);
+    counters_.cleared = current;
 }
 
 double ompl::base::Constraint::distance(const State *state) const
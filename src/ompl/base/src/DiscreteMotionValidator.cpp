@@ -36,6 +36,7 @@
 
 #include "ompl/base/DiscreteMotionValidator.h"
 #include "ompl/util/Exception.h"
+#include <algorithm>
 #include <queue>
 
 void ompl::base::DiscreteMotionValidator::defaultSettings()
@@ -45,6 +46,86 @@ void ompl::base::DiscreteMotionValidator::defaultSettings()
         throw Exception("No state space for motion validator");
 }
 
+ompl::base::DiscreteMotionValidator::~DiscreteMotionValidator() = default;
+
+void ompl::base::DiscreteMotionValidator::setBatchSize(unsigned int batchSize)
+{
+    std::lock_guard<std::mutex> lock(workspaceLock_);
+    batchSize_ = batchSize;
+    workspace_.reset();
+}
+
+ompl::base::DiscreteMotionValidator::BatchWorkspace::BatchWorkspace(const StateSpacePtr &space,
+                                                                    unsigned int batchSize)
+  : space(space), states(batchSize), valid(new bool[batchSize])
+{
+    for (auto &state : states)
+        state = space->allocState();
+}
+
+ompl::base::DiscreteMotionValidator::BatchWorkspace::~BatchWorkspace()
+{
+    for (auto &state : states)
+        space->freeState(state);
+}
+
+void ompl::base::DiscreteMotionValidator::BatchWorkspace::computeBisectionOrder(int nd)
+{
+    if (orderSegments == nd)
+        return;
+    order.clear();
+    if (nd >= 2)
+    {
+        order.reserve(nd - 1);
+        std::queue<std::pair<int, int>> pos;
+        pos.emplace(1, nd - 1);
+        while (!pos.empty())
+        {
+            std::pair<int, int> x = pos.front();
+            pos.pop();
+            int mid = (x.first + x.second) / 2;
+            order.push_back(mid);
+            if (x.first < mid)
+                pos.emplace(x.first, mid - 1);
+            if (x.second > mid)
+                pos.emplace(mid + 1, x.second);
+        }
+    }
+    orderSegments = nd;
+}
+
+bool ompl::base::DiscreteMotionValidator::checkMotionBatch(const State *s1, const State *s2, int nd,
+                                                           BatchWorkspace &ws) const
+{
+    ws.computeBisectionOrder(nd);
+    const std::size_t total = ws.order.size();
+    for (std::size_t start = 0; start < total; start += ws.states.size())
+    {
+        std::size_t n = std::min(ws.states.size(), total - start);
+        for (std::size_t i = 0; i < n; ++i)
+            stateSpace_->interpolate(s1, s2, (double)ws.order[start + i] / (double)nd, ws.states[i]);
+        if (!si_->isValidBatch(ws.states.data(), n, ws.valid.get()))
+            return false;
+    }
+    return true;
+}
+
+int ompl::base::DiscreteMotionValidator::findFirstInvalidBatch(const State *s1, const State *s2, int nd,
+                                                               BatchWorkspace &ws) const
+{
+    for (int start = 1; start < nd; start += ws.states.size())
+    {
+        int n = std::min((int)ws.states.size(), nd - start);
+        for (int i = 0; i < n; ++i)
+            stateSpace_->interpolate(s1, s2, (double)(start + i) / (double)nd, ws.states[i]);
+        if (!si_->isValidBatch(ws.states.data(), n, ws.valid.get()))
+            for (int i = 0; i < n; ++i)
+                if (!ws.valid[i])
+                    return start + i;
+    }
+    return nd;
+}
+
 bool ompl::base::DiscreteMotionValidator::checkMotion(const State *s1, const State *s2,
                                                       std::pair<State *, double> &lastValid) const
 {
@@ -53,7 +134,18 @@ bool ompl::base::DiscreteMotionValidator::checkMotion(const State *s1, const Sta
     bool result = true;
     int nd = stateSpace_->validSegmentCount(s1, s2);
 
-    if (nd > 1)
+    if (nd > 1 && batchSize_ > 1)
+    {
+        int j = withWorkspace([&](BatchWorkspace &ws) { return findFirstInvalidBatch(s1, s2, nd, ws); });
+        if (j < nd)
+        {
+            lastValid.second = (double)(j - 1) / (double)nd;
+            if (lastValid.first != nullptr)
+                stateSpace_->interpolate(s1, s2, lastValid.second, lastValid.first);
+            result = false;
+        }
+    }
+    else if (nd > 1)
     {
         /* temporary storage for the checked state */
         State *test = si_->allocState();
@@ -83,9 +175,9 @@ bool ompl::base::DiscreteMotionValidator::checkMotion(const State *s1, const Sta
         }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
@@ -95,17 +187,19 @@ bool ompl::base::DiscreteMotionValidator::checkMotion(const State *s1, const Sta
     /* assume motion starts in a valid configuration so s1 is valid */
     if (!si_->isValid(s2))
     {
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
 
     bool result = true;
     int nd = stateSpace_->validSegmentCount(s1, s2);
 
-    /* initialize the queue of test positions */
-    std::queue<std::pair<int, int>> pos;
-    if (nd >= 2)
+    if (nd >= 2 && batchSize_ > 1)
+        result = withWorkspace([&](BatchWorkspace &ws) { return checkMotionBatch(s1, s2, nd, ws); });
+    else if (nd >= 2)
     {
+        /* initialize the queue of test positions */
+        std::queue<std::pair<int, int>> pos;
         pos.emplace(1, nd - 1);
 
         /* temporary storage for the checked state */
@@ -137,9 +231,9 @@ bool ompl::base::DiscreteMotionValidator::checkMotion(const State *s1, const Sta
     }
 
     if (result)
-        valid_++;
+        valid_.fetch_add(1, std::memory_order_relaxed);
     else
-        invalid_++;
+        invalid_.fetch_add(1, std::memory_order_relaxed);
 
     return result;
 }
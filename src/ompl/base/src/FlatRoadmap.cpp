@@ -0,0 +1,285 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#include "ompl/base/FlatRoadmap.h"
+#include "ompl/base/SpaceInformation.h"
+#include "ompl/util/Exception.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace
+{
+    // the first bytes of every roadmap file
+    const char FLAT_ROADMAP_MARKER[8] = {'O', 'M', 'P', 'L', 'R', 'M', 'A', 'P'};
+
+    // written in the byte order of the machine that stores the roadmap
+    const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    enum VertexType : std::uint8_t
+    {
+        STANDARD_VERTEX = 0,
+        START_VERTEX = 1,
+        GOAL_VERTEX = 2
+    };
+
+    struct FileHeader
+    {
+        char marker[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t vertexCount;
+        std::uint64_t edgeCount;
+        std::uint64_t stateLength;
+        std::uint64_t signatureLength;
+    };
+
+    // byte offsets of the sections of a roadmap file; each section starts at a multiple of 8 bytes
+    struct Layout
+    {
+        std::size_t signature;
+        std::size_t types;
+        std::size_t tags;
+        std::size_t states;
+        std::size_t offsets;
+        std::size_t targets;
+        std::size_t weights;
+        std::size_t size;
+    };
+
+    std::size_t align(std::size_t offset)
+    {
+        return (offset + 7) & ~static_cast<std::size_t>(7);
+    }
+
+    Layout computeLayout(const FileHeader &h)
+    {
+        Layout l;
+        l.signature = align(sizeof(FileHeader));
+        l.types = align(l.signature + h.signatureLength * sizeof(std::int32_t));
+        l.tags = align(l.types + h.vertexCount * sizeof(std::uint8_t));
+        l.states = align(l.tags + h.vertexCount * sizeof(std::int32_t));
+        l.offsets = align(l.states + h.vertexCount * h.stateLength);
+        l.targets = align(l.offsets + (h.vertexCount + 1) * sizeof(std::uint64_t));
+        l.weights = align(l.targets + h.edgeCount * sizeof(std::uint32_t));
+        l.size = l.weights + h.edgeCount * sizeof(double);
+        return l;
+    }
+
+    // write the padding up to offset, followed by the given bytes
+    void writeSection(std::ofstream &out, std::size_t offset, const void *data, std::size_t bytes)
+    {
+        static const char zeros[8] = {0};
+        auto position = static_cast<std::size_t>(out.tellp());
+        if (offset > position)
+            out.write(zeros, offset - position);
+        out.write(static_cast<const char *>(data), bytes);
+    }
+}
+
+/// @cond IGNORE
+struct ompl::base::FlatRoadmap::Mapping
+{
+    Mapping(const std::string &filename)
+      : file(filename.c_str(), boost::interprocess::read_only), region(file, boost::interprocess::read_only)
+    {
+    }
+
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+};
+/// @endcond
+
+const std::uint32_t ompl::base::FlatRoadmap::FORMAT_VERSION = 1;
+
+ompl::base::FlatRoadmap::FlatRoadmap(StateSpacePtr space, const std::string &filename) : space_(std::move(space))
+{
+    try
+    {
+        mapping_ = std::make_unique<Mapping>(filename);
+    }
+    catch (boost::interprocess::interprocess_exception &e)
+    {
+        throw Exception("FlatRoadmap", "Unable to map '" + filename + "': " + e.what());
+    }
+
+    const auto *data = static_cast<const unsigned char *>(mapping_->region.get_address());
+    const std::size_t size = mapping_->region.get_size();
+    FileHeader h;
+    if (size < sizeof(FileHeader))
+        throw Exception("FlatRoadmap", "'" + filename + "' is too short to be a roadmap");
+    std::memcpy(&h, data, sizeof(FileHeader));
+    if (std::memcmp(h.marker, FLAT_ROADMAP_MARKER, sizeof(h.marker)) != 0)
+        throw Exception("FlatRoadmap", "'" + filename + "' is not a roadmap file");
+    if (h.byteOrder != BYTE_ORDER_MARK)
+        throw Exception("FlatRoadmap", "'" + filename + "' was written on a machine with a different byte order");
+    if (h.version != FORMAT_VERSION)
+        throw Exception("FlatRoadmap", "'" + filename + "' uses unsupported format version " +
+                                           std::to_string(h.version));
+    if (h.stateLength != space_->getSerializationLength())
+        throw Exception("FlatRoadmap", "State space signature mismatch for '" + filename + "'");
+
+    // reject sizes for which the layout computation could overflow before comparing with the file size
+    if (h.vertexCount > size || h.edgeCount > size || h.signatureLength > size ||
+        (h.vertexCount > 0 && h.stateLength > size / h.vertexCount))
+        throw Exception("FlatRoadmap", "'" + filename + "' is truncated or corrupt");
+    const Layout layout = computeLayout(h);
+    if (layout.size > size)
+        throw Exception("FlatRoadmap", "'" + filename + "' is truncated or corrupt");
+
+    std::vector<int> signature;
+    space_->computeSignature(signature);
+    const auto *storedSignature = reinterpret_cast<const std::int32_t *>(data + layout.signature);
+    if (signature.size() != h.signatureLength ||
+        !std::equal(signature.begin(), signature.end(), storedSignature))
+        throw Exception("FlatRoadmap", "State space signature mismatch for '" + filename + "'");
+
+    vertexCount_ = h.vertexCount;
+    edgeCount_ = h.edgeCount;
+    stateLength_ = h.stateLength;
+    types_ = data + layout.types;
+    tags_ = reinterpret_cast<const std::int32_t *>(data + layout.tags);
+    states_ = data + layout.states;
+    offsets_ = reinterpret_cast<const std::uint64_t *>(data + layout.offsets);
+    targets_ = reinterpret_cast<const std::uint32_t *>(data + layout.targets);
+    weights_ = reinterpret_cast<const double *>(data + layout.weights);
+    if (offsets_[0] != 0 || offsets_[vertexCount_] != edgeCount_)
+        throw Exception("FlatRoadmap", "'" + filename + "' is truncated or corrupt");
+
+    // the queries index the edge arrays with the offsets and the vertex arrays with the targets, and
+    // edgeExists() relies on the targets of each vertex being sorted
+    for (std::size_t i = 0; i < vertexCount_; ++i)
+    {
+        if (offsets_[i] > offsets_[i + 1])
+            throw Exception("FlatRoadmap", "'" + filename + "' has invalid edge offsets");
+        for (std::uint64_t k = offsets_[i]; k < offsets_[i + 1]; ++k)
+            if (targets_[k] >= vertexCount_ || (k > offsets_[i] && targets_[k - 1] >= targets_[k]))
+                throw Exception("FlatRoadmap", "'" + filename + "' has invalid edge targets");
+    }
+}
+
+ompl::base::FlatRoadmap::~FlatRoadmap() = default;
+
+void ompl::base::FlatRoadmap::store(const PlannerData &pd, const std::string &filename)
+{
+    const SpaceInformationPtr &si = pd.getSpaceInformation();
+    if (!si)
+        throw Exception("FlatRoadmap", "Unable to store a roadmap without SpaceInformation");
+    const StateSpacePtr &space = si->getStateSpace();
+    if (pd.numVertices() > std::numeric_limits<std::uint32_t>::max())
+        throw Exception("FlatRoadmap", "Too many vertices to store a roadmap");
+
+    std::vector<int> signature;
+    space->computeSignature(signature);
+    std::vector<std::int32_t> storedSignature(signature.begin(), signature.end());
+
+    const std::size_t n = pd.numVertices();
+    std::vector<std::uint8_t> types(n, STANDARD_VERTEX);
+    std::vector<std::int32_t> tags(n);
+    std::vector<std::uint64_t> offsets(n + 1, 0);
+    std::vector<std::uint32_t> targets;
+    std::vector<double> weights;
+    std::vector<unsigned int> edges;
+    targets.reserve(pd.numEdges());
+    weights.reserve(pd.numEdges());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (pd.isStartVertex(i))
+            types[i] = START_VERTEX;
+        else if (pd.isGoalVertex(i))
+            types[i] = GOAL_VERTEX;
+        tags[i] = pd.getVertex(i).getTag();
+
+        pd.getEdges(i, edges);
+        std::sort(edges.begin(), edges.end());
+        for (unsigned int j : edges)
+        {
+            Cost weight;
+            pd.getEdgeWeight(i, j, &weight);
+            targets.push_back(j);
+            weights.push_back(weight.value());
+        }
+        offsets[i + 1] = targets.size();
+    }
+
+    FileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.marker, FLAT_ROADMAP_MARKER, sizeof(h.marker));
+    h.version = FORMAT_VERSION;
+    h.byteOrder = BYTE_ORDER_MARK;
+    h.vertexCount = n;
+    h.edgeCount = targets.size();
+    h.stateLength = space->getSerializationLength();
+    h.signatureLength = storedSignature.size();
+    const Layout layout = computeLayout(h);
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.good())
+        throw Exception("FlatRoadmap", "Unable to open '" + filename + "' for writing");
+    writeSection(out, 0, &h, sizeof(h));
+    writeSection(out, layout.signature, storedSignature.data(), storedSignature.size() * sizeof(std::int32_t));
+    writeSection(out, layout.types, types.data(), n * sizeof(std::uint8_t));
+    writeSection(out, layout.tags, tags.data(), n * sizeof(std::int32_t));
+    std::vector<unsigned char> state(h.stateLength);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        space->serialize(state.data(), pd.getVertex(i).getState());
+        writeSection(out, layout.states + i * h.stateLength, state.data(), state.size());
+    }
+    writeSection(out, layout.offsets, offsets.data(), offsets.size() * sizeof(std::uint64_t));
+    writeSection(out, layout.targets, targets.data(), targets.size() * sizeof(std::uint32_t));
+    writeSection(out, layout.weights, weights.data(), weights.size() * sizeof(double));
+    if (!out.good())
+        throw Exception("FlatRoadmap", "Failed to write '" + filename + "'");
+}
+
+bool ompl::base::FlatRoadmap::isStartVertex(std::size_t index) const
+{
+    return types_[index] == START_VERTEX;
+}
+
+bool ompl::base::FlatRoadmap::isGoalVertex(std::size_t index) const
+{
+    return types_[index] == GOAL_VERTEX;
+}
+
+bool ompl::base::FlatRoadmap::edgeExists(std::size_t from, std::size_t to) const
+{
+    const std::uint32_t *neighbors = getNeighbors(from);
+    return std::binary_search(neighbors, neighbors + getNeighborCount(from), static_cast<std::uint32_t>(to));
+}
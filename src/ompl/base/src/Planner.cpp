@@ -38,7 +38,6 @@
 #include "ompl/util/Exception.h"
 #include "ompl/base/goals/GoalSampleableRegion.h"
 #include <sstream>
-#include <thread>
 #include <utility>
 
 ompl::base::Planner::Planner(SpaceInformationPtr si, std::string name)
@@ -119,6 +118,7 @@ void ompl::base::Planner::clear()
 {
     pis_.clear();
     pis_.update();
+    si_->getStateSpace()->releaseStatePool();
 }
 
 void ompl::base::Planner::clearQuery()
@@ -335,8 +335,7 @@ const ompl::base::State *ompl::base::PlannerInputStates::nextGoal(const PlannerT
                         OMPL_DEBUG("%s: Waiting for goal region samples ...",
                                    planner_ ? planner_->getName().c_str() : "PlannerInputStates");
                     }
-                    std::this_thread::sleep_for(time::seconds(0.01));
-                    attempt = !ptc;
+                    attempt = !ptc.waitFor(0.01);
                 }
             }
         }
@@ -36,8 +36,18 @@
 
 #include "ompl/base/PlannerTerminationCondition.h"
 #include "ompl/util/Time.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <utility>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 namespace ompl
 {
@@ -47,112 +57,267 @@ namespace ompl
         class PlannerTerminationCondition::PlannerTerminationConditionImpl
         {
         public:
+            /** \brief The monotonic clock used for deadlines and periodic evaluations */
+            using Clock = std::chrono::steady_clock;
+
+            class Timer;
+
             PlannerTerminationConditionImpl(PlannerTerminationConditionFn fn, double period)
-              : fn_(std::move(fn))
-              , period_(period)
-              , terminate_(false)
-              , thread_(nullptr)
-              , evalValue_(false)
-              , signalThreadStop_(false)
+              : fn_(std::move(fn)), period_(period), timed_(period > 0.0)
             {
-                if (period_ > 0.0)
-                    startEvalThread();
             }
 
-            ~PlannerTerminationConditionImpl()
+            explicit PlannerTerminationConditionImpl(time::duration duration)
+              : deadline_(Clock::now() + std::chrono::duration_cast<Clock::duration>(duration)), timed_(true)
             {
-                stopEvalThread();
             }
 
+            ~PlannerTerminationConditionImpl();
+
+            /** \brief Start the evaluation thread of a periodic condition, or register a deadline with the timer */
+            static void start(const std::shared_ptr<PlannerTerminationConditionImpl> &impl);
+
             bool eval() const
             {
-                if (terminate_)
+                if (terminate_.load(std::memory_order_relaxed))
                     return true;
-                if (period_ > 0.0)
-                    return evalValue_;
+                if (timed_)
+                    return evalValue_.load(std::memory_order_relaxed);
                 return fn_();
             }
 
             void terminate() const
             {
-                // it is ok to have unprotected write here
                 terminate_ = true;
+                notify();
+            }
+
+            bool waitFor(double seconds) const
+            {
+                {
+                    std::unique_lock<std::mutex> slock(waitLock_);
+                    waitCondition_.wait_for(slock, std::chrono::duration<double>(seconds),
+                                            [this] { return terminate_ || (timed_ && evalValue_); });
+                }
+                return eval();
             }
 
         private:
-            /** \brief Start the thread evaluating termination conditions if not already started */
-            void startEvalThread()
+            /** \brief Called by the timer when the deadline has passed */
+            void onTimer()
             {
-                if (thread_ == nullptr)
+                if (terminate_)
+                    return;
+                evalValue_ = true;
+                notify();
+            }
+
+            /** \brief Body of the thread of a periodic condition: call fn_() every period_ seconds until the
+                condition is terminated or destroyed */
+            void periodicEval()
+            {
+                const std::chrono::duration<double> period(period_);
+                std::unique_lock<std::mutex> slock(waitLock_);
+                while (!terminate_ && !stopThread_)
                 {
-                    signalThreadStop_ = false;
-                    evalValue_ = false;
-                    thread_ = new std::thread([this]
-                                              {
-                                                  periodicEval();
-                                              });
+                    // The user function may be slow, so it is called without holding the lock
+                    slock.unlock();
+                    const bool value = fn_();
+                    slock.lock();
+                    evalValue_ = value;
+                    if (value)
+                        waitCondition_.notify_all();
+                    waitCondition_.wait_for(slock, period, [this] { return terminate_ || stopThread_; });
                 }
             }
 
-            /** \brief Stop the thread evaluating termination conditions if not already stopped */
-            void stopEvalThread()
+            /** \brief Wake up the threads waiting in waitFor() */
+            void notify() const
+            {
+                std::lock_guard<std::mutex> slock(waitLock_);
+                waitCondition_.notify_all();
+            }
+
+            /** \brief Function pointer to the piece of code that decides whether a termination condition has been met
+             */
+            PlannerTerminationConditionFn fn_;
+
+            /** \brief Interval of time (seconds) to wait between calls to fn_() */
+            double period_{-1.0};
+
+            /** \brief The time at which a condition without fn_ becomes true */
+            Clock::time_point deadline_;
+
+            /** \brief Whether eval() returns the value computed by the timer instead of calling fn_() */
+            const bool timed_;
+
+            /** \brief Flag indicating whether the user has externally requested that the condition for termination
+             * should become true */
+            mutable std::atomic<bool> terminate_{false};
+
+            /** \brief Value computed by the timer */
+            std::atomic<bool> evalValue_{false};
+
+            /** \brief The id of the pending timer event, 0 if there is none. Protected by the timer's lock. */
+            std::uint64_t timerId_{0};
+
+            /** \brief The thread evaluating a periodic condition */
+            std::thread thread_;
+
+            /** \brief Whether the thread evaluating a periodic condition should exit. Protected by waitLock_. */
+            bool stopThread_{false};
+
+            mutable std::mutex waitLock_;
+            mutable std::condition_variable waitCondition_;
+        };
+
+        /** \brief A single thread that expires the deadlines of all termination conditions in the process. It
+            sleeps until the earliest pending deadline, and is started when the first deadline is scheduled (again
+            after a fork()). It never runs user code: periodically evaluated conditions call their function on a
+            thread of their own, so a slow function cannot delay the deadlines or the other conditions. */
+        class PlannerTerminationCondition::PlannerTerminationConditionImpl::Timer
+        {
+        public:
+            /** \brief The process-wide instance. It is never destroyed, so conditions may outlive static
+                destruction. */
+            static Timer &instance()
+            {
+                static auto *timer = new Timer();
+                return *timer;
+            }
+
+            void schedule(const std::shared_ptr<PlannerTerminationConditionImpl> &impl, Clock::time_point when)
+            {
+                std::lock_guard<std::mutex> slock(lock_);
+                scheduleLocked(impl, when);
+            }
+
+            void cancel(PlannerTerminationConditionImpl *impl)
             {
-                signalThreadStop_ = true;
-                if (thread_ != nullptr)
+                std::lock_guard<std::mutex> slock(lock_);
+                auto event = events_.find(impl->timerId_);
+                if (event != events_.end())
                 {
-                    thread_->join();
-                    delete thread_;
-                    thread_ = nullptr;
+                    queue_.erase(std::make_pair(event->second.first, event->first));
+                    events_.erase(event);
                 }
+                impl->timerId_ = 0;
             }
 
-            /** \brief Worker function that runs in a separate thread (calls computeEval())*/
-            void periodicEval()
+        private:
+            Timer() : wakeUp_(new std::condition_variable())
+            {
+#ifndef _WIN32
+                pthread_atfork([] { instance().lock_.lock(); }, [] { instance().lock_.unlock(); },
+                               [] { instance().afterFork(); });
+#endif
+            }
+
+            /** \brief Called in the child process after fork(), where the timer thread does not exist */
+            void afterFork()
             {
-                // we want to check for termination at least once every ms;
-                // even though we may evaluate the condition itself more rarely
+                running_ = false;
+                // The condition variable may still count the vanished thread as a waiter, so use a new one. The old
+                // one cannot be destroyed safely and is leaked.
+                wakeUp_.release();
+                wakeUp_.reset(new std::condition_variable());
+                lock_.unlock();
+            }
 
-                unsigned int count = 1;
-                time::duration s = time::seconds(period_);
-                if (period_ > 0.001)
+            void scheduleLocked(const std::shared_ptr<PlannerTerminationConditionImpl> &impl, Clock::time_point when)
+            {
+                const std::uint64_t id = ++lastId_;
+                impl->timerId_ = id;
+                events_.emplace(id, std::make_pair(when, impl));
+                const bool earliest = queue_.empty() || when < queue_.begin()->first;
+                queue_.emplace(when, id);
+                if (!running_)
                 {
-                    count = 0.5 + period_ / 0.001;
-                    s = time::seconds(period_ / (double)count);
+                    running_ = true;
+                    std::thread([this] { run(); }).detach();
                 }
+                else if (earliest)
+                    wakeUp_->notify_one();
+            }
 
-                while (!terminate_ && !signalThreadStop_)
+            void run()
+            {
+                std::unique_lock<std::mutex> slock(lock_);
+                while (true)
                 {
-                    evalValue_ = fn_();
-                    for (unsigned int i = 0; i < count; ++i)
+                    if (queue_.empty())
+                    {
+                        wakeUp_->wait(slock);
+                        continue;
+                    }
+                    const auto first = *queue_.begin();
+                    if (Clock::now() < first.first)
                     {
-                        if (terminate_ || signalThreadStop_)
-                            break;
-                        std::this_thread::sleep_for(s);
+                        wakeUp_->wait_until(slock, first.first);
+                        continue;
                     }
+                    queue_.erase(queue_.begin());
+                    auto event = events_.find(first.second);
+                    std::shared_ptr<PlannerTerminationConditionImpl> impl = event->second.second.lock();
+                    events_.erase(event);
+                    if (!impl)
+                        continue;
+                    impl->timerId_ = 0;
+
+                    // The condition may be destroyed here; its destructor takes the lock to cancel its event
+                    slock.unlock();
+                    impl->onTimer();
+                    impl.reset();
+                    slock.lock();
                 }
             }
 
-            /** \brief Function pointer to the piece of code that decides whether a termination condition has been met
-             */
-            PlannerTerminationConditionFn fn_;
-
-            /** \brief Interval of time (seconds) to wait between calls to computeEval() */
-            double period_;
+            std::mutex lock_;
+            std::unique_ptr<std::condition_variable> wakeUp_;
 
-            /** \brief Flag indicating whether the user has externally requested that the condition for termination
-             * should become true */
-            mutable bool terminate_;
+            /** \brief Whether the timer thread has been started in this process */
+            bool running_{false};
 
-            /** \brief Thread for periodicEval() */
-            std::thread *thread_;
+            /** \brief Pending deadlines, ordered by time */
+            std::set<std::pair<Clock::time_point, std::uint64_t>> queue_;
 
-            /** \brief Cached value returned by fn_() */
-            bool evalValue_;
+            /** \brief The time and condition of each pending deadline */
+            std::map<std::uint64_t, std::pair<Clock::time_point, std::weak_ptr<PlannerTerminationConditionImpl>>>
+                events_;
 
-            /** \brief Flag used to signal the condition evaluation thread to stop. */
-            bool signalThreadStop_;
+            std::uint64_t lastId_{0};
         };
 
+        PlannerTerminationCondition::PlannerTerminationConditionImpl::~PlannerTerminationConditionImpl()
+        {
+            if (thread_.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> slock(waitLock_);
+                    stopThread_ = true;
+                    waitCondition_.notify_all();
+                }
+                thread_.join();
+            }
+            else if (timed_)
+                Timer::instance().cancel(this);
+        }
+
+        void PlannerTerminationCondition::PlannerTerminationConditionImpl::start(
+            const std::shared_ptr<PlannerTerminationConditionImpl> &impl)
+        {
+            if (!impl->timed_)
+                return;
+            // Conditions with a function are evaluated right away, and then every period_ seconds
+            if (impl->fn_)
+            {
+                PlannerTerminationConditionImpl *self = impl.get();
+                impl->thread_ = std::thread([self] { self->periodicEval(); });
+            }
+            else
+                Timer::instance().schedule(impl, impl->deadline_);
+        }
+
         /// @endcond
     }
 }
@@ -166,6 +331,13 @@ ompl::base::PlannerTerminationCondition::PlannerTerminationCondition(const Plann
                                                                      double period)
   : impl_(std::make_shared<PlannerTerminationConditionImpl>(fn, period))
 {
+    PlannerTerminationConditionImpl::start(impl_);
+}
+
+ompl::base::PlannerTerminationCondition::PlannerTerminationCondition(time::duration duration)
+  : impl_(std::make_shared<PlannerTerminationConditionImpl>(duration))
+{
+    PlannerTerminationConditionImpl::start(impl_);
 }
 
 void ompl::base::PlannerTerminationCondition::terminate() const
@@ -178,6 +350,11 @@ bool ompl::base::PlannerTerminationCondition::eval() const
     return impl_->eval();
 }
 
+bool ompl::base::PlannerTerminationCondition::waitFor(double seconds) const
+{
+    return impl_->waitFor(seconds);
+}
+
 ompl::base::PlannerTerminationCondition ompl::base::plannerNonTerminatingCondition()
 {
     return PlannerTerminationCondition([]
@@ -219,23 +396,13 @@ ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondi
 
 ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(time::duration duration)
 {
-    const time::point endTime(time::now() + duration);
-    return PlannerTerminationCondition([endTime]
-                                       {
-                                           return time::now() > endTime;
-                                       });
+    return PlannerTerminationCondition(duration);
 }
 
-ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(double duration, double interval)
+ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(double duration, double /*interval*/)
 {
-    if (interval > duration)
-        interval = duration;
-    const time::point endTime(time::now() + time::seconds(duration));
-    return PlannerTerminationCondition([endTime]
-                                       {
-                                           return time::now() > endTime;
-                                       },
-                                       interval);
+    // The shared timer expires the deadline as soon as it passes, so there is no need to poll every interval
+    return timedPlannerTerminationCondition(time::seconds(duration));
 }
 
 ompl::base::PlannerTerminationCondition
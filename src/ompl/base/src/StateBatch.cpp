@@ -0,0 +1,87 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#include "ompl/base/StateBatch.h"
+#include "ompl/base/StateSpace.h"
+#include <algorithm>
+
+ompl::base::StateBatch::StateBatch(const StateSpace *space, bool pack)
+  : space_(space), valueCount_(pack ? space->getPackedValueCount() : 0u)
+{
+}
+
+ompl::base::StateBatch::StateBatch(const StateSpacePtr &space, bool pack) : StateBatch(space.get(), pack)
+{
+}
+
+void ompl::base::StateBatch::add(const State *state)
+{
+    if (valueCount_ > 0)
+    {
+        if (states_.size() == stride_)
+            setStride(std::max<std::size_t>(16, 2 * stride_));
+        space_->packState(state, values_.data() + states_.size(), stride_);
+    }
+    states_.push_back(state);
+}
+
+void ompl::base::StateBatch::add(const State *const *states, std::size_t count)
+{
+    reserve(states_.size() + count);
+    for (std::size_t i = 0; i < count; ++i)
+        add(states[i]);
+}
+
+void ompl::base::StateBatch::reserve(std::size_t capacity)
+{
+    states_.reserve(capacity);
+    if (valueCount_ > 0 && capacity > stride_)
+        setStride(capacity);
+}
+
+void ompl::base::StateBatch::clear()
+{
+    states_.clear();
+}
+
+void ompl::base::StateBatch::setStride(std::size_t stride)
+{
+    std::vector<double> values(stride * valueCount_);
+    const std::size_t n = states_.size();
+    for (unsigned int j = 0; j < valueCount_; ++j)
+        std::copy(values_.begin() + j * stride_, values_.begin() + j * stride_ + n, values.begin() + j * stride);
+    values_.swap(values);
+    stride_ = stride;
+}
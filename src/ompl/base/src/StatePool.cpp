@@ -0,0 +1,293 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#include "ompl/base/StatePool.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+namespace
+{
+    /** \brief Upper bound on the number of blocks allocated in one slab */
+    const std::size_t MAX_SLAB_BLOCK_COUNT = 65536;
+
+    /** \brief The number of blocks moved at once between a shard and the shared free list */
+    const std::size_t BATCH_SIZE = 32;
+
+    /** \brief Slabs are made of chunks of 2^CHUNK_BITS bytes, aligned to their size */
+    const unsigned int CHUNK_BITS = 16;
+    const std::size_t CHUNK_SIZE = std::size_t(1) << CHUNK_BITS;
+
+    /** \brief The chunk map has two levels of 2^LEVEL_BITS entries */
+    const unsigned int LEVEL_BITS = 16;
+    const std::uintptr_t LEVEL_SIZE = std::uintptr_t(1) << LEVEL_BITS;
+
+    /** \brief The pool that owns each chunk of memory, indexed by the address of the chunk. The map covers
+        2^(CHUNK_BITS + 2 LEVEL_BITS) bytes of address space; the lower level is allocated as needed. The
+        map is shared by all pools and never freed, so that pools can be destroyed at any time. */
+    class ChunkMap
+    {
+    public:
+        struct Leaf
+        {
+            std::atomic<const ompl::base::StatePool *> owners[LEVEL_SIZE];
+        };
+
+        const ompl::base::StatePool *owner(const void *address) const
+        {
+            const std::uintptr_t chunk = reinterpret_cast<std::uintptr_t>(address) >> CHUNK_BITS;
+            if ((chunk >> LEVEL_BITS) >= LEVEL_SIZE)
+                return nullptr;
+            const Leaf *leaf = root_[chunk >> LEVEL_BITS].load(std::memory_order_acquire);
+            return leaf != nullptr ? leaf->owners[chunk & (LEVEL_SIZE - 1)].load(std::memory_order_acquire) : nullptr;
+        }
+
+        /** \brief Set the owner of the chunks in [begin, end). Return false if the range is not covered by
+            the map. */
+        bool assign(const char *begin, const char *end, const ompl::base::StatePool *pool)
+        {
+            const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(begin) >> CHUNK_BITS;
+            const std::uintptr_t last = (reinterpret_cast<std::uintptr_t>(end) - 1) >> CHUNK_BITS;
+            if ((last >> LEVEL_BITS) >= LEVEL_SIZE)
+                return false;
+            for (std::uintptr_t chunk = first; chunk <= last; ++chunk)
+            {
+                Leaf *leaf = root_[chunk >> LEVEL_BITS].load(std::memory_order_acquire);
+                if (leaf == nullptr)
+                {
+                    std::lock_guard<std::mutex> slock(lock_);
+                    leaf = root_[chunk >> LEVEL_BITS].load(std::memory_order_acquire);
+                    if (leaf == nullptr)
+                    {
+                        leaf = new Leaf();
+                        root_[chunk >> LEVEL_BITS].store(leaf, std::memory_order_release);
+                    }
+                }
+                leaf->owners[chunk & (LEVEL_SIZE - 1)].store(pool, std::memory_order_release);
+            }
+            return true;
+        }
+
+    private:
+        std::atomic<Leaf *> root_[LEVEL_SIZE];
+        std::mutex lock_;
+    };
+
+    ChunkMap &chunkMap()
+    {
+        // value-initialized, so all the entries start as nullptr
+        static auto *map = new ChunkMap();
+        return *map;
+    }
+}
+
+ompl::base::StatePool::StatePool(std::size_t blockSize, std::size_t initialBlockCount)
+  : blockSize_(alignSize(std::max(blockSize, sizeof(FreeBlock))))
+  , nextSlabBlockCount_(std::max<std::size_t>(initialBlockCount, 1))
+  , initialBlockCount_(nextSlabBlockCount_)
+  , shards_(std::min(std::max(std::thread::hardware_concurrency(), 1u), 64u))
+{
+}
+
+ompl::base::StatePool::~StatePool()
+{
+    std::lock_guard<std::mutex> slock(lock_);
+    freeSlabs();
+}
+
+ompl::base::StatePool::Shard &ompl::base::StatePool::localShard()
+{
+    static std::atomic<unsigned int> threadCount{0};
+    thread_local unsigned int threadIndex = threadCount++;
+    return shards_[threadIndex % shards_.size()];
+}
+
+void *ompl::base::StatePool::allocate()
+{
+    // counted before the block is taken, so that release() never frees a slab a block is being taken from
+    used_.fetch_add(1, std::memory_order_relaxed);
+    Shard &shard = localShard();
+    std::lock_guard<std::mutex> slock(shard.lock);
+    if (shard.freeList == nullptr)
+        refill(shard);
+    FreeBlock *block = shard.freeList;
+    shard.freeList = block->next;
+    --shard.count;
+    return block;
+}
+
+void ompl::base::StatePool::deallocate(void *block)
+{
+    {
+        Shard &shard = localShard();
+        std::lock_guard<std::mutex> slock(shard.lock);
+        auto *fb = static_cast<FreeBlock *>(block);
+        fb->next = shard.freeList;
+        shard.freeList = fb;
+
+        // give blocks back when a thread frees more than it allocates, so other threads can reuse them
+        if (++shard.count >= 2 * BATCH_SIZE)
+        {
+            std::lock_guard<std::mutex> glock(lock_);
+            for (std::size_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                FreeBlock *moved = shard.freeList;
+                shard.freeList = moved->next;
+                moved->next = freeList_;
+                freeList_ = moved;
+            }
+            shard.count -= BATCH_SIZE;
+        }
+    }
+
+    if (used_.fetch_sub(1, std::memory_order_acq_rel) == 1 && releasePending_.load())
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(shards_.size());
+        for (auto &shard : shards_)
+            locks.emplace_back(shard.lock);
+        if (releasePending_.load())
+            releaseIfUnused();
+    }
+}
+
+bool ompl::base::StatePool::owns(const void *block) const
+{
+    const StatePool *owner = chunkMap().owner(block);
+    if (owner != nullptr)
+        return owner == this;
+
+    // slabs outside the addresses covered by the chunk map
+    const char *p = static_cast<const char *>(block);
+    std::lock_guard<std::mutex> slock(lock_);
+    auto it = slabs_.upper_bound(const_cast<char *>(p));
+    if (it == slabs_.begin())
+        return false;
+    --it;
+    return p < it->second.end;
+}
+
+bool ompl::base::StatePool::release()
+{
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(shards_.size());
+    for (auto &shard : shards_)
+        locks.emplace_back(shard.lock);
+    releasePending_ = true;
+    return releaseIfUnused();
+}
+
+std::size_t ompl::base::StatePool::getUsedBlockCount() const
+{
+    return used_.load();
+}
+
+std::size_t ompl::base::StatePool::getReservedBlockCount() const
+{
+    std::lock_guard<std::mutex> slock(lock_);
+    return reserved_;
+}
+
+void ompl::base::StatePool::refill(Shard &shard)
+{
+    std::lock_guard<std::mutex> slock(lock_);
+    std::size_t count = 0;
+    for (; count < BATCH_SIZE && freeList_ != nullptr; ++count)
+    {
+        FreeBlock *moved = freeList_;
+        freeList_ = moved->next;
+        moved->next = shard.freeList;
+        shard.freeList = moved;
+    }
+    for (; count < BATCH_SIZE; ++count)
+    {
+        if (cursor_ == cursorEnd_)
+        {
+            if (count > 0)
+                break;
+            addSlab();
+        }
+        auto *block = reinterpret_cast<FreeBlock *>(cursor_);
+        cursor_ += blockSize_;
+        block->next = shard.freeList;
+        shard.freeList = block;
+    }
+    shard.count += count;
+}
+
+bool ompl::base::StatePool::releaseIfUnused()
+{
+    std::lock_guard<std::mutex> slock(lock_);
+    if (used_.load() != 0)
+        return false;
+    freeSlabs();
+    return true;
+}
+
+void ompl::base::StatePool::addSlab()
+{
+    // slabs are made of whole chunks, so that the chunks are not shared with other allocations
+    const std::size_t bytes = (blockSize_ * nextSlabBlockCount_ + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE;
+    auto *memory = static_cast<char *>(::operator new(bytes + CHUNK_SIZE));
+    char *begin = memory + (CHUNK_SIZE - reinterpret_cast<std::uintptr_t>(memory) % CHUNK_SIZE) % CHUNK_SIZE;
+    const std::size_t blocks = bytes / blockSize_;
+    slabs_[begin] = Slab{memory, begin, begin + bytes};
+    chunkMap().assign(begin, begin + bytes, this);
+    cursor_ = begin;
+    cursorEnd_ = begin + blocks * blockSize_;
+    reserved_ += blocks;
+    nextSlabBlockCount_ = std::min(blocks * 2, std::max(MAX_SLAB_BLOCK_COUNT, initialBlockCount_));
+}
+
+void ompl::base::StatePool::freeSlabs()
+{
+    for (auto &slab : slabs_)
+    {
+        chunkMap().assign(slab.second.begin, slab.second.end, nullptr);
+        ::operator delete(slab.second.memory);
+    }
+    slabs_.clear();
+    for (auto &shard : shards_)
+    {
+        shard.freeList = nullptr;
+        shard.count = 0;
+    }
+    freeList_ = nullptr;
+    cursor_ = cursorEnd_ = nullptr;
+    reserved_ = 0;
+    nextSlabBlockCount_ = initialBlockCount_;
+    releasePending_ = false;
+}
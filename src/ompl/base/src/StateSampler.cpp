@@ -37,6 +37,11 @@
 #include "ompl/base/StateSampler.h"
 #include "ompl/base/StateSpace.h"
 
+void ompl::base::StateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    rng_.setLocalStream(seed, stream);
+}
+
 void ompl::base::CompoundStateSampler::addSampler(const StateSamplerPtr &sampler, double weightImportance)
 {
     samplers_.push_back(sampler);
@@ -70,6 +75,21 @@ void ompl::base::CompoundStateSampler::sampleGaussian(State *state, const State
         samplers_[i]->sampleGaussian(comps[i], meanComps[i], stdDev * weightImportance_[i]);
 }
 
+void ompl::base::CompoundStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    StateSampler::setLocalStream(seed, stream);
+    // The seed of each component mixes the seed with the index of the component (splitmix64), so that nested
+    // compound samplers do not give two components the same numbers
+    for (unsigned int i = 0; i < samplerCount_; ++i)
+    {
+        std::uint64_t z = (static_cast<std::uint64_t>(seed) << 32) + i + 1 + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        z ^= z >> 31;
+        samplers_[i]->setLocalStream(static_cast<std::uint_fast32_t>(z & 0xffffffffu), stream);
+    }
+}
+
 ompl::base::SubspaceStateSampler::SubspaceStateSampler(const StateSpace *space, const StateSpace *subspace,
                                                        double weight)
   : StateSampler(space), subspace_(subspace), weight_(weight)
@@ -107,3 +127,8 @@ void ompl::base::SubspaceStateSampler::sampleGaussian(State *state, const State
     subspaceSampler_->sampleGaussian(work_, work2_, stdDev * weight_);
     copyStateData(space_, state, subspace_, work_, subspaces_);
 }
+
+void ompl::base::SubspaceStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    subspaceSampler_->setLocalStream(seed, stream);
+}
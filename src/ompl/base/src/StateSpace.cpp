@@ -39,12 +39,14 @@
 #include "ompl/util/String.h"
 #include <mutex>
 #include <boost/scoped_ptr.hpp>
+#include <algorithm>
 #include <numeric>
 #include <limits>
 #include <queue>
 #include <cmath>
 #include <list>
 #include <set>
+#include <typeinfo>
 
 const std::string ompl::base::StateSpace::DEFAULT_PROJECTION_NAME = "";
 
@@ -230,10 +232,102 @@ ompl::base::State *ompl::base::StateSpace::cloneState(const State *source) const
     return copy;
 }
 
+void ompl::base::StateSpace::distanceBatch(const State *state, const StateBatch &batch, double *distances) const
+{
+    if (batch.isPacked() && batch.getStateSpace() == this)
+    {
+        std::fill(distances, distances + batch.size(), 0.0);
+        accumulatePackedDistances(state, batch.getValues(), batch.getStride(), batch.size(), 1.0, distances);
+    }
+    else
+        distanceBatch(state, batch.getStates(), batch.size(), distances);
+}
+
+void ompl::base::StateSpace::distanceBatch(const State *state, const State *const *states, std::size_t count,
+                                           double *distances) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        distances[i] = distance(state, states[i]);
+}
+
+unsigned int ompl::base::StateSpace::getPackedValueCount() const
+{
+    return 0;
+}
+
+void ompl::base::StateSpace::packState(const State * /*state*/, double * /*values*/, std::size_t /*stride*/) const
+{
+    throw Exception("State space " + getName() + " does not support packing states");
+}
+
+void ompl::base::StateSpace::accumulatePackedDistances(const State * /*state*/, const double * /*values*/,
+                                                       std::size_t /*stride*/, std::size_t /*count*/,
+                                                       double /*weight*/, double * /*distances*/) const
+{
+    throw Exception("State space " + getName() + " does not support packing states");
+}
+
+double ompl::base::StateSpace::packedDistanceLowerBound(const double * /*values*/, const double * /*low*/,
+                                                        const double * /*high*/) const
+{
+    throw Exception("State space " + getName() + " does not support packing states");
+}
+
 void ompl::base::StateSpace::registerProjections()
 {
 }
 
+void ompl::base::StateSpace::setStatePoolEnabled(bool flag)
+{
+    statePoolEnabled_ = flag;
+    if (!flag)
+        statePoolActive_ = false;
+}
+
+void ompl::base::StateSpace::releaseStatePool() const
+{
+    if (statePool_)
+        statePool_->release();
+}
+
+std::size_t ompl::base::StateSpace::getStateMemorySize() const
+{
+    return 0;
+}
+
+ompl::base::State *ompl::base::StateSpace::constructStateAt(void * /*memory*/) const
+{
+    throw Exception("State space " + getName() + " does not support constructing states in provided memory");
+}
+
+void ompl::base::StateSpace::destructStateAt(State * /*state*/) const
+{
+    throw Exception("State space " + getName() + " does not support constructing states in provided memory");
+}
+
+void ompl::base::StateSpace::setupStatePool()
+{
+    statePoolActive_ = false;
+    if (!statePoolEnabled_)
+        return;
+
+    std::size_t size = getStateMemorySize();
+    if (size == 0)
+    {
+        OMPL_WARN("State space %s does not support pooled state allocation", getName().c_str());
+        return;
+    }
+
+    if (!statePool_ || statePool_->getBlockSize() != StatePool::alignSize(size))
+    {
+        if (statePool_ && statePool_->getUsedBlockCount() > 0)
+            throw Exception("The size of the states of space " + getName() +
+                            " changed while states allocated from its pool are still in use");
+        statePool_ = std::make_unique<StatePool>(size);
+    }
+    statePoolActive_ = true;
+}
+
 void ompl::base::StateSpace::setup()
 {
     maxExtent_ = getMaximumExtent();
@@ -278,6 +372,8 @@ void ompl::base::StateSpace::setup()
         else
             params_.include(projection.second->params(), "projection." + projection.first);
     }
+
+    setupStatePool();
 }
 
 const std::map<std::string, ompl::base::StateSpace::SubstateLocation> &
@@ -1075,6 +1171,62 @@ double ompl::base::CompoundStateSpace::distance(const State *state1, const State
     return dist;
 }
 
+unsigned int ompl::base::CompoundStateSpace::getPackedValueCount() const
+{
+    return typeid(*this) == typeid(CompoundStateSpace) ? getComponentsPackedValueCount() : 0u;
+}
+
+unsigned int ompl::base::CompoundStateSpace::getComponentsPackedValueCount() const
+{
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        unsigned int c = components_[i]->getPackedValueCount();
+        if (c == 0)
+            return 0;
+        count += c;
+    }
+    return count;
+}
+
+void ompl::base::CompoundStateSpace::packState(const State *state, double *values, std::size_t stride) const
+{
+    const auto *cstate = static_cast<const CompoundState *>(state);
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        components_[i]->packState(cstate->components[i], values, stride);
+        values += components_[i]->getPackedValueCount() * stride;
+    }
+}
+
+void ompl::base::CompoundStateSpace::accumulatePackedDistances(const State *state, const double *values,
+                                                               std::size_t stride, std::size_t count, double weight,
+                                                               double *distances) const
+{
+    const auto *cstate = static_cast<const CompoundState *>(state);
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        components_[i]->accumulatePackedDistances(cstate->components[i], values, stride, count,
+                                                  weight * weights_[i], distances);
+        values += components_[i]->getPackedValueCount() * stride;
+    }
+}
+
+double ompl::base::CompoundStateSpace::packedDistanceLowerBound(const double *values, const double *low,
+                                                                const double *high) const
+{
+    double bound = 0.0;
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        bound += weights_[i] * components_[i]->packedDistanceLowerBound(values, low, high);
+        unsigned int c = components_[i]->getPackedValueCount();
+        values += c;
+        low += c;
+        high += c;
+    }
+    return bound;
+}
+
 void ompl::base::CompoundStateSpace::setLongestValidSegmentFraction(double segmentFraction)
 {
     StateSpace::setLongestValidSegmentFraction(segmentFraction);
@@ -1139,6 +1291,8 @@ ompl::base::StateSamplerPtr ompl::base::CompoundStateSpace::allocSubspaceStateSa
 
 ompl::base::State *ompl::base::CompoundStateSpace::allocState() const
 {
+    if (State *pooled = allocPooledState())
+        return pooled;
     auto *state = new CompoundState();
     allocStateComponents(state);
     return static_cast<State *>(state);
@@ -1153,6 +1307,8 @@ void ompl::base::CompoundStateSpace::allocStateComponents(CompoundState *state)
 
 void ompl::base::CompoundStateSpace::freeState(State *state) const
 {
+    if (freePooledState(state))
+        return;
     auto *cstate = static_cast<CompoundState *>(state);
     for (unsigned int i = 0; i < componentCount_; ++i)
         components_[i]->freeState(cstate->components[i]);
@@ -1160,6 +1316,52 @@ void ompl::base::CompoundStateSpace::freeState(State *state) const
     delete cstate;
 }
 
+std::size_t ompl::base::CompoundStateSpace::getStateMemorySize() const
+{
+    std::size_t components = getStateComponentsMemorySize();
+    return components > 0 ? StatePool::alignSize(sizeof(CompoundState)) + components : 0;
+}
+
+ompl::base::State *ompl::base::CompoundStateSpace::constructStateAt(void *memory) const
+{
+    auto *state = new (memory) CompoundState();
+    constructStateComponentsAt(state, static_cast<char *>(memory) + StatePool::alignSize(sizeof(CompoundState)));
+    return state;
+}
+
+void ompl::base::CompoundStateSpace::destructStateAt(State *state) const
+{
+    auto *cstate = static_cast<CompoundState *>(state);
+    for (unsigned int i = 0; i < componentCount_; ++i)
+        components_[i]->destructStateAt(cstate->components[i]);
+    cstate->~CompoundState();
+}
+
+std::size_t ompl::base::CompoundStateSpace::getStateComponentsMemorySize() const
+{
+    std::size_t size = StatePool::alignSize(componentCount_ * sizeof(State *));
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        std::size_t s = components_[i]->getStateMemorySize();
+        if (s == 0)
+            return 0;
+        size += StatePool::alignSize(s);
+    }
+    return size;
+}
+
+void ompl::base::CompoundStateSpace::constructStateComponentsAt(CompoundState *state, void *memory) const
+{
+    auto *mem = static_cast<char *>(memory);
+    state->components = reinterpret_cast<State **>(mem);
+    mem += StatePool::alignSize(componentCount_ * sizeof(State *));
+    for (unsigned int i = 0; i < componentCount_; ++i)
+    {
+        state->components[i] = components_[i]->constructStateAt(mem);
+        mem += StatePool::alignSize(components_[i]->getStateMemorySize());
+    }
+}
+
 void ompl::base::CompoundStateSpace::lock()
 {
     locked_ = true;
@@ -37,11 +37,13 @@
 #ifndef OMPL_CONTROL_ODESOLVER_
 #define OMPL_CONTROL_ODESOLVER_
 
+#include "ompl/base/spaces/RealVectorStateSpace.h"
 #include "ompl/control/Control.h"
 #include "ompl/control/SpaceInformation.h"
 #include "ompl/control/StatePropagator.h"
 #include "ompl/util/Console.h"
 #include "ompl/util/ClassForward.h"
+#include "ompl/util/Exception.h"
 
 #include <boost/numeric/odeint/stepper/runge_kutta4.hpp>
 #include <boost/numeric/odeint/stepper/runge_kutta_cash_karp54.hpp>
@@ -50,6 +52,8 @@
 #include <boost/numeric/odeint/integrate/integrate_const.hpp>
 #include <boost/numeric/odeint/integrate/integrate_adaptive.hpp>
 namespace odeint = boost::numeric::odeint;
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <cassert>
 #include <utility>
@@ -88,7 +92,11 @@ namespace ompl
             /// \brief Parameterized constructor.  Takes a reference to SpaceInformation,
             /// an ODE to solve, and the integration step size.
             ODESolver(SpaceInformationPtr si, ODE ode, double intStep)
-              : si_(std::move(si)), ode_(std::move(ode)), intStep_(intStep)
+              : si_(std::move(si))
+              , ode_(std::move(ode))
+              , intStep_(intStep)
+              , realVectorSpace_(dynamic_cast<const base::RealVectorStateSpace *>(si_->getStateSpace().get()) !=
+                                 nullptr)
             {
             }
 
@@ -140,15 +148,23 @@ namespace ompl
                     void propagate(const base::State *state, const Control *control, double duration,
                                    base::State *result) const override
                     {
-                        ODESolver::StateType reals;
-                        si_->getStateSpace()->copyToReals(reals, state);
-                        solver_->solve(reals, control, duration);
-                        si_->getStateSpace()->copyFromReals(result, reals);
+                        solver_->propagate(state, control, duration, result);
 
                         if (postEvent_)
                             postEvent_(state, control, duration, result);
                     }
 
+                    void propagateBatch(const std::vector<const base::State *> &states,
+                                        const std::vector<const Control *> &controls, double duration,
+                                        const std::vector<base::State *> &results) const override
+                    {
+                        solver_->propagateBatch(states, controls, duration, results);
+
+                        if (postEvent_)
+                            for (std::size_t i = 0; i < states.size(); ++i)
+                                postEvent_(states[i], controls[i], duration, results[i]);
+                    }
+
                 protected:
                     ODESolverPtr solver_;
                     ODESolver::PostPropagationEvent postEvent_;
@@ -160,6 +176,40 @@ namespace ompl
             /// \brief Solve the ODE given the initial state, and a control to apply for some duration.
             virtual void solve(StateType &state, const Control *control, double duration) const = 0;
 
+            /// \brief Solve the ODE starting at \e state, with \e control applied for \e duration, and
+            /// store the final state in \e result.  This is called by the StatePropagator returned by
+            /// getStatePropagator().  The values of the state are copied to a buffer that each thread
+            /// reuses across calls, so no memory is allocated once the buffer has grown to the
+            /// dimension of the space.  The values of real vector states are copied as one block.
+            virtual void propagate(const base::State *state, const Control *control, double duration,
+                                   base::State *result) const
+            {
+                static thread_local StateType reals;
+                if (realVectorSpace_)
+                {
+                    const auto *from = state->as<base::RealVectorStateSpace::StateType>()->values;
+                    reals.assign(from, from + si_->getStateDimension());
+                    solve(reals, control, duration);
+                    std::copy(reals.begin(), reals.end(), result->as<base::RealVectorStateSpace::StateType>()->values);
+                }
+                else
+                {
+                    si_->getStateSpace()->copyToReals(reals, state);
+                    solve(reals, control, duration);
+                    si_->getStateSpace()->copyFromReals(result, reals);
+                }
+            }
+
+            /// \brief Solve the ODE for a batch of systems, as described by StatePropagator::propagateBatch().
+            /// The default implementation calls propagate() for every system.
+            virtual void propagateBatch(const std::vector<const base::State *> &states,
+                                        const std::vector<const Control *> &controls, double duration,
+                                        const std::vector<base::State *> &results) const
+            {
+                for (std::size_t i = 0; i < states.size(); ++i)
+                    propagate(states[i], controls[i], duration, results[i]);
+            }
+
             /// \brief The SpaceInformation that this ODESolver operates in.
             const SpaceInformationPtr si_;
 
@@ -169,23 +219,56 @@ namespace ompl
             /// \brief The size of the numerical integration step.  Should be small to minimize error.
             double intStep_;
 
+            /// \brief True if the states of the space store their values in one contiguous array
+            const bool realVectorSpace_;
+
             /// @cond IGNORE
-            // Functor used by the boost::numeric::odeint stepper object
-            struct ODEFunctor
+            // Functor used by the boost::numeric::odeint stepper object. It refers to the ODE instead of
+            // copying it, since the functor is created for every call to solve().
+            template <typename S = StateType, typename F = ODE, typename C = const Control *>
+            struct BasicODEFunctor
             {
-                ODEFunctor(ODE o, const Control *ctrl) : ode(std::move(o)), control(ctrl)
+                BasicODEFunctor(const F &o, C ctrl) : ode(o), control(ctrl)
                 {
                 }
 
                 // boost::numeric::odeint will callback to this method during integration to evaluate the system
-                void operator()(const StateType &current, StateType &output, double /*time*/)
+                void operator()(const S &current, S &output, double /*time*/) const
                 {
                     ode(current, control, output);
                 }
 
-                ODE ode;
-                const Control *control;
+                const F &ode;
+                C control;
             };
+            using ODEFunctor = BasicODEFunctor<>;
+
+            // A stepper that is reused for an unrelated integration must have buffers of the size of the new
+            // state, and steppers that remember previous steps (FSAL or multistep methods) must forget them
+            template <typename S, typename T>
+            static void prepareStepper(S &stepper, const T &state)
+            {
+                resetStepper(stepper, 0);
+                resizeStepper(stepper, state, 0);
+            }
+            template <typename S>
+            static auto resetStepper(S &stepper, int) -> decltype(stepper.reset(), void())
+            {
+                stepper.reset();
+            }
+            template <typename S>
+            static void resetStepper(S & /*stepper*/, long)
+            {
+            }
+            template <typename S, typename T>
+            static auto resizeStepper(S &stepper, const T &state, int) -> decltype(stepper.adjust_size(state), void())
+            {
+                stepper.adjust_size(state);
+            }
+            template <typename S, typename T>
+            static void resizeStepper(S & /*stepper*/, const T & /*state*/, long)
+            {
+            }
             /// @endcond
         };
 
@@ -210,12 +293,177 @@ namespace ompl
             /// \brief Solve the ODE using boost::numeric::odeint.
             void solve(StateType &state, const Control *control, double duration) const override
             {
-                Solver solver;
+                // the stepper keeps its intermediate buffers between calls
+                static thread_local Solver solver;
+                prepareStepper(solver, state);
                 ODESolver::ODEFunctor odefunc(ode_, control);
-                odeint::integrate_const(solver, odefunc, state, 0.0, duration, intStep_);
+                odeint::integrate_const(std::ref(solver), odefunc, state, 0.0, duration, intStep_);
             }
         };
 
+        /// \brief Solver that integrates a batch of systems q' = f(q, u) in lockstep, as one
+        /// system of ordinary differential equations.  The values of the systems are stored
+        /// dimension by dimension (structure of arrays): value \e d of system \e i is at index
+        /// d * n + i, where n is the number of systems.  The ODE evaluates the derivatives of
+        /// all systems in one call, which lets it loop over contiguous values, and the stepper
+        /// advances all systems with the same vector operations.  A single system is the
+        /// special case n = 1.  Solver is the numerical integration method used to solve the
+        /// equations.  The default is a fourth order Runge-Kutta method.
+        template <class Solver = odeint::runge_kutta4<ODESolver::StateType>>
+        class ODEBatchSolver : public ODESolver
+        {
+        public:
+            /// \brief Callback function that defines the ODE for a batch of systems.  Accepts
+            /// the current states, the control of each system, and the output derivatives.
+            using BatchODE = std::function<void(const StateType &, const std::vector<const Control *> &, StateType &)>;
+
+            /// \brief Parameterized constructor.  Takes a reference to the SpaceInformation,
+            /// an ODE to solve, and an optional integration step size - default is 0.01
+            ODEBatchSolver(const SpaceInformationPtr &si, BatchODE ode, double intStep = 1e-2)
+              : ODESolver(si, nullptr, intStep), batchODE_(std::move(ode))
+            {
+            }
+
+        protected:
+            /// \brief Solve the ODE using boost::numeric::odeint.
+            void solve(StateType &state, const Control *control, double duration) const override
+            {
+                static thread_local std::vector<const Control *> controls(1);
+                controls[0] = control;
+                integrate(state, controls, duration);
+            }
+
+            void propagateBatch(const std::vector<const base::State *> &states,
+                                const std::vector<const Control *> &controls, double duration,
+                                const std::vector<base::State *> &results) const override
+            {
+                const base::StateSpacePtr &space = si_->getStateSpace();
+                const auto &locations = space->getValueLocations();
+                const std::size_t n = states.size();
+
+                static thread_local StateType values;
+                values.resize(locations.size() * n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (realVectorSpace_)
+                    {
+                        const auto *from = states[i]->as<base::RealVectorStateSpace::StateType>()->values;
+                        for (std::size_t d = 0; d < locations.size(); ++d)
+                            values[d * n + i] = from[d];
+                    }
+                    else
+                        for (std::size_t d = 0; d < locations.size(); ++d)
+                            values[d * n + i] = *space->getValueAddressAtLocation(states[i], locations[d]);
+                }
+
+                integrate(values, controls, duration);
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (realVectorSpace_)
+                    {
+                        auto *to = results[i]->as<base::RealVectorStateSpace::StateType>()->values;
+                        for (std::size_t d = 0; d < locations.size(); ++d)
+                            to[d] = values[d * n + i];
+                    }
+                    else
+                        for (std::size_t d = 0; d < locations.size(); ++d)
+                            *space->getValueAddressAtLocation(results[i], locations[d]) = values[d * n + i];
+                }
+            }
+
+            /// \brief Integrate the ODE for the systems in \e values
+            void integrate(StateType &values, const std::vector<const Control *> &controls, double duration) const
+            {
+                // the stepper keeps its intermediate buffers between calls
+                static thread_local Solver solver;
+                prepareStepper(solver, values);
+                BasicODEFunctor<StateType, BatchODE, const std::vector<const Control *> &> odefunc(batchODE_, controls);
+                odeint::integrate_const(std::ref(solver), odefunc, values, 0.0, duration, intStep_);
+            }
+
+            /// \brief Definition of the ODE to find solutions for.
+            BatchODE batchODE_;
+        };
+
+        /// \brief Solver for ordinary differential equations of the type q' = f(q, u) with a
+        /// dimension \e N known at compile time.  The state of the system is kept in a
+        /// std::array, so integration does not allocate memory.  This is useful for small
+        /// systems, where allocating the intermediate states of the stepper can take longer
+        /// than evaluating the ODE.  The state space must have \e N values (see
+        /// base::StateSpace::copyToReals()); an Exception is thrown on propagation otherwise.
+        /// Solver is the numerical integration method used to solve the equations.  The default
+        /// is a fourth order Runge-Kutta method.
+        template <std::size_t N, class Solver = odeint::runge_kutta4<std::array<double, N>>>
+        class ODEFixedSizeSolver : public ODESolver
+        {
+        public:
+            /// \brief Portable data type for the state values
+            using FixedStateType = std::array<double, N>;
+
+            /// \brief Callback function that defines the ODE.  Accepts
+            /// the current state, input control, and output state.
+            using FixedODE = std::function<void(const FixedStateType &, const Control *, FixedStateType &)>;
+
+            /// \brief Parameterized constructor.  Takes a reference to the SpaceInformation,
+            /// an ODE to solve, and an optional integration step size - default is 0.01
+            ODEFixedSizeSolver(const SpaceInformationPtr &si, FixedODE ode, double intStep = 1e-2)
+              : ODESolver(si, nullptr, intStep), fixedODE_(std::move(ode))
+            {
+            }
+
+        protected:
+            /// \brief Solve the ODE using boost::numeric::odeint.
+            void solve(StateType &state, const Control *control, double duration) const override
+            {
+                if (state.size() != N)
+                    throw Exception("ODEFixedSizeSolver", "The dimension of the solver does not match the state");
+
+                FixedStateType fixed;
+                std::copy(state.begin(), state.end(), fixed.begin());
+                integrate(fixed, control, duration);
+                std::copy(fixed.begin(), fixed.end(), state.begin());
+            }
+
+            void propagate(const base::State *state, const Control *control, double duration,
+                           base::State *result) const override
+            {
+                const base::StateSpacePtr &space = si_->getStateSpace();
+                const auto &locations = space->getValueLocations();
+                if (locations.size() != N)
+                    throw Exception("ODEFixedSizeSolver", "The dimension of the solver does not match the state space");
+
+                FixedStateType fixed;
+                if (realVectorSpace_)
+                {
+                    const auto *from = state->as<base::RealVectorStateSpace::StateType>()->values;
+                    std::copy(from, from + N, fixed.begin());
+                }
+                else
+                    for (std::size_t i = 0; i < N; ++i)
+                        fixed[i] = *space->getValueAddressAtLocation(state, locations[i]);
+
+                integrate(fixed, control, duration);
+
+                if (realVectorSpace_)
+                    std::copy(fixed.begin(), fixed.end(), result->as<base::RealVectorStateSpace::StateType>()->values);
+                else
+                    for (std::size_t i = 0; i < N; ++i)
+                        *space->getValueAddressAtLocation(result, locations[i]) = fixed[i];
+            }
+
+            /// \brief Integrate the ODE in place
+            void integrate(FixedStateType &state, const Control *control, double duration) const
+            {
+                Solver solver;
+                BasicODEFunctor<FixedStateType, FixedODE> odefunc(fixedODE_, control);
+                odeint::integrate_const(std::ref(solver), odefunc, state, 0.0, duration, intStep_);
+            }
+
+            /// \brief Definition of the ODE to find solutions for.
+            FixedODE fixedODE_;
+        };
+
         /// \brief Solver for ordinary differential equations of the type q' = f(q, u),
         /// where q is the current state of the system and u is a control applied to the
         /// system.  StateType defines the container object describing the state of the system.
@@ -248,8 +496,9 @@ namespace ompl
                 if (error_.size() != state.size())
                     error_.assign(state.size(), 0.0);
 
-                Solver solver;
-                solver.adjust_size(state);
+                // the stepper keeps its intermediate buffers between calls
+                static thread_local Solver solver;
+                prepareStepper(solver, state);
 
                 double time = 0.0;
                 while (time < duration + std::numeric_limits<float>::epsilon())
@@ -312,8 +561,10 @@ namespace ompl
             void solve(StateType &state, const Control *control, double duration) const override
             {
                 ODESolver::ODEFunctor odefunc(ode_, control);
-                auto solver = make_controlled(1.0e-6, 1.0e-6, Solver());
-                odeint::integrate_adaptive(solver, odefunc, state, 0.0, duration, intStep_);
+                // the stepper keeps its intermediate buffers between calls
+                static thread_local auto solver = make_controlled(1.0e-6, 1.0e-6, Solver());
+                prepareStepper(solver, state);
+                odeint::integrate_adaptive(std::ref(solver), odefunc, state, 0.0, duration, intStep_);
             }
 
             /// \brief The maximum error allowed when performing numerical integration
@@ -39,6 +39,9 @@
 
 #include "ompl/control/DirectedControlSampler.h"
 #include "ompl/control/ControlSampler.h"
+#include "ompl/util/ThreadPool.h"
+#include <memory>
+#include <vector>
 
 namespace ompl
 {
@@ -79,6 +82,24 @@ namespace ompl
                 numControlSamples_ = numSamples;
             }
 
+            /** \brief Propagate the sampled controls concurrently on the threads of \e pool.
+                The controls and their durations are still sampled on the calling thread,
+                in the same order as in the serial case, and ties are resolved in favor of
+                the control sampled first, so the result for a fixed seed does not depend on
+                whether a pool is used. The state propagator and the state validity checker
+                must support concurrent calls. The pool may be shared with other samplers
+                and planners. Passing nullptr restores serial propagation. */
+            void setThreadPool(std::shared_ptr<ThreadPool> pool)
+            {
+                pool_ = std::move(pool);
+            }
+
+            /** \brief Get the thread pool used to propagate controls (nullptr if propagation is serial) */
+            const std::shared_ptr<ThreadPool> &getThreadPool() const
+            {
+                return pool_;
+            }
+
             /** \brief Sample a control given that it will be applied
                 to state \e state and the intention is to reach state
                 \e dest. This is useful for some algorithms that
@@ -108,11 +129,38 @@ namespace ompl
             virtual unsigned int getBestControl(Control *control, const base::State *source, base::State *dest,
                                                 const Control *previous);
 
+            /** \brief Called by getBestControl() when more than one control is sampled. All controls are
+                sampled first; they are then propagated on the threads of \e pool_ if it is set, or together
+                through SpaceInformation::propagateWhileValidBatch() otherwise. */
+            unsigned int getBestControlBatch(Control *control, const base::State *source, base::State *dest,
+                                             const Control *previous);
+
             /** \brief An instance of the control sampler*/
             ControlSamplerPtr cs_;
 
             /** \brief The number of controls to sample when finding the best control*/
             unsigned int numControlSamples_;
+
+            /** \brief The thread pool used to propagate controls concurrently, if any */
+            std::shared_ptr<ThreadPool> pool_;
+
+            /** \brief The controls sampled when more than one control is sampled; kept between calls */
+            std::vector<Control *> candidateControls_;
+
+            /** \brief The controls in \e candidateControls_, as passed to batch propagation */
+            std::vector<const Control *> candidateConstControls_;
+
+            /** \brief The state every candidate control is propagated from */
+            std::vector<const base::State *> candidateSources_;
+
+            /** \brief The states reached by the candidate controls; kept between calls */
+            std::vector<base::State *> candidateStates_;
+
+            /** \brief The number of steps each candidate control was applied for */
+            std::vector<unsigned int> candidateSteps_;
+
+            /** \brief The distance from each reached state to the target */
+            std::vector<double> candidateDistances_;
         };
     }
 }
@@ -250,6 +250,21 @@ namespace ompl
             unsigned int propagateWhileValid(const base::State *state, const Control *control, int steps,
                                              base::State *result) const;
 
+            /** \brief Propagate a batch of systems forward in lockstep, using StatePropagator::propagateBatch()
+                for every time step. System \e i starts at \e states[i] and control \e controls[i] is applied
+                to it for at most \e steps[i] time steps. As in propagateWhileValid(), the propagation of a
+                system stops at its first invalid state; the remaining systems continue.
+                \param states the states to start at
+                \param controls the controls to apply
+                \param steps the maximum number of time steps for each system. On return, the number of steps
+                actually performed without collision.
+                \param results the state at the end of the propagation of each system, or the last valid
+                state if a collision is found */
+            void propagateWhileValidBatch(const std::vector<const base::State *> &states,
+                                          const std::vector<const Control *> &controls,
+                                          std::vector<unsigned int> &steps,
+                                          const std::vector<base::State *> &results) const;
+
             /** \brief Propagate the model of the system forward, starting a a given state, with a given control, for a
                given number of steps.
                 \param state the state to start at
@@ -40,6 +40,7 @@
 #include "ompl/base/State.h"
 #include "ompl/control/Control.h"
 #include "ompl/util/ClassForward.h"
+#include <vector>
 
 namespace ompl
 {
@@ -92,6 +93,21 @@ namespace ompl
             virtual void propagate(const base::State *state, const Control *control, double duration,
                                    base::State *result) const = 0;
 
+            /** \brief Propagate a batch of systems for the same amount of time. System \e i starts at
+                \e states[i], control \e controls[i] is applied to it, and the state it is brought to
+                is stored in \e results[i]. The three vectors have the same length. The default
+                implementation calls propagate() for every system; propagators that can advance many
+                systems at once (e.g., a vectorized simulator) should override this function.
+
+                \note The starting state and the result state of a system may be the same. */
+            virtual void propagateBatch(const std::vector<const base::State *> &states,
+                                        const std::vector<const Control *> &controls, double duration,
+                                        const std::vector<base::State *> &results) const
+            {
+                for (std::size_t i = 0; i < states.size(); ++i)
+                    propagate(states[i], controls[i], duration, results[i]);
+            }
+
             /** \brief Some systems can only propagate forward in time (i.e., the \e duration argument for the
                propagate()
                 function is always positive). If this is the case, this function should return false. Planners that need
@@ -42,7 +42,13 @@ ompl::control::SimpleDirectedControlSampler::SimpleDirectedControlSampler(const
 {
 }
 
-ompl::control::SimpleDirectedControlSampler::~SimpleDirectedControlSampler() = default;
+ompl::control::SimpleDirectedControlSampler::~SimpleDirectedControlSampler()
+{
+    for (auto &control : candidateControls_)
+        si_->freeControl(control);
+    for (auto &state : candidateStates_)
+        si_->freeState(state);
+}
 
 unsigned int ompl::control::SimpleDirectedControlSampler::sampleTo(Control *control, const base::State *source,
                                                                    base::State *dest)
@@ -59,52 +65,78 @@ unsigned int ompl::control::SimpleDirectedControlSampler::sampleTo(Control *cont
 unsigned int ompl::control::SimpleDirectedControlSampler::getBestControl(Control *control, const base::State *source,
                                                                          base::State *dest, const Control *previous)
 {
-    // Sample the first control
+    if (numControlSamples_ > 1)
+        return getBestControlBatch(control, source, dest, previous);
+
     if (previous != nullptr)
         cs_->sampleNext(control, previous, source);
     else
         cs_->sample(control, source);
 
+    unsigned int steps = cs_->sampleStepCount(si_->getMinControlDuration(), si_->getMaxControlDuration());
+    return si_->propagateWhileValid(source, control, steps, dest);
+}
+
+unsigned int ompl::control::SimpleDirectedControlSampler::getBestControlBatch(Control *control,
+                                                                              const base::State *source,
+                                                                              base::State *dest,
+                                                                              const Control *previous)
+{
     const unsigned int minDuration = si_->getMinControlDuration();
     const unsigned int maxDuration = si_->getMaxControlDuration();
 
-    unsigned int steps = cs_->sampleStepCount(minDuration, maxDuration);
-    // Propagate the first control, and find how far it is from the target state
-    base::State *bestState = si_->allocState();
-    steps = si_->propagateWhileValid(source, control, steps, bestState);
-
-    if (numControlSamples_ > 1)
+    while (candidateControls_.size() < numControlSamples_)
     {
-        Control *tempControl = si_->allocControl();
-        base::State *tempState = si_->allocState();
-        double bestDistance = si_->distance(bestState, dest);
-
-        // Sample k-1 more controls, and save the control that gets closest to target
-        for (unsigned int i = 1; i < numControlSamples_; ++i)
-        {
-            unsigned int sampleSteps = cs_->sampleStepCount(minDuration, maxDuration);
-            if (previous != nullptr)
-                cs_->sampleNext(tempControl, previous, source);
-            else
-                cs_->sample(tempControl, source);
+        candidateControls_.push_back(si_->allocControl());
+        candidateStates_.push_back(si_->allocState());
+    }
+    while (candidateControls_.size() > numControlSamples_)
+    {
+        si_->freeControl(candidateControls_.back());
+        si_->freeState(candidateStates_.back());
+        candidateControls_.pop_back();
+        candidateStates_.pop_back();
+    }
+    candidateSteps_.resize(numControlSamples_);
+    candidateDistances_.resize(numControlSamples_);
 
-            sampleSteps = si_->propagateWhileValid(source, tempControl, sampleSteps, tempState);
-            double tempDistance = si_->distance(tempState, dest);
-            if (tempDistance < bestDistance)
-            {
-                si_->copyState(bestState, tempState);
-                si_->copyControl(control, tempControl);
-                bestDistance = tempDistance;
-                steps = sampleSteps;
-            }
-        }
+    // The control sampler is not thread safe, so all controls are sampled here, in the order
+    // in which they used to be sampled and propagated one at a time
+    for (unsigned int i = 0; i < numControlSamples_; ++i)
+    {
+        if (i > 0)
+            candidateSteps_[i] = cs_->sampleStepCount(minDuration, maxDuration);
+        if (previous != nullptr)
+            cs_->sampleNext(candidateControls_[i], previous, source);
+        else
+            cs_->sample(candidateControls_[i], source);
+        if (i == 0)
+            candidateSteps_[i] = cs_->sampleStepCount(minDuration, maxDuration);
+    }
 
-        si_->freeState(tempState);
-        si_->freeControl(tempControl);
+    if (pool_)
+        pool_->parallelFor(numControlSamples_, [this, source, dest](std::size_t i)
+                           {
+                               candidateSteps_[i] = si_->propagateWhileValid(source, candidateControls_[i],
+                                                                             candidateSteps_[i], candidateStates_[i]);
+                               candidateDistances_[i] = si_->distance(candidateStates_[i], dest);
+                           });
+    else
+    {
+        candidateSources_.assign(numControlSamples_, source);
+        candidateConstControls_.assign(candidateControls_.begin(), candidateControls_.end());
+        si_->propagateWhileValidBatch(candidateSources_, candidateConstControls_, candidateSteps_, candidateStates_);
+        for (unsigned int i = 0; i < numControlSamples_; ++i)
+            candidateDistances_[i] = si_->distance(candidateStates_[i], dest);
     }
 
-    si_->copyState(dest, bestState);
-    si_->freeState(bestState);
+    // keep the first of the closest states
+    unsigned int best = 0;
+    for (unsigned int i = 1; i < numControlSamples_; ++i)
+        if (candidateDistances_[i] < candidateDistances_[best])
+            best = i;
 
-    return steps;
+    si_->copyControl(control, candidateControls_[best]);
+    si_->copyState(dest, candidateStates_[best]);
+    return candidateSteps_[best];
 }
@@ -220,6 +220,77 @@ unsigned int ompl::control::SpaceInformation::propagateWhileValid(const base::St
     return 0;
 }
 
+void ompl::control::SpaceInformation::propagateWhileValidBatch(const std::vector<const base::State *> &states,
+                                                              const std::vector<const Control *> &controls,
+                                                              std::vector<unsigned int> &steps,
+                                                              const std::vector<base::State *> &results) const
+{
+    const std::size_t count = states.size();
+
+    // as in propagateWhileValid(), every system alternates between its result state and a temporary state
+    std::vector<base::State *> current(results);
+    std::vector<base::State *> next(count);
+    for (auto &state : next)
+        state = allocState();
+
+    std::vector<std::size_t> active;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (steps[i] > 0)
+            active.push_back(i);
+        else if (results[i] != states[i])
+            copyState(results[i], states[i]);
+    }
+
+    std::vector<const base::State *> from;
+    std::vector<const Control *> activeControls;
+    std::vector<base::State *> to;
+    for (unsigned int st = 0; !active.empty(); ++st)
+    {
+        from.clear();
+        activeControls.clear();
+        to.clear();
+        for (std::size_t i : active)
+        {
+            from.push_back(st == 0 ? states[i] : current[i]);
+            activeControls.push_back(controls[i]);
+            to.push_back(st == 0 ? current[i] : next[i]);
+        }
+        statePropagator_->propagateBatch(from, activeControls, stepSize_, to);
+
+        std::size_t remaining = 0;
+        for (std::size_t j = 0; j < active.size(); ++j)
+        {
+            std::size_t i = active[j];
+            if (!isValid(to[j]))
+            {
+                // the last valid state is the starting one (assumed to be valid) or the one reached at
+                // the previous step
+                if (st == 0 && results[i] != states[i])
+                    copyState(results[i], states[i]);
+                steps[i] = st;
+                continue;
+            }
+            if (st > 0)
+                std::swap(current[i], next[i]);
+            if (st + 1 < steps[i])
+                active[remaining++] = i;
+        }
+        active.resize(remaining);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (current[i] != results[i])
+        {
+            copyState(results[i], current[i]);
+            freeState(current[i]);
+        }
+        else
+            freeState(next[i]);
+    }
+}
+
 void ompl::control::SpaceInformation::propagate(const base::State *state, const Control *control, int steps,
                                                 std::vector<base::State *> &result, bool alloc) const
 {
@@ -210,6 +210,30 @@ namespace ompl
                 content.push_back(element->data);
         }
 
+        /** \brief Append the (up to) \e count smallest elements to \e elements, in increasing order.
+            The heap is not modified. */
+        void getTop(std::size_t count, std::vector<Element *> &elements) const
+        {
+            // Best-first traversal of the tree: the next smallest element is always one of the
+            // children of the elements returned so far.
+            std::vector<unsigned int> frontier;
+            if (!vector_.empty() && count > 0)
+                frontier.push_back(0);
+            while (!frontier.empty() && count > 0)
+            {
+                auto best = frontier.begin();
+                for (auto it = frontier.begin() + 1; it != frontier.end(); ++it)
+                    if (lt_(vector_[*it]->data, vector_[*best]->data))
+                        best = it;
+                const unsigned int pos = *best;
+                frontier.erase(best);
+                elements.push_back(vector_[pos]);
+                --count;
+                for (unsigned int c = 2 * pos + 1; c <= 2 * pos + 2 && c < vector_.size(); ++c)
+                    frontier.push_back(c);
+            }
+        }
+
         /** \brief Sort an array of elements. This does not affect the content of the heap */
         void sort(std::vector<_T> &list)
         {
@@ -252,10 +276,13 @@ namespace ompl
             delete vector_[pos];
             if ((int)pos < n)
             {
-                vector_[pos] = vector_.back();
-                vector_[pos]->position = pos;
+                Element *moved = vector_.back();
+                vector_[pos] = moved;
+                moved->position = pos;
                 vector_.pop_back();
-                percolateDown(pos);
+                // the moved element may belong above or below its new position
+                percolateUp(pos);
+                percolateDown(moved->position);
             }
             else
                 vector_.pop_back();
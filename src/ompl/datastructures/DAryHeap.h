@@ -0,0 +1,360 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_DATASTRUCTURES_DARY_HEAP_
+#define OMPL_DATASTRUCTURES_DARY_HEAP_
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief An updatable min-heap in which every node has \e D children.
+
+        The interface is that of BinaryHeap, so the two can be exchanged: inserting
+        data returns an Element* that serves as a handle for update() and remove()
+        until the data leaves the heap. Unlike BinaryHeap, elements are not allocated
+        one at a time. They are taken from blocks owned by the heap and recycled after
+        removal, so a heap that has reached its working size no longer allocates memory.
+        A larger \e D makes the heap shallower, which reduces the number of levels
+        visited when an element moves up and keeps the children that are compared
+        when an element moves down next to each other in memory.
+
+        The data of a removed element is reset to a default-constructed value, so that
+        the heap does not keep resources (e.g., shared pointers) alive. */
+    template <typename _T, class LessThan = std::less<_T>, unsigned int D = 4>
+    class DAryHeap
+    {
+        static_assert(D >= 2, "A heap node needs at least two children");
+
+    public:
+        /** \brief The handle of data stored in the heap. It contains the data and
+            the position of the data in the heap's internal storage. */
+        class Element
+        {
+            friend class DAryHeap;
+
+        private:
+            Element() = default;
+            /** \brief The location of the data in the heap's storage */
+            unsigned int position;
+
+        public:
+            /** \brief The data of this element */
+            _T data;
+        };
+
+        /** \brief Event that gets called after an insertion */
+        using EventAfterInsert = void (*)(Element *, void *);
+
+        /** \brief Event that gets called just before a removal */
+        using EventBeforeRemove = void (*)(Element *, void *);
+
+        DAryHeap() = default;
+
+        DAryHeap(LessThan lt) : lt_(std::move(lt))
+        {
+        }
+
+        DAryHeap(const DAryHeap &) = delete;
+        DAryHeap &operator=(const DAryHeap &) = delete;
+        DAryHeap(DAryHeap &&) = default;
+        DAryHeap &operator=(DAryHeap &&) = default;
+
+        ~DAryHeap() = default;
+
+        /** \brief Set the event that gets called after insertion */
+        void onAfterInsert(EventAfterInsert event, void *arg)
+        {
+            eventAfterInsert_ = event;
+            eventAfterInsertData_ = arg;
+        }
+
+        /** \brief Set the event that gets called before a removal */
+        void onBeforeRemove(EventBeforeRemove event, void *arg)
+        {
+            eventBeforeRemove_ = event;
+            eventBeforeRemoveData_ = arg;
+        }
+
+        /** \brief Clear the heap. The memory of the elements is kept for later insertions. */
+        void clear()
+        {
+            for (auto &element : vector_)
+                release(element);
+            vector_.clear();
+        }
+
+        /** \brief Return the top element. nullptr for an empty heap. */
+        Element *top() const
+        {
+            return vector_.empty() ? nullptr : vector_[0];
+        }
+
+        /** \brief Remove the top element */
+        void pop()
+        {
+            removePos(0);
+        }
+
+        /** \brief Remove a specific element */
+        void remove(Element *element)
+        {
+            if (eventBeforeRemove_)
+                eventBeforeRemove_(element, eventBeforeRemoveData_);
+            removePos(element->position);
+        }
+
+        /** \brief Add a new element */
+        Element *insert(const _T &data)
+        {
+            const unsigned int pos = vector_.size();
+            Element *element = acquire(data, pos);
+            vector_.push_back(element);
+            percolateUp(pos);
+            if (eventAfterInsert_)
+                eventAfterInsert_(element, eventAfterInsertData_);
+            return element;
+        }
+
+        /** \brief Add a set of elements to the heap */
+        void insert(const std::vector<_T> &list)
+        {
+            vector_.reserve(vector_.size() + list.size());
+            for (const auto &data : list)
+                insert(data);
+        }
+
+        /** \brief Clear the heap, add the set of elements @e list to it and rebuild it. */
+        void buildFrom(const std::vector<_T> &list)
+        {
+            clear();
+            vector_.reserve(list.size());
+            for (const auto &data : list)
+                vector_.push_back(acquire(data, vector_.size()));
+            build();
+        }
+
+        /** \brief Rebuild the heap */
+        void rebuild()
+        {
+            build();
+        }
+
+        /** \brief Update an element in the heap */
+        void update(Element *element)
+        {
+            const unsigned int pos = element->position;
+            assert(vector_[pos] == element);
+            percolateUp(pos);
+            percolateDown(element->position);
+        }
+
+        /** \brief Check if the heap is empty */
+        bool empty() const
+        {
+            return vector_.empty();
+        }
+
+        /** \brief Get the number of elements in the heap */
+        unsigned int size() const
+        {
+            return vector_.size();
+        }
+
+        /** \brief Get the data stored in this heap */
+        void getContent(std::vector<_T> &content) const
+        {
+            for (auto &element : vector_)
+                content.push_back(element->data);
+        }
+
+        /** \brief Append the (up to) \e count smallest elements to \e elements, in increasing order.
+            The heap is not modified. */
+        void getTop(std::size_t count, std::vector<Element *> &elements) const
+        {
+            // Best-first traversal of the tree: the next smallest element is always one of the
+            // children of the elements returned so far.
+            std::vector<std::size_t> frontier;
+            if (!vector_.empty() && count > 0)
+                frontier.push_back(0);
+            while (!frontier.empty() && count > 0)
+            {
+                auto best = frontier.begin();
+                for (auto it = frontier.begin() + 1; it != frontier.end(); ++it)
+                    if (lt_(vector_[*it]->data, vector_[*best]->data))
+                        best = it;
+                const std::size_t pos = *best;
+                frontier.erase(best);
+                elements.push_back(vector_[pos]);
+                --count;
+                for (std::size_t c = pos * D + 1; c <= pos * D + D && c < vector_.size(); ++c)
+                    frontier.push_back(c);
+            }
+        }
+
+        /** \brief Sort an array of elements. This does not affect the content of the heap */
+        void sort(std::vector<_T> &list)
+        {
+            std::sort(list.begin(), list.end(), lt_);
+        }
+
+        /** \brief Return a reference to the comparison operator */
+        LessThan &getComparisonOperator()
+        {
+            return lt_;
+        }
+
+    private:
+        LessThan lt_;
+
+        std::vector<Element *> vector_;
+
+        /** \brief The blocks the elements are allocated from */
+        std::vector<std::unique_ptr<Element[]>> blocks_;
+
+        /** \brief Allocated elements that are not in the heap */
+        std::vector<Element *> free_;
+
+        EventAfterInsert eventAfterInsert_{nullptr};
+        void *eventAfterInsertData_{nullptr};
+        EventBeforeRemove eventBeforeRemove_{nullptr};
+        void *eventBeforeRemoveData_{nullptr};
+
+        Element *acquire(const _T &data, unsigned int pos)
+        {
+            if (free_.empty())
+            {
+                // blocks double in size, so the number of allocations is logarithmic in the size of the heap
+                const std::size_t n = blocks_.empty() ? 64 : 32 * ((std::size_t)1 << blocks_.size());
+                blocks_.emplace_back(new Element[n]);
+                for (std::size_t i = n; i > 0; --i)
+                    free_.push_back(&blocks_.back()[i - 1]);
+            }
+            Element *element = free_.back();
+            free_.pop_back();
+            element->data = data;
+            element->position = pos;
+            return element;
+        }
+
+        void release(Element *element)
+        {
+            element->data = _T();
+            free_.push_back(element);
+        }
+
+        void removePos(unsigned int pos)
+        {
+            release(vector_[pos]);
+            if (pos + 1 < vector_.size())
+            {
+                Element *moved = vector_.back();
+                vector_[pos] = moved;
+                moved->position = pos;
+                vector_.pop_back();
+                // the moved element may belong above or below its new position
+                percolateUp(pos);
+                percolateDown(moved->position);
+            }
+            else
+                vector_.pop_back();
+        }
+
+        void build()
+        {
+            if (vector_.size() < 2)
+                return;
+            for (std::size_t i = (vector_.size() - 2) / D + 1; i > 0; --i)
+                percolateDown(i - 1);
+        }
+
+        void percolateDown(const unsigned int pos)
+        {
+            const std::size_t n = vector_.size();
+            Element *tmp = vector_[pos];
+            std::size_t parent = pos;
+            std::size_t first = D * parent + 1;
+
+            while (first < n)
+            {
+                // find the smallest child
+                std::size_t child = first;
+                const std::size_t last = std::min(first + D, n);
+                for (std::size_t c = first + 1; c < last; ++c)
+                    if (lt_(vector_[c]->data, vector_[child]->data))
+                        child = c;
+                if (!lt_(vector_[child]->data, tmp->data))
+                    break;
+                vector_[parent] = vector_[child];
+                vector_[parent]->position = parent;
+                parent = child;
+                first = D * parent + 1;
+            }
+            if (parent != pos)
+            {
+                vector_[parent] = tmp;
+                tmp->position = parent;
+            }
+        }
+
+        void percolateUp(const unsigned int pos)
+        {
+            Element *tmp = vector_[pos];
+            std::size_t child = pos;
+
+            while (child > 0)
+            {
+                const std::size_t parent = (child - 1) / D;
+                if (!lt_(tmp->data, vector_[parent]->data))
+                    break;
+                vector_[child] = vector_[parent];
+                vector_[child]->position = child;
+                child = parent;
+            }
+            if (child != pos)
+            {
+                vector_[child] = tmp;
+                tmp->position = child;
+            }
+        }
+    };
+}
+
+#endif
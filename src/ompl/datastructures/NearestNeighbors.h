@@ -37,6 +37,7 @@
 #ifndef OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_
 #define OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_
 
+#include "ompl/util/Exception.h"
 #include <vector>
 #include <functional>
 
@@ -50,6 +51,28 @@ namespace ompl
         /** \brief The definition of a distance function */
         using DistanceFunction = std::function<double(const _T &, const _T &)>;
 
+        /** \brief The definition of a batched distance function. It stores in its last argument the distances
+            from its first argument to each of the elements of the array given by the second and third arguments. */
+        using BatchDistanceFunction = std::function<void(const _T &, const _T *, std::size_t, double *)>;
+
+        /** \brief Functions that let a datastructure keep the coordinates of its elements packed in a structure
+            of arrays (see base::StateBatch), so that the distances to many elements are computed by the vectorized
+            kernels of a state space without dereferencing the elements. */
+        struct PackedDistance
+        {
+            /** \brief The number of values stored per element (0 if packing is not supported) */
+            unsigned int valueCount{0};
+
+            /** \brief Write the values of an element, value \e j going to the second argument at index \e j times
+                the third argument */
+            std::function<void(const _T &, double *, std::size_t)> pack;
+
+            /** \brief Store in the last argument the distances from the first argument to the elements whose values
+                are given by the second argument: value \e j of element \e i is at index \e j times the third argument
+                plus \e i. The fourth argument is the number of elements. */
+            std::function<void(const _T &, const double *, std::size_t, std::size_t, double *)> distances;
+        };
+
         NearestNeighbors() = default;
 
         virtual ~NearestNeighbors() = default;
@@ -66,10 +89,71 @@ namespace ompl
             return distFun_;
         }
 
+        /** \brief Set an optional batched distance function. It must compute the same distances as the distance
+            function. Datastructures that scan arrays of elements use it to compute many distances with one call. */
+        virtual void setBatchDistanceFunction(const BatchDistanceFunction &batchDistFun)
+        {
+            batchDistFun_ = batchDistFun;
+        }
+
+        /** \brief Get the batched distance function used (may be empty) */
+        const BatchDistanceFunction &getBatchDistanceFunction() const
+        {
+            return batchDistFun_;
+        }
+
+        /** \brief Set the functions used to store the elements in packed form. They must compute the same
+            distances as the distance function. Datastructures that scan arrays of elements use them instead of
+            the batched distance function; others ignore them. */
+        virtual void setPackedDistance(const PackedDistance &packedDist)
+        {
+            packedDist_ = packedDist;
+        }
+
+        /** \brief Get the functions used to store the elements in packed form */
+        const PackedDistance &getPackedDistance() const
+        {
+            return packedDist_;
+        }
+
         /** \brief Return true if the solutions reported by this data structure
             are sorted, when calling nearestK / nearestR. */
         virtual bool reportsSortedResults() const = 0;
 
+        /** \brief Return true if the data structure can be used by multiple
+            threads at once (including concurrent calls to add() and the
+            nearest neighbor queries) without external locking. */
+        virtual bool supportsConcurrentAccess() const
+        {
+            return false;
+        }
+
+        /** \brief Allow nearest neighbor queries to trade accuracy for speed. With an approximation factor
+            \e epsilon > 0, the k-th neighbor reported by nearestK() is at most (1 + \e epsilon) times farther
+            away than the true k-th nearest neighbor, and nearestR() reports only elements within the radius, but
+            possibly not those whose distance exceeds the radius divided by (1 + \e epsilon). The default of 0
+            means exact search. Datastructures for which supportsApproximateSearch() is false ignore this
+            setting. */
+        virtual void setApproximationFactor(double epsilon)
+        {
+            if (epsilon < 0.0)
+                throw Exception("The approximation factor for nearest neighbor queries must be non-negative");
+            approximationFactor_ = epsilon;
+        }
+
+        /** \brief Get the approximation factor for nearest neighbor queries */
+        double getApproximationFactor() const
+        {
+            return approximationFactor_;
+        }
+
+        /** \brief Return true if the data structure can use an approximation
+            factor (see setApproximationFactor()) to speed up queries. */
+        virtual bool supportsApproximateSearch() const
+        {
+            return false;
+        }
+
         /** \brief Clear the datastructure */
         virtual void clear() = 0;
 
@@ -112,6 +196,15 @@ namespace ompl
     protected:
         /** \brief The used distance function */
         DistanceFunction distFun_;
+
+        /** \brief The used batched distance function (optional) */
+        BatchDistanceFunction batchDistFun_;
+
+        /** \brief The functions used to store the elements in packed form (optional) */
+        PackedDistance packedDist_;
+
+        /** \brief The approximation factor for queries (0 for exact search) */
+        double approximationFactor_{0.0};
     };
 }
 
@@ -0,0 +1,329 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_CONCURRENT_GNAT_
+#define OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_CONCURRENT_GNAT_
+
+#include "ompl/datastructures/NearestNeighborsGNAT.h"
+#include "ompl/util/Exception.h"
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief A GNAT that supports concurrent insertions and queries
+        without external locking.
+
+        Queries hold a shared (reader) lock on the underlying
+        NearestNeighborsGNAT, so any number of them can run at the same
+        time. New elements are appended to a small insertion buffer,
+        protected by a separate mutex that is only held for as long as it
+        takes to copy the buffer; queries scan the buffer linearly and
+        merge the results with those from the tree. When the buffer is
+        full, the thread that filled it takes the exclusive lock on the
+        tree and merges the buffered elements into it. Removal takes the
+        exclusive lock as well.
+
+        Queries wait while a merge holds the exclusive lock. Without
+        rebalancing (the default), a merge inserts at most about
+        \e maxBufferSize elements, which bounds this wait; with
+        rebalancing, or when a merge finds the cache of removed elements
+        full, the merge rebuilds the whole tree and queries wait for the
+        rebuild. Insertions only wait for the buffer to be emptied, not for
+        the merge. */
+    template <typename _T>
+    class NearestNeighborsConcurrentGNAT : public NearestNeighbors<_T>
+    {
+    public:
+        /** \brief Constructor. At most \e maxBufferSize elements are kept
+            in the insertion buffer before they are merged into the tree.
+            The remaining arguments are passed to the NearestNeighborsGNAT
+            constructor. */
+        NearestNeighborsConcurrentGNAT(unsigned int maxBufferSize = 64, unsigned int degree = 8,
+                                       unsigned int minDegree = 4, unsigned int maxDegree = 12,
+                                       unsigned int maxNumPtsPerLeaf = 50, unsigned int removedCacheSize = 500,
+                                       bool rebalancing = false)
+          : NearestNeighbors<_T>()
+          , tree_(degree, minDegree, maxDegree, maxNumPtsPerLeaf, removedCacheSize, rebalancing)
+          , maxBufferSize_(std::max(1u, maxBufferSize))
+        {
+        }
+
+        ~NearestNeighborsConcurrentGNAT() override = default;
+
+        void setDistanceFunction(const typename NearestNeighbors<_T>::DistanceFunction &distFun) override
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            NearestNeighbors<_T>::setDistanceFunction(distFun);
+            tree_.setDistanceFunction(distFun);
+        }
+
+        void setBatchDistanceFunction(const typename NearestNeighbors<_T>::BatchDistanceFunction &distFun) override
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            NearestNeighbors<_T>::setBatchDistanceFunction(distFun);
+            tree_.setBatchDistanceFunction(distFun);
+        }
+
+        /** \brief Set the approximation factor used for searching the
+            tree; the insertion buffer is always searched exactly */
+        void setApproximationFactor(double epsilon) override
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            NearestNeighbors<_T>::setApproximationFactor(epsilon);
+            tree_.setApproximationFactor(epsilon);
+        }
+
+        bool supportsApproximateSearch() const override
+        {
+            return true;
+        }
+
+        bool reportsSortedResults() const override
+        {
+            return true;
+        }
+
+        bool supportsConcurrentAccess() const override
+        {
+            return true;
+        }
+
+        void clear() override
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            std::lock_guard<std::mutex> block(bufferLock_);
+            tree_.clear();
+            buffer_.clear();
+        }
+
+        void add(const _T &data) override
+        {
+            bool full;
+            {
+                std::lock_guard<std::mutex> block(bufferLock_);
+                buffer_.push_back(data);
+                full = buffer_.size() >= maxBufferSize_;
+            }
+            if (full)
+                mergeBuffer();
+        }
+
+        void add(const std::vector<_T> &data) override
+        {
+            bool full;
+            {
+                std::lock_guard<std::mutex> block(bufferLock_);
+                buffer_.insert(buffer_.end(), data.begin(), data.end());
+                full = buffer_.size() >= maxBufferSize_;
+            }
+            if (full)
+                mergeBuffer();
+        }
+
+        bool remove(const _T &data) override
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            {
+                std::lock_guard<std::mutex> block(bufferLock_);
+                auto it = std::find(buffer_.begin(), buffer_.end(), data);
+                if (it != buffer_.end())
+                {
+                    buffer_.erase(it);
+                    return true;
+                }
+            }
+            return tree_.remove(data);
+        }
+
+        _T nearest(const _T &data) const override
+        {
+            std::vector<std::pair<double, _T>> candidates;
+            collectK(data, 1, candidates);
+            if (candidates.empty())
+                throw Exception("No elements found in nearest neighbors data structure");
+            return candidates.front().second;
+        }
+
+        /** \brief Return the k nearest neighbors in sorted order */
+        void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh) const override
+        {
+            nbh.clear();
+            if (k == 0)
+                return;
+            std::vector<std::pair<double, _T>> candidates;
+            collectK(data, k, candidates);
+            nbh.reserve(candidates.size());
+            for (const auto &c : candidates)
+                nbh.push_back(c.second);
+        }
+
+        /** \brief Return the nearest neighbors within distance \c radius in sorted order */
+        void nearestR(const _T &data, double radius, std::vector<_T> &nbh) const override
+        {
+            std::vector<std::pair<double, _T>> candidates;
+            std::vector<_T> buffer;
+            {
+                std::shared_lock<std::shared_timed_mutex> tlock(treeLock_);
+                if (tree_.size() > 0)
+                {
+                    typename Tree::NearQueue nbhQueue;
+                    tree_.withThreadContext([&](typename Tree::QueryContext &context)
+                                            { tree_.nearestRInternal(data, radius, nbhQueue, context); });
+                    for (; !nbhQueue.empty(); nbhQueue.pop())
+                        candidates.emplace_back(nbhQueue.top().first, *nbhQueue.top().second);
+                }
+                copyBuffer(buffer);
+            }
+            for (const auto &b : buffer)
+            {
+                double dist = NearestNeighbors<_T>::distFun_(data, b);
+                if (dist <= radius)
+                    candidates.emplace_back(dist, b);
+            }
+            std::sort(candidates.begin(), candidates.end(), compareDistance);
+            nbh.clear();
+            nbh.reserve(candidates.size());
+            for (const auto &c : candidates)
+                nbh.push_back(c.second);
+        }
+
+        std::size_t size() const override
+        {
+            std::shared_lock<std::shared_timed_mutex> tlock(treeLock_);
+            std::lock_guard<std::mutex> block(bufferLock_);
+            return tree_.size() + buffer_.size();
+        }
+
+        void list(std::vector<_T> &data) const override
+        {
+            std::shared_lock<std::shared_timed_mutex> tlock(treeLock_);
+            tree_.list(data);
+            std::lock_guard<std::mutex> block(bufferLock_);
+            data.insert(data.end(), buffer_.begin(), buffer_.end());
+        }
+
+    protected:
+        /// \cond IGNORE
+        // Exposes the queries that report distances along with the elements
+        class Tree : public NearestNeighborsGNAT<_T>
+        {
+        public:
+            using NearestNeighborsGNAT<_T>::NearestNeighborsGNAT;
+            using NearQueue = typename NearestNeighborsGNAT<_T>::NearQueue;
+            using NearestNeighborsGNAT<_T>::nearestKInternal;
+            using NearestNeighborsGNAT<_T>::nearestRInternal;
+            using NearestNeighborsGNAT<_T>::withThreadContext;
+        };
+        /// \endcond
+
+        static bool compareDistance(const std::pair<double, _T> &a, const std::pair<double, _T> &b)
+        {
+            return a.first < b.first;
+        }
+
+        /** \brief Copy the insertion buffer (the caller holds a lock on the tree) */
+        void copyBuffer(std::vector<_T> &buffer) const
+        {
+            std::lock_guard<std::mutex> block(bufferLock_);
+            buffer = buffer_;
+        }
+
+        /** \brief Fill \e candidates with the (at most) \e k elements closest to \e data,
+            paired with their distances, in increasing order of distance */
+        void collectK(const _T &data, std::size_t k, std::vector<std::pair<double, _T>> &candidates) const
+        {
+            std::vector<_T> buffer;
+            {
+                std::shared_lock<std::shared_timed_mutex> tlock(treeLock_);
+                if (tree_.size() > 0)
+                {
+                    typename Tree::NearQueue nbhQueue;
+                    tree_.withThreadContext([&](typename Tree::QueryContext &context)
+                                            { tree_.nearestKInternal(data, k, nbhQueue, context); });
+                    for (; !nbhQueue.empty(); nbhQueue.pop())
+                        candidates.emplace_back(nbhQueue.top().first, *nbhQueue.top().second);
+                }
+                copyBuffer(buffer);
+            }
+            for (const auto &b : buffer)
+                candidates.emplace_back(NearestNeighbors<_T>::distFun_(data, b), b);
+            if (candidates.size() > k)
+            {
+                std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end(), compareDistance);
+                candidates.resize(k);
+            }
+            else
+                std::sort(candidates.begin(), candidates.end(), compareDistance);
+        }
+
+        /** \brief Move the elements in the insertion buffer to the tree */
+        void mergeBuffer()
+        {
+            std::unique_lock<std::shared_timed_mutex> tlock(treeLock_);
+            std::vector<_T> merged;
+            {
+                std::lock_guard<std::mutex> block(bufferLock_);
+                // another thread may have merged the buffer in the meantime
+                if (buffer_.size() < maxBufferSize_)
+                    return;
+                merged.swap(buffer_);
+                buffer_.reserve(maxBufferSize_);
+            }
+            // no query runs until the tree holds the elements, so other threads may add to the buffer meanwhile
+            tree_.add(merged);
+        }
+
+        /** \brief The tree that holds all the elements that are not in the insertion buffer */
+        Tree tree_;
+
+        /** \brief Readers hold this lock in shared mode; merging and removal hold it exclusively */
+        mutable std::shared_timed_mutex treeLock_;
+
+        /** \brief Elements added since the last merge */
+        std::vector<_T> buffer_;
+
+        /** \brief Lock protecting \e buffer_. When both locks are needed, treeLock_ is taken first. */
+        mutable std::mutex bufferLock_;
+
+        /** \brief The number of buffered elements that triggers a merge */
+        std::size_t maxBufferSize_;
+    };
+}
+
+#endif
@@ -92,6 +92,44 @@ namespace ompl
         /// \endcond
 
     public:
+        /** \brief Reusable buffers for queries. Once its buffers have
+            grown to the sizes a tree requires, queries that are given a
+            context do not allocate memory (other than for the results,
+            when these are returned in a vector that has to grow). A
+            context must not be used by more than one query at a time;
+            the queries without a context argument use a context that is
+            local to the calling thread. */
+        class QueryContext
+        {
+        public:
+            QueryContext() = default;
+
+        private:
+            friend class NearestNeighborsGNAT;
+
+            /// Empty the queues, which may not be empty if a query was interrupted by an exception
+            void reset()
+            {
+                while (!nbhQueue_.empty())
+                    nbhQueue_.pop();
+                while (!nodeQueue_.empty())
+                    nodeQueue_.pop();
+            }
+
+            /// The near neighbors found so far, paired with their distance to the query
+            NearQueue nbhQueue_;
+            /// The nodes that remain to be searched
+            NodeQueue nodeQueue_;
+            /// The distances from the query to the pivots of the children of a node
+            std::vector<double> distToPivot_;
+            /// The order in which the children of a node are checked
+            std::vector<int> permutation_;
+            /// Used to cycle through the children of a node in different orders
+            std::size_t offset_{0};
+            /// Whether the context is used by a query of the thread that owns it
+            bool inUse_{false};
+        };
+
         NearestNeighborsGNAT(unsigned int degree = 8, unsigned int minDegree = 4, unsigned int maxDegree = 12,
                              unsigned int maxNumPtsPerLeaf = 50, unsigned int removedCacheSize = 500,
                              bool rebalancing = false
@@ -144,6 +182,11 @@ namespace ompl
             return true;
         }
 
+        bool supportsApproximateSearch() const override
+        {
+            return true;
+        }
+
         void add(const _T &data) override
         {
             if (tree_)
@@ -191,10 +234,15 @@ namespace ompl
         {
             if (size_ == 0u)
                 return false;
-            NearQueue nbhQueue;
             // find data in tree
-            bool isPivot = nearestKInternal(data, 1, nbhQueue);
-            const _T *d = nbhQueue.top().second;
+            bool isPivot = false;
+            const _T *d = nullptr;
+            withThreadContext([&](QueryContext &context) {
+                context.reset();
+                isPivot = nearestKInternal(data, 1, context.nbhQueue_, context);
+                d = context.nbhQueue_.top().second;
+                context.nbhQueue_.pop();
+            });
             if (*d != data)
                 return false;
             removed_.insert(d);
@@ -210,37 +258,83 @@ namespace ompl
         {
             if (size_)
             {
-                NearQueue nbhQueue;
-                nearestKInternal(data, 1, nbhQueue);
-                if (!nbhQueue.empty())
-                    return *nbhQueue.top().second;
+                const _T *result = nullptr;
+                withThreadContext([&](QueryContext &context) {
+                    context.reset();
+                    nearestKInternal(data, 1, context.nbhQueue_, context);
+                    if (!context.nbhQueue_.empty())
+                    {
+                        result = context.nbhQueue_.top().second;
+                        context.nbhQueue_.pop();
+                    }
+                });
+                if (result)
+                    return *result;
             }
             throw Exception("No elements found in nearest neighbors data structure");
         }
 
         /// Return the k nearest neighbors in sorted order
         void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh) const override
+        {
+            withThreadContext([&](QueryContext &context) { nearestK(data, k, nbh, context); });
+        }
+
+        /// Return the k nearest neighbors in sorted order, using the buffers of \e context
+        void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh, QueryContext &context) const
         {
             nbh.clear();
             if (k == 0)
                 return;
             if (size_)
             {
-                NearQueue nbhQueue;
-                nearestKInternal(data, k, nbhQueue);
-                postprocessNearest(nbhQueue, nbh);
+                context.reset();
+                nearestKInternal(data, k, context.nbhQueue_, context);
+                postprocessNearest(context.nbhQueue_, nbh);
             }
         }
 
+        /// \brief Write the (at most) k nearest neighbors, in sorted order, to
+        /// the array \e nbh, which must have room for \e k elements. Return
+        /// the number of neighbors found.
+        std::size_t nearestK(const _T &data, std::size_t k, _T *nbh) const
+        {
+            std::size_t count = 0;
+            withThreadContext([&](QueryContext &context) { count = nearestK(data, k, nbh, context); });
+            return count;
+        }
+
+        /// \brief Write the (at most) k nearest neighbors, in sorted order, to
+        /// the array \e nbh, which must have room for \e k elements, using the
+        /// buffers of \e context. Return the number of neighbors found.
+        std::size_t nearestK(const _T &data, std::size_t k, _T *nbh, QueryContext &context) const
+        {
+            if (k == 0 || size_ == 0)
+                return 0;
+            context.reset();
+            nearestKInternal(data, k, context.nbhQueue_, context);
+            std::size_t count = context.nbhQueue_.size();
+            for (std::size_t i = count; i > 0; --i, context.nbhQueue_.pop())
+                nbh[i - 1] = *context.nbhQueue_.top().second;
+            return count;
+        }
+
         /// Return the nearest neighbors within distance \c radius in sorted order
         void nearestR(const _T &data, double radius, std::vector<_T> &nbh) const override
+        {
+            withThreadContext([&](QueryContext &context) { nearestR(data, radius, nbh, context); });
+        }
+
+        /// \brief Return the nearest neighbors within distance \c radius in
+        /// sorted order, using the buffers of \e context
+        void nearestR(const _T &data, double radius, std::vector<_T> &nbh, QueryContext &context) const
         {
             nbh.clear();
             if (size_)
             {
-                NearQueue nbhQueue;
-                nearestRInternal(data, radius, nbhQueue);
-                postprocessNearest(nbhQueue, nbh);
+                context.reset();
+                nearestRInternal(data, radius, context.nbhQueue_, context);
+                postprocessNearest(context.nbhQueue_, nbh);
             }
         }
 
@@ -332,38 +426,44 @@ namespace ompl
         /// For k=1, return true if the nearest neighbor is a pivot.
         /// (which is important during removal; removing pivots is a
         /// special case).
-        bool nearestKInternal(const _T &data, std::size_t k, NearQueue &nbhQueue) const
+        /// The nodes still to be searched are kept in \e context.
+        bool nearestKInternal(const _T &data, std::size_t k, NearQueue &nbhQueue, QueryContext &context) const
         {
             bool isPivot;
             double dist;
             NodeDist nodeDist;
-            NodeQueue nodeQueue;
+            NodeQueue &nodeQueue = context.nodeQueue_;
+
+            // with an approximation factor, subtrees are pruned as if the current neighbors were closer
+            const double shrink = 1.0 / (1.0 + NearestNeighbors<_T>::approximationFactor_);
 
             dist = NearestNeighbors<_T>::distFun_(data, tree_->pivot_);
             isPivot = tree_->insertNeighborK(nbhQueue, k, tree_->pivot_, data, dist);
-            tree_->nearestK(*this, data, k, nbhQueue, nodeQueue, isPivot);
+            tree_->nearestK(*this, data, k, nbhQueue, context, isPivot);
             while (!nodeQueue.empty())
             {
-                dist = nbhQueue.top().first;  // note the difference with nearestRInternal
+                dist = nbhQueue.top().first * shrink;  // note the difference with nearestRInternal
                 nodeDist = nodeQueue.top();
                 nodeQueue.pop();
                 if (nbhQueue.size() == k && (nodeDist.second > nodeDist.first->maxRadius_ + dist ||
                                              nodeDist.second < nodeDist.first->minRadius_ - dist))
                     continue;
-                nodeDist.first->nearestK(*this, data, k, nbhQueue, nodeQueue, isPivot);
+                nodeDist.first->nearestK(*this, data, k, nbhQueue, context, isPivot);
             }
             return isPivot;
         }
         /// \brief Return in nbhQueue the elements that are within distance radius of data.
-        void nearestRInternal(const _T &data, double radius, NearQueue &nbhQueue) const
+        /// The nodes still to be searched are kept in \e context.
+        void nearestRInternal(const _T &data, double radius, NearQueue &nbhQueue, QueryContext &context) const
         {
-            double dist = radius;  // note the difference with nearestKInternal
-            NodeQueue nodeQueue;
+            // note the difference with nearestKInternal
+            double dist = radius / (1.0 + NearestNeighbors<_T>::approximationFactor_);
+            NodeQueue &nodeQueue = context.nodeQueue_;
             NodeDist nodeDist;
 
             tree_->insertNeighborR(nbhQueue, radius, tree_->pivot_,
                                    NearestNeighbors<_T>::distFun_(data, tree_->pivot_));
-            tree_->nearestR(*this, data, radius, nbhQueue, nodeQueue);
+            tree_->nearestR(*this, data, radius, nbhQueue, context);
             while (!nodeQueue.empty())
             {
                 nodeDist = nodeQueue.top();
@@ -371,9 +471,36 @@ namespace ompl
                 if (nodeDist.second > nodeDist.first->maxRadius_ + dist ||
                     nodeDist.second < nodeDist.first->minRadius_ - dist)
                     continue;
-                nodeDist.first->nearestR(*this, data, radius, nbhQueue, nodeQueue);
+                nodeDist.first->nearestR(*this, data, radius, nbhQueue, context);
             }
         }
+        /// \brief Call \e f with the query context of the calling thread. If
+        /// that context is in use by an enclosing query (e.g., a query made by
+        /// the distance function), a temporary context is used instead.
+        template <typename F>
+        void withThreadContext(const F &f) const
+        {
+            static thread_local QueryContext threadContext;
+            if (threadContext.inUse_)
+            {
+                QueryContext context;
+                f(context);
+                return;
+            }
+            threadContext.inUse_ = true;
+            try
+            {
+                f(threadContext);
+            }
+            catch (...)
+            {
+                threadContext.reset();
+                threadContext.inUse_ = false;
+                throw;
+            }
+            threadContext.inUse_ = false;
+        }
+
         /// \brief Convert the internal data structure used for storing neighbors
         /// to the vector that NearestNeighbor API requires.
         void postprocessNearest(NearQueue &nbhQueue, std::vector<_T> &nbh) const
@@ -540,6 +667,31 @@ namespace ompl
                         child->split(gnat);
             }
 
+            /// \brief Compute the distances from data to the elements stored in this node
+            /// and call f(element, distance) for those not marked for removal. If a
+            /// batched distance function is set, the distances are computed in blocks.
+            template <typename Function>
+            void scanData(const GNAT &gnat, const _T &data, Function &&f) const
+            {
+                if (gnat.batchDistFun_)
+                {
+                    const std::size_t blockSize = 64;
+                    double dist[blockSize];
+                    for (std::size_t start = 0; start < data_.size(); start += blockSize)
+                    {
+                        std::size_t n = std::min(blockSize, data_.size() - start);
+                        gnat.batchDistFun_(data, data_.data() + start, n, dist);
+                        for (std::size_t i = 0; i < n; ++i)
+                            if (!gnat.isRemoved(data_[start + i]))
+                                f(data_[start + i], dist[i]);
+                    }
+                }
+                else
+                    for (const auto &d : data_)
+                        if (!gnat.isRemoved(d))
+                            f(d, gnat.distFun_(data, d));
+            }
+
             /// Insert data in nbh if it is a near neighbor. Return true iff data was added to nbh.
             bool insertNeighborK(NearQueue &nbh, std::size_t k, const _T &data, const _T &key, double dist) const
             {
@@ -560,24 +712,25 @@ namespace ompl
             /// \brief Compute the k nearest neighbors of data in the tree.
             /// For k=1, isPivot is true if the nearest neighbor is a pivot
             /// (which is important during removal; removing pivots is a
-            /// special case). The nodeQueue, which contains other Nodes
-            /// that need to be checked for nearest neighbors, is updated.
-            void nearestK(const GNAT &gnat, const _T &data, std::size_t k, NearQueue &nbh, NodeQueue &nodeQueue,
+            /// special case). The node queue of the context, which contains other
+            /// Nodes that need to be checked for nearest neighbors, is updated.
+            void nearestK(const GNAT &gnat, const _T &data, std::size_t k, NearQueue &nbh, QueryContext &context,
                           bool &isPivot) const
             {
-                for (const auto &d : data_)
-                    if (!gnat.isRemoved(d))
-                    {
-                        if (insertNeighborK(nbh, k, d, data, gnat.distFun_(data, d)))
-                            isPivot = false;
-                    }
+                scanData(gnat, data, [&](const _T &d, double dist) {
+                    if (insertNeighborK(nbh, k, d, data, dist))
+                        isPivot = false;
+                });
                 if (!children_.empty())
                 {
                     double dist;
                     Node *child;
-                    std::size_t sz = children_.size(), offset = gnat.offset_++;
-                    std::vector<double> distToPivot(sz);
-                    std::vector<int> permutation(sz);
+                    std::size_t sz = children_.size(), offset = context.offset_++;
+                    std::vector<double> &distToPivot = context.distToPivot_;
+                    std::vector<int> &permutation = context.permutation_;
+                    distToPivot.resize(sz);
+                    permutation.resize(sz);
+                    const double shrink = 1.0 / (1.0 + gnat.approximationFactor_);
                     for (unsigned int i = 0; i < sz; ++i)
                         permutation[i] = (i + offset) % sz;
 
@@ -590,7 +743,7 @@ namespace ompl
                                 isPivot = true;
                             if (nbh.size() == k)
                             {
-                                dist = nbh.top().first;  // note difference with nearestR
+                                dist = nbh.top().first * shrink;  // note difference with nearestR
                                 for (unsigned int j = 0; j < sz; ++j)
                                     if (permutation[j] >= 0 && i != j &&
                                         (distToPivot[permutation[i]] - dist > child->maxRange_[permutation[j]] ||
@@ -599,14 +752,14 @@ namespace ompl
                             }
                         }
 
-                    dist = nbh.top().first;
+                    dist = nbh.top().first * shrink;
                     for (auto p : permutation)
                         if (p >= 0)
                         {
                             child = children_[p];
                             if (nbh.size() < k || (distToPivot[p] - dist <= child->maxRadius_ &&
                                                    distToPivot[p] + dist >= child->minRadius_))
-                                nodeQueue.emplace(child, distToPivot[p]);
+                                context.nodeQueue_.emplace(child, distToPivot[p]);
                         }
                 }
             }
@@ -617,21 +770,21 @@ namespace ompl
                     nbh.emplace(dist, &data);
             }
             /// \brief Return all elements that are within distance r in nbh.
-            /// The nodeQueue, which contains other Nodes that need to
-            /// be checked for nearest neighbors, is updated.
-            void nearestR(const GNAT &gnat, const _T &data, double r, NearQueue &nbh, NodeQueue &nodeQueue) const
+            /// The node queue of the context, which contains other Nodes that need
+            /// to be checked for nearest neighbors, is updated.
+            void nearestR(const GNAT &gnat, const _T &data, double r, NearQueue &nbh, QueryContext &context) const
             {
-                double dist = r;  // note difference with nearestK
+                double dist = r / (1.0 + gnat.approximationFactor_);  // note difference with nearestK
 
-                for (const auto &d : data_)
-                    if (!gnat.isRemoved(d))
-                        insertNeighborR(nbh, r, d, gnat.distFun_(data, d));
+                scanData(gnat, data, [&](const _T &d, double dist) { insertNeighborR(nbh, r, d, dist); });
                 if (!children_.empty())
                 {
                     Node *child;
-                    std::size_t sz = children_.size(), offset = gnat.offset_++;
-                    std::vector<double> distToPivot(sz);
-                    std::vector<int> permutation(sz);
+                    std::size_t sz = children_.size(), offset = context.offset_++;
+                    std::vector<double> &distToPivot = context.distToPivot_;
+                    std::vector<int> &permutation = context.permutation_;
+                    distToPivot.resize(sz);
+                    permutation.resize(sz);
                     // Not a random permutation, but processing the children in slightly different order is
                     // "good enough" to get a performance boost. A call to std::shuffle takes too long.
                     for (unsigned int i = 0; i < sz; ++i)
@@ -656,7 +809,7 @@ namespace ompl
                             child = children_[p];
                             if (distToPivot[p] - dist <= child->maxRadius_ &&
                                 distToPivot[p] + dist >= child->minRadius_)
-                                nodeQueue.emplace(child, distToPivot[p]);
+                                context.nodeQueue_.emplace(child, distToPivot[p]);
                         }
                 }
             }
@@ -795,11 +948,6 @@ namespace ompl
         /// \brief Estimated dimension of the local free space.
         double estimatedDimension_;
 #endif
-
-        /// \cond IGNORE
-        // used to cycle through children of a node in different orders
-        mutable std::size_t offset_{0};
-        /// \endcond
     };
 }
 
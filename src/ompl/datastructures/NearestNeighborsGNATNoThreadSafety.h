@@ -132,6 +132,11 @@ namespace ompl
             return true;
         }
 
+        bool supportsApproximateSearch() const override
+        {
+            return true;
+        }
+
         void add(const _T &data) override
         {
             if (tree_)
@@ -327,13 +332,15 @@ namespace ompl
             bool isPivot;
             double dist;
             Node *node;
+            // with an approximation factor, subtrees are pruned as if the current neighbors were closer
+            const double shrink = 1.0 / (1.0 + NearestNeighbors<_T>::approximationFactor_);
 
             tree_->distToPivot_ = NearestNeighbors<_T>::distFun_(data, tree_->pivot_);
             isPivot = tree_->insertNeighborK(nearQueue_, k, tree_->pivot_, data, tree_->distToPivot_);
             tree_->nearestK(*this, data, k, isPivot);
             while (!nodeQueue_.empty())
             {
-                dist = nearQueue_.top().first;  // note the difference with nearestRInternal
+                dist = nearQueue_.top().first * shrink;  // note the difference with nearestRInternal
                 node = nodeQueue_.top();
                 nodeQueue_.pop();
                 if (nearQueue_.size() == k &&
@@ -346,7 +353,8 @@ namespace ompl
         /// \brief Return in nearQueue_ the elements that are within distance radius of data.
         void nearestRInternal(const _T &data, double radius) const
         {
-            double dist = radius;  // note the difference with nearestKInternal
+            // note the difference with nearestKInternal
+            double dist = radius / (1.0 + NearestNeighbors<_T>::approximationFactor_);
             Node *node;
 
             tree_->insertNeighborR(nearQueue_, radius, tree_->pivot_,
@@ -526,6 +534,31 @@ namespace ompl
                         child->split(gnat);
             }
 
+            /// \brief Compute the distances from data to the elements stored in this node
+            /// and call f(element, distance) for those not marked for removal. If a
+            /// batched distance function is set, the distances are computed in blocks.
+            template <typename Function>
+            void scanData(const GNAT &gnat, const _T &data, Function &&f) const
+            {
+                if (gnat.batchDistFun_)
+                {
+                    const std::size_t blockSize = 64;
+                    double dist[blockSize];
+                    for (std::size_t start = 0; start < data_.size(); start += blockSize)
+                    {
+                        std::size_t n = std::min(blockSize, data_.size() - start);
+                        gnat.batchDistFun_(data, data_.data() + start, n, dist);
+                        for (std::size_t i = 0; i < n; ++i)
+                            if (!gnat.isRemoved(data_[start + i]))
+                                f(data_[start + i], dist[i]);
+                    }
+                }
+                else
+                    for (const auto &d : data_)
+                        if (!gnat.isRemoved(d))
+                            f(d, gnat.distFun_(data, d));
+            }
+
             /// Insert data in nbh if it is a near neighbor. Return true iff data was added to nbh.
             bool insertNeighborK(NearQueue &nbh, std::size_t k, const _T &data, const _T &key, double dist) const
             {
@@ -550,18 +583,17 @@ namespace ompl
             void nearestK(const GNAT &gnat, const _T &data, std::size_t k, bool &isPivot) const
             {
                 NearQueue &nbh = gnat.nearQueue_;
-                for (const auto &d : data_)
-                    if (!gnat.isRemoved(d))
-                    {
-                        if (insertNeighborK(nbh, k, d, data, gnat.distFun_(data, d)))
-                            isPivot = false;
-                    }
+                scanData(gnat, data, [&](const _T &d, double dist) {
+                    if (insertNeighborK(nbh, k, d, data, dist))
+                        isPivot = false;
+                });
                 if (!children_.empty())
                 {
                     double dist;
                     Node *child;
                     Permutation &permutation = gnat.permutation_;
                     permutation.permute(children_.size());
+                    const double shrink = 1.0 / (1.0 + gnat.approximationFactor_);
 
                     for (unsigned int i = 0; i < children_.size(); ++i)
                         if (permutation[i] >= 0)
@@ -572,7 +604,7 @@ namespace ompl
                                 isPivot = true;
                             if (nbh.size() == k)
                             {
-                                dist = nbh.top().first;  // note difference with nearestR
+                                dist = nbh.top().first * shrink;  // note difference with nearestR
                                 for (unsigned int j = 0; j < children_.size(); ++j)
                                     if (permutation[j] >= 0 && i != j &&
                                         (child->distToPivot_ - dist > child->maxRange_[permutation[j]] ||
@@ -581,7 +613,7 @@ namespace ompl
                             }
                         }
 
-                    dist = nbh.top().first;
+                    dist = nbh.top().first * shrink;
                     for (unsigned int i = 0; i < children_.size(); ++i)
                         if (permutation[i] >= 0)
                         {
@@ -602,11 +634,9 @@ namespace ompl
             void nearestR(const GNAT &gnat, const _T &data, double r) const
             {
                 NearQueue &nbh = gnat.nearQueue_;
-                double dist = r;  // note difference with nearestK
+                double dist = r / (1.0 + gnat.approximationFactor_);  // note difference with nearestK
 
-                for (const auto &d : data_)
-                    if (!gnat.isRemoved(d))
-                        insertNeighborR(nbh, r, d, gnat.distFun_(data, d));
+                scanData(gnat, data, [&](const _T &d, double dist) { insertNeighborR(nbh, r, d, dist); });
                 if (!children_.empty())
                 {
                     Node *child;
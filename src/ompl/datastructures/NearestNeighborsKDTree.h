@@ -0,0 +1,537 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_KD_TREE_
+#define OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_KD_TREE_
+
+#include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/base/StateSpace.h"
+#include "ompl/util/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief A kd-tree over the packed coordinates of states
+        (see base::StateSpace::packState()).
+
+        The tree is intended for low-dimensional spaces whose states
+        are described by a few real values: RealVectorStateSpace,
+        SO2StateSpace, SO3StateSpace and compound spaces made of them,
+        such as SE2StateSpace and SE3StateSpace. Each node stores the
+        bounding box of the coordinates in its subtree, and searches
+        skip subtrees for which
+        base::StateSpace::packedDistanceLowerBound() shows that no
+        closer element can exist. The bound takes the wrap-around of
+        angles and the double cover of rotations by quaternions into
+        account, so results are exact with respect to the distance
+        function of the datastructure, which must equal the distance
+        in the state space.
+
+        \li New elements are inserted into the leaf they fall into; a
+        leaf that becomes too large is split. The tree is rebuilt,
+        balanced, whenever the number of elements doubles since the
+        last build.
+        \li Removing an element leaves the bounding boxes unchanged;
+        the tree is rebuilt once more than half of the stored elements
+        have been removed.
+        \li Queries do not modify the tree, so they can run
+        concurrently with each other (but not with add or remove). */
+    template <typename _T>
+    class NearestNeighborsKDTree : public NearestNeighbors<_T>
+    {
+    public:
+        /** \brief The function used to access the state represented by an element */
+        using StateFunction = std::function<const base::State *(const _T &)>;
+
+        /** \brief Constructor. Elements are located in the tree by the
+            coordinates of the state \e stateFn returns for them, which
+            must be a state of \e space. Leaves hold up to \e
+            maxLeafSize elements. */
+        NearestNeighborsKDTree(base::StateSpacePtr space, StateFunction stateFn, unsigned int maxLeafSize = 16)
+          : NearestNeighbors<_T>()
+          , space_(std::move(space))
+          , stateFn_(std::move(stateFn))
+          , dim_(space_->getPackedValueCount())
+          , maxLeafSize_(std::max(1u, maxLeafSize))
+        {
+            if (dim_ == 0)
+                throw Exception("NearestNeighborsKDTree", "State space " + space_->getName() +
+                                                              " does not support packing states");
+        }
+
+        ~NearestNeighborsKDTree() override = default;
+
+        /** \brief Return true if the tree can be used for states in \e space */
+        static bool isSpaceSupported(const base::StateSpacePtr &space)
+        {
+            return space->getPackedValueCount() > 0;
+        }
+
+        void clear() override
+        {
+            data_.clear();
+            coords_.clear();
+            alive_.clear();
+            nodes_.clear();
+            boxes_.clear();
+            size_ = 0;
+            builtSize_ = 0;
+        }
+
+        bool reportsSortedResults() const override
+        {
+            return true;
+        }
+
+        bool supportsApproximateSearch() const override
+        {
+            return true;
+        }
+
+        void add(const _T &data) override
+        {
+            std::size_t index = append(data);
+            if (size_ > 2 * builtSize_)
+                rebuild();
+            else
+                insert(index);
+        }
+
+        void add(const std::vector<_T> &data) override
+        {
+            if (data.empty())
+                return;
+            data_.reserve(data_.size() + data.size());
+            coords_.reserve(coords_.size() + data.size() * dim_);
+            std::size_t first = data_.size();
+            for (const auto &d : data)
+                append(d);
+            if (size_ > 2 * builtSize_)
+                rebuild();
+            else
+                for (std::size_t i = first; i < data_.size(); ++i)
+                    insert(i);
+        }
+
+        bool remove(const _T &data) override
+        {
+            if (size_ == 0)
+                return false;
+            std::vector<double> point(dim_);
+            space_->packState(stateFn_(data), point.data(), 1);
+            if (!removeFrom(0, point.data(), data))
+                return false;
+            --size_;
+            if (size_ == 0)
+                clear();
+            else if (2 * size_ < data_.size())
+                rebuild();
+            return true;
+        }
+
+        _T nearest(const _T &data) const override
+        {
+            std::vector<_T> nbh;
+            nearestK(data, 1, nbh);
+            if (nbh.empty())
+                throw Exception("No elements found in nearest neighbors data structure");
+            return nbh[0];
+        }
+
+        void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh) const override
+        {
+            nbh.clear();
+            if (k == 0 || size_ == 0)
+                return;
+            std::vector<double> point(dim_);
+            space_->packState(stateFn_(data), point.data(), 1);
+            NearQueue nbhQueue;
+            searchK(0, data, point.data(), k, 1.0 + NearestNeighbors<_T>::approximationFactor_, nbhQueue);
+            nbh.resize(nbhQueue.size());
+            for (std::size_t i = nbh.size(); i > 0; --i)
+            {
+                nbh[i - 1] = data_[nbhQueue.top().second];
+                nbhQueue.pop();
+            }
+        }
+
+        void nearestR(const _T &data, double radius, std::vector<_T> &nbh) const override
+        {
+            nbh.clear();
+            if (size_ == 0)
+                return;
+            std::vector<double> point(dim_);
+            space_->packState(stateFn_(data), point.data(), 1);
+            std::vector<std::pair<double, std::size_t>> found;
+            searchR(0, data, point.data(), radius, radius / (1.0 + NearestNeighbors<_T>::approximationFactor_),
+                    found);
+            std::sort(found.begin(), found.end());
+            nbh.reserve(found.size());
+            for (const auto &f : found)
+                nbh.push_back(data_[f.second]);
+        }
+
+        std::size_t size() const override
+        {
+            return size_;
+        }
+
+        void list(std::vector<_T> &data) const override
+        {
+            data.clear();
+            data.reserve(size_);
+            for (std::size_t i = 0; i < data_.size(); ++i)
+                if (alive_[i])
+                    data.push_back(data_[i]);
+        }
+
+    protected:
+        /** \brief A node of the tree. Inner nodes split their elements
+            at \e splitValue along coordinate \e splitDim; leaves keep
+            the indices of their elements. */
+        struct Node
+        {
+            std::size_t left{0};
+            std::size_t right{0};
+            unsigned int splitDim{0};
+            double splitValue{0.0};
+            bool leaf{true};
+            std::vector<std::size_t> elements;
+        };
+
+        /** \brief Max-heap of (distance, element index) pairs, used for k-nearest neighbor searches */
+        using NearQueue = std::priority_queue<std::pair<double, std::size_t>>;
+
+        /** \brief Store \e data and its coordinates, without inserting it in the tree */
+        std::size_t append(const _T &data)
+        {
+            std::size_t index = data_.size();
+            data_.push_back(data);
+            alive_.push_back(true);
+            coords_.resize(coords_.size() + dim_);
+            space_->packState(stateFn_(data), &coords_[index * dim_], 1);
+            ++size_;
+            return index;
+        }
+
+        /** \brief The coordinates of the element with index \e index */
+        const double *point(std::size_t index) const
+        {
+            return &coords_[index * dim_];
+        }
+
+        /** \brief The lower corner of the bounding box of \e node */
+        const double *low(std::size_t node) const
+        {
+            return &boxes_[2 * node * dim_];
+        }
+
+        /** \brief The upper corner of the bounding box of \e node */
+        const double *high(std::size_t node) const
+        {
+            return &boxes_[(2 * node + 1) * dim_];
+        }
+
+        /** \brief Add a node with the bounding box of \e count elements */
+        std::size_t makeNode(const std::size_t *elements, std::size_t count)
+        {
+            std::size_t node = nodes_.size();
+            nodes_.emplace_back();
+            boxes_.resize(boxes_.size() + 2 * dim_);
+            double *lo = &boxes_[2 * node * dim_], *hi = lo + dim_;
+            std::fill(lo, hi, std::numeric_limits<double>::infinity());
+            std::fill(hi, hi + dim_, -std::numeric_limits<double>::infinity());
+            for (std::size_t i = 0; i < count; ++i)
+                expandBox(node, point(elements[i]));
+            return node;
+        }
+
+        /** \brief Grow the bounding box of \e node to contain \e p */
+        void expandBox(std::size_t node, const double *p)
+        {
+            double *lo = &boxes_[2 * node * dim_], *hi = lo + dim_;
+            for (unsigned int j = 0; j < dim_; ++j)
+            {
+                lo[j] = std::min(lo[j], p[j]);
+                hi[j] = std::max(hi[j], p[j]);
+            }
+        }
+
+        /** \brief The coordinate along which the bounding box of \e node is widest, or dim_ if it is a point */
+        unsigned int widestDimension(std::size_t node) const
+        {
+            unsigned int best = dim_;
+            double bestSpread = 0.0;
+            for (unsigned int j = 0; j < dim_; ++j)
+            {
+                double spread = high(node)[j] - low(node)[j];
+                if (spread > bestSpread)
+                {
+                    bestSpread = spread;
+                    best = j;
+                }
+            }
+            return best;
+        }
+
+        /** \brief Discard removed elements and build a balanced tree over the remaining ones */
+        void rebuild()
+        {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < data_.size(); ++i)
+                if (alive_[i])
+                {
+                    if (n != i)
+                    {
+                        data_[n] = data_[i];
+                        std::copy(point(i), point(i) + dim_, &coords_[n * dim_]);
+                    }
+                    ++n;
+                }
+            data_.resize(n);
+            coords_.resize(n * dim_);
+            alive_.assign(n, true);
+
+            nodes_.clear();
+            boxes_.clear();
+            std::vector<std::size_t> elements(n);
+            for (std::size_t i = 0; i < n; ++i)
+                elements[i] = i;
+            build(elements.data(), n);
+            builtSize_ = size_ = n;
+        }
+
+        /** \brief Build the subtree for \e count elements and return the index of its root */
+        std::size_t build(std::size_t *elements, std::size_t count)
+        {
+            std::size_t node = makeNode(elements, count);
+            unsigned int d = count > maxLeafSize_ ? widestDimension(node) : dim_;
+            if (d == dim_)
+            {
+                nodes_[node].elements.assign(elements, elements + count);
+                return node;
+            }
+            std::size_t mid = count / 2;
+            std::nth_element(elements, elements + mid, elements + count, [this, d](std::size_t a, std::size_t b)
+                             { return point(a)[d] < point(b)[d]; });
+            double splitValue = point(elements[mid])[d];
+            std::size_t left = build(elements, mid);
+            std::size_t right = build(elements + mid, count - mid);
+            Node &n = nodes_[node];
+            n.leaf = false;
+            n.splitDim = d;
+            n.splitValue = splitValue;
+            n.left = left;
+            n.right = right;
+            return node;
+        }
+
+        /** \brief Insert the element with index \e index in the leaf it falls into */
+        void insert(std::size_t index)
+        {
+            const double *p = point(index);
+            std::size_t node = 0;
+            while (true)
+            {
+                expandBox(node, p);
+                if (nodes_[node].leaf)
+                    break;
+                node = p[nodes_[node].splitDim] < nodes_[node].splitValue ? nodes_[node].left : nodes_[node].right;
+            }
+            nodes_[node].elements.push_back(index);
+            if (nodes_[node].elements.size() > maxLeafSize_)
+                split(node);
+        }
+
+        /** \brief Split a leaf that holds too many elements at the median of its widest coordinate */
+        void split(std::size_t node)
+        {
+            unsigned int d = widestDimension(node);
+            if (d == dim_)
+                return;
+            std::vector<std::size_t> elements;
+            elements.swap(nodes_[node].elements);
+            std::size_t mid = elements.size() / 2;
+            std::nth_element(elements.begin(), elements.begin() + mid, elements.end(),
+                             [this, d](std::size_t a, std::size_t b) { return point(a)[d] < point(b)[d]; });
+            double splitValue = point(elements[mid])[d];
+            auto middle = std::partition(elements.begin(), elements.end(),
+                                         [this, d, splitValue](std::size_t e) { return point(e)[d] < splitValue; });
+            // if the median is also the smallest value, move the elements equal to it to the left instead
+            if (middle == elements.begin())
+            {
+                middle = std::partition(elements.begin(), elements.end(),
+                                        [this, d, splitValue](std::size_t e) { return point(e)[d] <= splitValue; });
+                splitValue = std::nextafter(splitValue, std::numeric_limits<double>::infinity());
+                // the box may be wider than the remaining elements after removals; they may not be separable
+                if (middle == elements.end())
+                {
+                    nodes_[node].elements.swap(elements);
+                    return;
+                }
+            }
+            std::size_t nLeft = middle - elements.begin();
+            std::size_t left = makeNode(elements.data(), nLeft);
+            std::size_t right = makeNode(elements.data() + nLeft, elements.size() - nLeft);
+            nodes_[left].elements.assign(elements.begin(), middle);
+            nodes_[right].elements.assign(middle, elements.end());
+            Node &n = nodes_[node];
+            n.leaf = false;
+            n.splitDim = d;
+            n.splitValue = splitValue;
+            n.left = left;
+            n.right = right;
+        }
+
+        /** \brief Remove \e data from the subtree of \e node, whose bounding box must contain \e p */
+        bool removeFrom(std::size_t node, const double *p, const _T &data)
+        {
+            const double *lo = low(node), *hi = high(node);
+            for (unsigned int j = 0; j < dim_; ++j)
+                if (p[j] < lo[j] || p[j] > hi[j])
+                    return false;
+            Node &n = nodes_[node];
+            if (!n.leaf)
+                return removeFrom(n.left, p, data) || removeFrom(n.right, p, data);
+            for (auto it = n.elements.begin(); it != n.elements.end(); ++it)
+                if (data_[*it] == data)
+                {
+                    alive_[*it] = false;
+                    n.elements.erase(it);
+                    return true;
+                }
+            return false;
+        }
+
+        /** \brief Search the subtree of \e node for the \e k nearest neighbors of \e data. Subtrees are skipped
+            if their distance lower bound, multiplied by \e inflate, exceeds the distance of the k-th neighbor. */
+        void searchK(std::size_t node, const _T &data, const double *p, std::size_t k, double inflate,
+                     NearQueue &nbhQueue) const
+        {
+            const Node &n = nodes_[node];
+            if (n.leaf)
+            {
+                for (std::size_t e : n.elements)
+                {
+                    double dist = NearestNeighbors<_T>::distFun_(data, data_[e]);
+                    if (nbhQueue.size() < k)
+                        nbhQueue.emplace(dist, e);
+                    else if (dist < nbhQueue.top().first)
+                    {
+                        nbhQueue.pop();
+                        nbhQueue.emplace(dist, e);
+                    }
+                }
+                return;
+            }
+            double boundLeft = inflate * space_->packedDistanceLowerBound(p, low(n.left), high(n.left));
+            double boundRight = inflate * space_->packedDistanceLowerBound(p, low(n.right), high(n.right));
+            std::size_t first = n.left, second = n.right;
+            if (boundRight < boundLeft)
+            {
+                std::swap(first, second);
+                std::swap(boundLeft, boundRight);
+            }
+            if (nbhQueue.size() < k || boundLeft <= nbhQueue.top().first)
+                searchK(first, data, p, k, inflate, nbhQueue);
+            if (nbhQueue.size() < k || boundRight <= nbhQueue.top().first)
+                searchK(second, data, p, k, inflate, nbhQueue);
+        }
+
+        /** \brief Collect the elements of the subtree of \e node within distance \e radius of \e data.
+            Subtrees are skipped if their distance lower bound exceeds \e pruneRadius. */
+        void searchR(std::size_t node, const _T &data, const double *p, double radius, double pruneRadius,
+                     std::vector<std::pair<double, std::size_t>> &found) const
+        {
+            const Node &n = nodes_[node];
+            if (n.leaf)
+            {
+                for (std::size_t e : n.elements)
+                {
+                    double dist = NearestNeighbors<_T>::distFun_(data, data_[e]);
+                    if (dist <= radius)
+                        found.emplace_back(dist, e);
+                }
+                return;
+            }
+            if (space_->packedDistanceLowerBound(p, low(n.left), high(n.left)) <= pruneRadius)
+                searchR(n.left, data, p, radius, pruneRadius, found);
+            if (space_->packedDistanceLowerBound(p, low(n.right), high(n.right)) <= pruneRadius)
+                searchR(n.right, data, p, radius, pruneRadius, found);
+        }
+
+        /** \brief The space whose packed coordinates are indexed */
+        base::StateSpacePtr space_;
+
+        /** \brief Access to the state of each element */
+        StateFunction stateFn_;
+
+        /** \brief The number of packed coordinates per state */
+        unsigned int dim_;
+
+        /** \brief The maximum number of elements in a leaf */
+        unsigned int maxLeafSize_;
+
+        /** \brief The stored elements, including removed ones until the next rebuild */
+        std::vector<_T> data_;
+
+        /** \brief The packed coordinates of the elements in data_, dim_ values per element */
+        std::vector<double> coords_;
+
+        /** \brief Flags marking the elements in data_ that have not been removed */
+        std::vector<bool> alive_;
+
+        /** \brief The nodes of the tree; the root is the first one */
+        std::vector<Node> nodes_;
+
+        /** \brief The bounding boxes of the nodes: the lower corner followed by the upper corner, dim_
+            values each */
+        std::vector<double> boxes_;
+
+        /** \brief The number of elements that have not been removed */
+        std::size_t size_{0};
+
+        /** \brief The number of elements in the tree when it was last rebuilt */
+        std::size_t builtSize_{0};
+    };
+}
+
+#endif
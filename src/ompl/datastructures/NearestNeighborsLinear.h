@@ -65,6 +65,7 @@ namespace ompl
         void clear() override
         {
             data_.clear();
+            packed_.clear();
         }
 
         bool reportsSortedResults() const override
@@ -72,15 +73,25 @@ namespace ompl
             return true;
         }
 
+        void setPackedDistance(const typename NearestNeighbors<_T>::PackedDistance &packedDist) override
+        {
+            NearestNeighbors<_T>::setPackedDistance(packedDist);
+            packed_.clear();
+            pack(0);
+        }
+
         void add(const _T &data) override
         {
             data_.push_back(data);
+            pack(data_.size() - 1);
         }
 
         void add(const std::vector<_T> &data) override
         {
+            const std::size_t first = data_.size();
             data_.reserve(data_.size() + data.size());
             data_.insert(data_.end(), data.begin(), data.end());
+            pack(first);
         }
 
         bool remove(const _T &data) override
@@ -90,6 +101,7 @@ namespace ompl
                     if (data_[i] == data)
                     {
                         data_.erase(data_.begin() + i);
+                        pack(i);
                         return true;
                     }
             return false;
@@ -100,15 +112,31 @@ namespace ompl
             const std::size_t sz = data_.size();
             std::size_t pos = sz;
             double dmin = 0.0;
-            for (std::size_t i = 0; i < sz; ++i)
+            if (usesDistanceBlocks())
             {
-                double distance = NearestNeighbors<_T>::distFun_(data_[i], data);
-                if (pos == sz || dmin > distance)
+                double dist[BLOCK_SIZE];
+                for (std::size_t start = 0; start < sz; start += BLOCK_SIZE)
                 {
-                    pos = i;
-                    dmin = distance;
+                    std::size_t n = std::min(BLOCK_SIZE, sz - start);
+                    blockDistances(data, start, n, dist);
+                    for (std::size_t i = 0; i < n; ++i)
+                        if (pos == sz || dmin > dist[i])
+                        {
+                            pos = start + i;
+                            dmin = dist[i];
+                        }
                 }
             }
+            else
+                for (std::size_t i = 0; i < sz; ++i)
+                {
+                    double distance = NearestNeighbors<_T>::distFun_(data_[i], data);
+                    if (pos == sz || dmin > distance)
+                    {
+                        pos = i;
+                        dmin = distance;
+                    }
+                }
             if (pos != sz)
                 return data_[pos];
 
@@ -118,6 +146,15 @@ namespace ompl
         /// Return the k nearest neighbors in sorted order
         void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh) const override
         {
+            if (usesDistanceBlocks())
+            {
+                const std::vector<std::size_t> &order = computeSortedOrder(data, k);
+                nbh.clear();
+                nbh.reserve(order.size());
+                for (std::size_t i : order)
+                    nbh.push_back(data_[i]);
+                return;
+            }
             nbh = data_;
             if (nbh.size() > k)
             {
@@ -135,6 +172,18 @@ namespace ompl
         void nearestR(const _T &data, double radius, std::vector<_T> &nbh) const override
         {
             nbh.clear();
+            if (usesDistanceBlocks())
+            {
+                const std::vector<std::size_t> &order = computeSortedOrder(data, data_.size());
+                const std::vector<double> &dist = scratch().dist;
+                for (std::size_t i : order)
+                {
+                    if (dist[i] > radius)
+                        break;
+                    nbh.push_back(data_[i]);
+                }
+                return;
+            }
             for (const auto &d : data_)
                 if (NearestNeighbors<_T>::distFun_(d, data) <= radius)
                     nbh.push_back(d);
@@ -152,10 +201,118 @@ namespace ompl
         }
 
     protected:
+        /** \brief The number of elements whose distances are computed at once */
+        static constexpr std::size_t BLOCK_SIZE = 64;
+
         /** \brief The data elements stored in this structure */
         std::vector<_T> data_;
 
+        /** \brief Return true if distances are computed for blocks of elements, with the packed values of the
+            elements or the batched distance function */
+        bool usesDistanceBlocks() const
+        {
+            return NearestNeighbors<_T>::packedDist_.valueCount > 0 || NearestNeighbors<_T>::batchDistFun_;
+        }
+
+        /** \brief Compute the distances from \e data to the \e n elements starting at \e start. The elements
+            must be in the same block: \e start is a multiple of BLOCK_SIZE and \e n is at most BLOCK_SIZE. */
+        void blockDistances(const _T &data, std::size_t start, std::size_t n, double *dist) const
+        {
+            const auto &packedDist = NearestNeighbors<_T>::packedDist_;
+            if (packedDist.valueCount > 0)
+                packedDist.distances(data, packed_.data() + start * packedDist.valueCount, BLOCK_SIZE, n, dist);
+            else
+                NearestNeighbors<_T>::batchDistFun_(data, data_.data() + start, n, dist);
+        }
+
+        /** \brief Compute the distances from \e data to the \e n elements at \e indices, with \e n at most
+            BLOCK_SIZE. The values of the elements are gathered into one block first. */
+        void gatheredDistances(const _T &data, const std::size_t *indices, std::size_t n, double *dist) const
+        {
+            const auto &packedDist = NearestNeighbors<_T>::packedDist_;
+            if (packedDist.valueCount > 0)
+            {
+                std::vector<double> &gathered = scratch().gathered;
+                gathered.resize(BLOCK_SIZE * packedDist.valueCount);
+                for (std::size_t j = 0; j < packedDist.valueCount; ++j)
+                    for (std::size_t i = 0; i < n; ++i)
+                        gathered[j * BLOCK_SIZE + i] = packed_[packedIndex(indices[i]) + j * BLOCK_SIZE];
+                packedDist.distances(data, gathered.data(), BLOCK_SIZE, n, dist);
+            }
+            else if (NearestNeighbors<_T>::batchDistFun_)
+            {
+                std::vector<_T> &gathered = scratch().elements;
+                gathered.clear();
+                for (std::size_t i = 0; i < n; ++i)
+                    gathered.push_back(data_[indices[i]]);
+                NearestNeighbors<_T>::batchDistFun_(data, gathered.data(), n, dist);
+            }
+            else
+                for (std::size_t i = 0; i < n; ++i)
+                    dist[i] = NearestNeighbors<_T>::distFun_(data_[indices[i]], data);
+        }
+
     private:
+        /** \brief Get the index in \e packed_ of the first value of element \e i */
+        std::size_t packedIndex(std::size_t i) const
+        {
+            return (i / BLOCK_SIZE) * BLOCK_SIZE * NearestNeighbors<_T>::packedDist_.valueCount + i % BLOCK_SIZE;
+        }
+
+        /** \brief Store the packed values of the elements from index \e first on */
+        void pack(std::size_t first)
+        {
+            const auto &packedDist = NearestNeighbors<_T>::packedDist_;
+            if (packedDist.valueCount == 0)
+                return;
+            const std::size_t blocks = (data_.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            packed_.resize(blocks * BLOCK_SIZE * packedDist.valueCount);
+            for (std::size_t i = first; i < data_.size(); ++i)
+                packedDist.pack(data_[i], &packed_[packedIndex(i)], BLOCK_SIZE);
+        }
+
+        /** \brief Buffers reused by the queries of a thread */
+        struct Scratch
+        {
+            std::vector<double> dist;
+            std::vector<std::size_t> order;
+            std::vector<double> gathered;
+            std::vector<_T> elements;
+        };
+
+        /** \brief Get the buffers of the calling thread. They are not members so that concurrent queries on a
+            datastructure that is not modified remain safe. */
+        static Scratch &scratch()
+        {
+            static thread_local Scratch s;
+            return s;
+        }
+
+        /** \brief Compute the distances from \e data to all stored elements and return the indices of the (at
+            most) \e k closest elements, in increasing order of distance. The distances are left in
+            scratch().dist. */
+        const std::vector<std::size_t> &computeSortedOrder(const _T &data, std::size_t k) const
+        {
+            Scratch &s = scratch();
+            const std::size_t sz = data_.size();
+            s.dist.resize(sz);
+            for (std::size_t start = 0; start < sz; start += BLOCK_SIZE)
+                blockDistances(data, start, std::min(BLOCK_SIZE, sz - start), s.dist.data() + start);
+            s.order.resize(sz);
+            for (std::size_t i = 0; i < sz; ++i)
+                s.order[i] = i;
+            const std::vector<double> &dist = s.dist;
+            auto cmp = [&dist](std::size_t a, std::size_t b) { return dist[a] < dist[b]; };
+            if (sz > k)
+            {
+                std::partial_sort(s.order.begin(), s.order.begin() + k, s.order.end(), cmp);
+                s.order.resize(k);
+            }
+            else
+                std::sort(s.order.begin(), s.order.end(), cmp);
+            return s.order;
+        }
+
         struct ElemSort
         {
             ElemSort(const _T &e, const typename NearestNeighbors<_T>::DistanceFunction &df) : e_(e), df_(df)
@@ -170,7 +327,14 @@ namespace ompl
             const _T &e_;
             const typename NearestNeighbors<_T>::DistanceFunction &df_;
         };
+
+        /** \brief The packed values of the elements, in blocks of BLOCK_SIZE elements. Within a block, value
+            \e j of the \e i-th element is at index \e j * BLOCK_SIZE + \e i. */
+        std::vector<double> packed_;
     };
+
+    template <typename _T>
+    constexpr std::size_t NearestNeighborsLinear<_T>::BLOCK_SIZE;
 }
 
 #endif
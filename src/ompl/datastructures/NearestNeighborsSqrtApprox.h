@@ -96,17 +96,37 @@ namespace ompl
             if (checks_ > 0 && n > 0)
             {
                 double dmin = 0.0;
-                for (std::size_t j = 0; j < checks_; ++j)
+                if (NearestNeighborsLinear<_T>::usesDistanceBlocks())
                 {
-                    std::size_t i = (j * checks_ + offset_) % n;
-
-                    double distance = NearestNeighbors<_T>::distFun_(NearestNeighborsLinear<_T>::data_[i], data);
-                    if (pos == n || dmin > distance)
+                    const std::size_t blockSize = NearestNeighborsLinear<_T>::BLOCK_SIZE;
+                    std::size_t indices[blockSize];
+                    double dist[blockSize];
+                    for (std::size_t start = 0; start < checks_; start += blockSize)
                     {
-                        pos = i;
-                        dmin = distance;
+                        std::size_t count = std::min(blockSize, checks_ - start);
+                        for (std::size_t j = 0; j < count; ++j)
+                            indices[j] = ((start + j) * checks_ + offset_) % n;
+                        NearestNeighborsLinear<_T>::gatheredDistances(data, indices, count, dist);
+                        for (std::size_t j = 0; j < count; ++j)
+                            if (pos == n || dmin > dist[j])
+                            {
+                                pos = indices[j];
+                                dmin = dist[j];
+                            }
                     }
                 }
+                else
+                    for (std::size_t j = 0; j < checks_; ++j)
+                    {
+                        std::size_t i = (j * checks_ + offset_) % n;
+
+                        double distance = NearestNeighbors<_T>::distFun_(NearestNeighborsLinear<_T>::data_[i], data);
+                        if (pos == n || dmin > distance)
+                        {
+                            pos = i;
+                            dmin = distance;
+                        }
+                    }
                 offset_ = (offset_ + 1) % checks_;
             }
             if (pos != n)
@@ -0,0 +1,377 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_DATASTRUCTURES_PAIRING_HEAP_
+#define OMPL_DATASTRUCTURES_PAIRING_HEAP_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief An updatable min-heap implemented as a pairing heap.
+
+        The interface is that of BinaryHeap, so the two can be exchanged. Insertion
+        and decreasing the key of an element take constant time, and removal takes
+        amortized logarithmic time. This makes the pairing heap a good fit for searches
+        in which keys mostly decrease and many elements are inserted but few are removed
+        (e.g., queues with monotone keys). Elements are taken from blocks owned by the
+        heap and recycled after removal, as in DAryHeap.
+
+        The data of a removed element is reset to a default-constructed value, so that
+        the heap does not keep resources (e.g., shared pointers) alive. */
+    template <typename _T, class LessThan = std::less<_T>>
+    class PairingHeap
+    {
+    public:
+        /** \brief The handle of data stored in the heap. It contains the data and
+            the links of the element to its neighbors in the heap. */
+        class Element
+        {
+            friend class PairingHeap;
+
+        private:
+            Element() = default;
+            /** \brief The first child of this element */
+            Element *child;
+            /** \brief The next sibling of this element */
+            Element *next;
+            /** \brief The previous sibling of this element, or its parent if it is the first child */
+            Element *prev;
+
+        public:
+            /** \brief The data of this element */
+            _T data;
+        };
+
+        /** \brief Event that gets called after an insertion */
+        using EventAfterInsert = void (*)(Element *, void *);
+
+        /** \brief Event that gets called just before a removal */
+        using EventBeforeRemove = void (*)(Element *, void *);
+
+        PairingHeap() = default;
+
+        PairingHeap(LessThan lt) : lt_(std::move(lt))
+        {
+        }
+
+        PairingHeap(const PairingHeap &) = delete;
+        PairingHeap &operator=(const PairingHeap &) = delete;
+        PairingHeap(PairingHeap &&) = default;
+        PairingHeap &operator=(PairingHeap &&) = default;
+
+        ~PairingHeap() = default;
+
+        /** \brief Set the event that gets called after insertion */
+        void onAfterInsert(EventAfterInsert event, void *arg)
+        {
+            eventAfterInsert_ = event;
+            eventAfterInsertData_ = arg;
+        }
+
+        /** \brief Set the event that gets called before a removal */
+        void onBeforeRemove(EventBeforeRemove event, void *arg)
+        {
+            eventBeforeRemove_ = event;
+            eventBeforeRemoveData_ = arg;
+        }
+
+        /** \brief Clear the heap. The memory of the elements is kept for later insertions. */
+        void clear()
+        {
+            std::vector<Element *> elements;
+            collect(elements);
+            for (auto &element : elements)
+                release(element);
+            root_ = nullptr;
+            size_ = 0;
+        }
+
+        /** \brief Return the top element. nullptr for an empty heap. */
+        Element *top() const
+        {
+            return root_;
+        }
+
+        /** \brief Remove the top element */
+        void pop()
+        {
+            Element *root = root_;
+            root_ = mergePairs(root->child);
+            release(root);
+            --size_;
+        }
+
+        /** \brief Remove a specific element */
+        void remove(Element *element)
+        {
+            if (eventBeforeRemove_)
+                eventBeforeRemove_(element, eventBeforeRemoveData_);
+            if (element == root_)
+                pop();
+            else
+            {
+                cut(element);
+                root_ = meld(root_, mergePairs(element->child));
+                release(element);
+                --size_;
+            }
+        }
+
+        /** \brief Add a new element */
+        Element *insert(const _T &data)
+        {
+            Element *element = acquire(data);
+            root_ = meld(root_, element);
+            ++size_;
+            if (eventAfterInsert_)
+                eventAfterInsert_(element, eventAfterInsertData_);
+            return element;
+        }
+
+        /** \brief Add a set of elements to the heap */
+        void insert(const std::vector<_T> &list)
+        {
+            for (const auto &data : list)
+                insert(data);
+        }
+
+        /** \brief Clear the heap, add the set of elements @e list to it and rebuild it. */
+        void buildFrom(const std::vector<_T> &list)
+        {
+            clear();
+            std::vector<Element *> elements;
+            elements.reserve(list.size());
+            for (const auto &data : list)
+                elements.push_back(acquire(data));
+            build(elements);
+        }
+
+        /** \brief Rebuild the heap */
+        void rebuild()
+        {
+            std::vector<Element *> elements;
+            collect(elements);
+            for (auto &element : elements)
+                element->child = element->next = element->prev = nullptr;
+            build(elements);
+        }
+
+        /** \brief Update an element in the heap */
+        void update(Element *element)
+        {
+            // detach the element and its children, and meld them back as separate heaps
+            Element *children = mergePairs(element->child);
+            element->child = nullptr;
+            if (element == root_)
+                root_ = meld(children, element);
+            else
+            {
+                cut(element);
+                root_ = meld(meld(root_, children), element);
+            }
+        }
+
+        /** \brief Check if the heap is empty */
+        bool empty() const
+        {
+            return root_ == nullptr;
+        }
+
+        /** \brief Get the number of elements in the heap */
+        unsigned int size() const
+        {
+            return size_;
+        }
+
+        /** \brief Get the data stored in this heap */
+        void getContent(std::vector<_T> &content) const
+        {
+            std::vector<Element *> elements;
+            collect(elements);
+            for (auto &element : elements)
+                content.push_back(element->data);
+        }
+
+        /** \brief Sort an array of elements. This does not affect the content of the heap */
+        void sort(std::vector<_T> &list)
+        {
+            std::sort(list.begin(), list.end(), lt_);
+        }
+
+        /** \brief Return a reference to the comparison operator */
+        LessThan &getComparisonOperator()
+        {
+            return lt_;
+        }
+
+    private:
+        LessThan lt_;
+
+        Element *root_{nullptr};
+
+        unsigned int size_{0};
+
+        /** \brief The blocks the elements are allocated from */
+        std::vector<std::unique_ptr<Element[]>> blocks_;
+
+        /** \brief Allocated elements that are not in the heap */
+        std::vector<Element *> free_;
+
+        /** \brief Scratch space for mergePairs() */
+        std::vector<Element *> pairs_;
+
+        EventAfterInsert eventAfterInsert_{nullptr};
+        void *eventAfterInsertData_{nullptr};
+        EventBeforeRemove eventBeforeRemove_{nullptr};
+        void *eventBeforeRemoveData_{nullptr};
+
+        Element *acquire(const _T &data)
+        {
+            if (free_.empty())
+            {
+                // blocks double in size, so the number of allocations is logarithmic in the size of the heap
+                const std::size_t n = blocks_.empty() ? 64 : 32 * ((std::size_t)1 << blocks_.size());
+                blocks_.emplace_back(new Element[n]);
+                for (std::size_t i = n; i > 0; --i)
+                    free_.push_back(&blocks_.back()[i - 1]);
+            }
+            Element *element = free_.back();
+            free_.pop_back();
+            element->data = data;
+            element->child = element->next = element->prev = nullptr;
+            return element;
+        }
+
+        void release(Element *element)
+        {
+            element->data = _T();
+            free_.push_back(element);
+        }
+
+        /** \brief Collect all elements of the heap, without following the heap order */
+        void collect(std::vector<Element *> &elements) const
+        {
+            if (root_ == nullptr)
+                return;
+            std::size_t first = elements.size();
+            elements.push_back(root_);
+            for (std::size_t i = first; i < elements.size(); ++i)
+                for (Element *c = elements[i]->child; c != nullptr; c = c->next)
+                    elements.push_back(c);
+        }
+
+        /** \brief Make \e elements, which have no links, the content of the heap */
+        void build(std::vector<Element *> &elements)
+        {
+            size_ = elements.size();
+            root_ = nullptr;
+            if (elements.empty())
+                return;
+            // meld the elements in rounds of pairs, so the resulting tree is balanced
+            while (elements.size() > 1)
+            {
+                std::size_t n = 0;
+                for (std::size_t i = 0; i + 1 < elements.size(); i += 2)
+                    elements[n++] = meld(elements[i], elements[i + 1]);
+                if (elements.size() % 2 == 1)
+                    elements[n++] = elements.back();
+                elements.resize(n);
+            }
+            root_ = elements[0];
+        }
+
+        /** \brief Meld two heaps whose roots have no siblings; return the new root */
+        Element *meld(Element *a, Element *b)
+        {
+            if (a == nullptr)
+                return b;
+            if (b == nullptr)
+                return a;
+            if (lt_(b->data, a->data))
+                std::swap(a, b);
+            // b becomes the first child of a
+            b->prev = a;
+            b->next = a->child;
+            if (a->child != nullptr)
+                a->child->prev = b;
+            a->child = b;
+            a->next = a->prev = nullptr;
+            return a;
+        }
+
+        /** \brief Detach a non-root element (with its children) from the heap */
+        void cut(Element *element)
+        {
+            if (element->prev->child == element)
+                element->prev->child = element->next;
+            else
+                element->prev->next = element->next;
+            if (element->next != nullptr)
+                element->next->prev = element->prev;
+            element->next = element->prev = nullptr;
+        }
+
+        /** \brief Merge a list of siblings into one heap with the standard two-pass method; return its root */
+        Element *mergePairs(Element *first)
+        {
+            if (first == nullptr)
+                return nullptr;
+            pairs_.clear();
+            // first pass: meld the siblings in pairs, from left to right
+            while (first != nullptr)
+            {
+                Element *a = first;
+                Element *b = a->next;
+                first = b != nullptr ? b->next : nullptr;
+                a->next = a->prev = nullptr;
+                if (b != nullptr)
+                    b->next = b->prev = nullptr;
+                pairs_.push_back(meld(a, b));
+            }
+            // second pass: meld the pairs from right to left
+            Element *root = pairs_.back();
+            for (std::size_t i = pairs_.size() - 1; i > 0; --i)
+                root = meld(pairs_[i - 1], root);
+            return root;
+        }
+    };
+}
+
+#endif
@@ -120,6 +120,13 @@ namespace ompl
 
             State *allocState() const override;
             void freeState(State *state) const override;
+
+            /** \brief MORSE states are not constructed in provided memory, so pooled allocation is not supported */
+            std::size_t getStateMemorySize() const override
+            {
+                return 0;
+            }
+
             void copyState(State *destination, const State *source) const override;
             void interpolate(const State *from, const State *to, double t, State *state) const override;
 
@@ -210,6 +210,13 @@ namespace ompl
 
             base::State *allocState() const override;
             void freeState(base::State *state) const override;
+
+            /** \brief OpenDE states are not constructed in provided memory, so pooled allocation is not supported */
+            std::size_t getStateMemorySize() const override
+            {
+                return 0;
+            }
+
             void copyState(base::State *destination, const base::State *source) const override;
             void interpolate(const base::State *from, const base::State *to, double t,
                              base::State *state) const override;
@@ -124,12 +124,10 @@ namespace ompl
 
             base::PlannerStatus solve(const base::PlannerTerminationCondition &ptc) override;
 
-            void addSampler(const base::StateSamplerPtr &sampler)
-            {
-                addSamplerMutex_.lock();
-                samplers_.push_back(sampler);
-                addSamplerMutex_.unlock();
-            }
+            /** \brief Register a sampler allocated by one of the planners. The k-th sampler of planner \e i draws
+                from stream k n + \e i (n being the number of planners) of a seed chosen at each call to solve(),
+                so its numbers do not depend on the order in which the threads allocate samplers. */
+            void addSampler(const base::StateSamplerPtr &sampler);
 
             /** \brief Option to control whether the search is focused during the search. */
             void setFocusSearch(const bool focus)
@@ -166,6 +164,10 @@ namespace ompl
             /** \brief Helper function to add a planner instance. */
             void addPlannerInstanceInternal(const base::PlannerPtr &planner);
 
+            /** \brief Set the stream of the next sampler of the planner that \e sampler belongs to. Called with
+                addSamplerMutex_ locked. */
+            void setSamplerStream(base::StateSampler *sampler);
+
             /** \brief Callback to be called everytime a new, better solution is found by a planner. */
             void newSolutionFound(const base::Planner *planner, const std::vector<const base::State *> &states,
                                   base::Cost cost);
@@ -201,6 +203,12 @@ namespace ompl
             /** \brief Mutex to control the access to samplers_ */
             std::mutex addSamplerMutex_;
 
+            /** \brief The seed of the streams of the samplers during the current call to solve() */
+            std::uint_fast32_t samplerSeed_{0u};
+
+            /** \brief The number of samplers of each planner that have been given a stream */
+            std::vector<unsigned int> samplerCounts_;
+
             /** \brief Flag to control whether the search is focused. */
             bool focusSearch_{true};
 
@@ -75,6 +75,9 @@ namespace ompl
                 it will call the sampleGaussian() method of the specified sampler. */
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
 
+            /** \brief Set the stream of the specified sampler. */
+            void setLocalStream(std::uint_fast32_t seed, std::uint64_t stream) override;
+
             const StateSpace *getStateSpace() const
             {
                 return space_;
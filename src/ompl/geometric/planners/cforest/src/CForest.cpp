@@ -38,6 +38,7 @@
 #include "ompl/geometric/planners/rrt/RRTstar.h"
 #include "ompl/base/objectives/PathLengthOptimizationObjective.h"
 #include "ompl/util/String.h"
+#include <algorithm>
 #include <thread>
 
 ompl::geometric::CForest::CForest(const base::SpaceInformationPtr &si) : base::Planner(si, "CForest")
@@ -188,6 +189,14 @@ ompl::base::PlannerStatus ompl::geometric::CForest::solve(const base::PlannerTer
         });
     bestCost_ = opt_->infiniteCost();
 
+    // give the samplers that exist already their streams of a new seed; the others get theirs when allocated
+    addSamplerMutex_.lock();
+    samplerSeed_ = RNG().getLocalSeed();
+    samplerCounts_.assign(planners_.size(), 0u);
+    for (auto &sampler : samplers_)
+        setSamplerStream(sampler.get());
+    addSamplerMutex_.unlock();
+
     // run each planner in its own thread, with the same ptc.
     for (std::size_t i = 0; i < threads.size(); ++i)
     {
@@ -210,6 +219,28 @@ ompl::base::PlannerStatus ompl::geometric::CForest::solve(const base::PlannerTer
     return {pdef_->hasSolution(), pdef_->hasApproximateSolution()};
 }
 
+void ompl::geometric::CForest::addSampler(const base::StateSamplerPtr &sampler)
+{
+    addSamplerMutex_.lock();
+    samplers_.push_back(sampler);
+    setSamplerStream(sampler.get());
+    addSamplerMutex_.unlock();
+}
+
+void ompl::geometric::CForest::setSamplerStream(base::StateSampler *sampler)
+{
+    const auto *space = static_cast<const base::CForestStateSpaceWrapper *>(
+        static_cast<base::CForestStateSampler *>(sampler)->getStateSpace());
+    auto it = std::find_if(planners_.begin(), planners_.end(),
+                           [space](const base::PlannerPtr &planner) { return planner.get() == space->getPlanner(); });
+    if (it == planners_.end())
+        return;
+    const std::size_t index = it - planners_.begin();
+    if (samplerCounts_.size() < planners_.size())
+        samplerCounts_.resize(planners_.size(), 0u);
+    sampler->setLocalStream(samplerSeed_, samplerCounts_[index]++ * planners_.size() + index);
+}
+
 std::string ompl::geometric::CForest::getBestCost() const
 {
     return ompl::toString(bestCost_.value());
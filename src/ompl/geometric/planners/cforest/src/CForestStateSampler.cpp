@@ -60,6 +60,11 @@ void ompl::base::CForestStateSampler::sampleGaussian(State *state, const State *
         sampler_->sampleGaussian(state, mean, stdDev);
 }
 
+void ompl::base::CForestStateSampler::setLocalStream(std::uint_fast32_t seed, std::uint64_t stream)
+{
+    sampler_->setLocalStream(seed, stream);
+}
+
 void ompl::base::CForestStateSampler::setStatesToSample(const std::vector<const State *> &states)
 {
     std::lock_guard<std::mutex> slock(statesLock_);
@@ -41,6 +41,10 @@
 #include "ompl/geometric/PathGeometric.h"
 #include "ompl/geometric/PathSimplifier.h"
 #include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/util/ThreadPool.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
 
 namespace ompl
 {
@@ -116,6 +120,11 @@ namespace ompl
             /** \brief Set the planner that will be used for repairing invalid paths recalled from experience */
             void setRepairPlanner(const base::PlannerPtr &planner);
 
+            /** \brief Set the allocator for the planners used to repair paths recalled from experience. Unlike
+                setRepairPlanner(), this allows several candidate paths to be repaired at the same time, each with
+                its own planner (see setNumRepairCandidates()). */
+            void setRepairPlannerAllocator(const base::PlannerAllocator &pa);
+
             void setup() override;
 
             /**
@@ -152,6 +161,36 @@ namespace ompl
                 nearestK_ = nearestK;
             }
 
+            /** \brief Get the number of best scoring candidate paths that are repaired concurrently */
+            unsigned int getNumRepairCandidates() const
+            {
+                return repairCandidates_;
+            }
+
+            /**
+             * \brief Set the number of best scoring candidate paths that are repaired concurrently. The first
+             * candidate to be repaired successfully is used and the repair of the others is cancelled. Repairing
+             * more than one candidate requires a repair planner allocator (see setRepairPlannerAllocator()), or
+             * the default repair planner. The default is 1, i.e., only the best candidate is repaired. The
+             * candidates are repaired by the threads of the planner (see setThreadCount()), so with a single
+             * thread they are repaired one after the other until one succeeds.
+             */
+            void setNumRepairCandidates(unsigned int candidates)
+            {
+                repairCandidates_ = std::max(candidates, 1u);
+            }
+
+            /** \brief Set the number of threads used to score the recalled paths and to repair the candidates.
+             * With more than one thread, the state validity checker and the motion validator are called
+             * concurrently, so they must be thread safe. The default is 1. */
+            void setThreadCount(unsigned int threads);
+
+            /** \brief Get the number of threads used to score the recalled paths and to repair the candidates */
+            unsigned int getThreadCount() const
+            {
+                return threadCount_;
+            }
+
         protected:
             /**
              * \brief Count the number of states along the discretized path that are in collision
@@ -170,6 +209,41 @@ namespace ompl
             bool findBestPath(const base::State *startState, const base::State *goalState,
                               base::PlannerDataPtr &chosenPath);
 
+            /**
+             * \brief Score the paths in nearestPaths_ (concurrently, with more than one thread) and order them
+             * from best to worst: by the number of invalid states, then by the distance of their endpoints to the
+             * start and goal states
+             * \param ranking - the indices in nearestPaths_, best path first
+             * \return true if no error
+             */
+            bool rankPaths(const base::State *startState, const base::State *goalState,
+                           std::vector<std::size_t> &ranking);
+
+            /** \brief Get the path at \e pathID in nearestPaths_, in the direction of the current query */
+            base::PlannerDataPtr getRecalledPath(std::size_t pathID) const;
+
+            /** \brief A planner, with the problem definition and simplifier it uses, for repairing paths */
+            struct RepairContext
+            {
+                base::PlannerPtr planner;
+                base::ProblemDefinitionPtr problemDef;
+                geometric::PathSimplifierPtr simplifier;
+            };
+
+            /** \brief Repair \e primaryPath using the planner in \e context */
+            bool repairPath(const base::PlannerTerminationCondition &ptc, geometric::PathGeometric &primaryPath,
+                            const RepairContext &context);
+
+            /** \brief Replan between \e start and \e goal using the planner in \e context */
+            bool replan(const base::State *start, const base::State *goal, geometric::PathGeometric &newPathSegment,
+                        const base::PlannerTerminationCondition &ptc, const RepairContext &context);
+
+            /** \brief Repair the first \e count paths in \e ranking concurrently and keep the first one to be
+                repaired. \return The repaired path, or nullptr if no candidate was repaired */
+            PathGeometricPtr repairCandidates(const base::PlannerTerminationCondition &ptc,
+                                              const base::State *startState, const base::State *goalState,
+                                              const std::vector<std::size_t> &ranking, std::size_t count);
+
             /** \brief The database of motions to search through */
             tools::LightningDBPtr experienceDB_;
 
@@ -185,14 +259,41 @@ namespace ompl
             /** \brief A secondary problem definition for the repair planner to use */
             base::ProblemDefinitionPtr repairProblemDef_;
 
+            /** \brief The allocator for repair planners, if one was set */
+            base::PlannerAllocator repairPlannerAllocator_;
+
+            /** \brief The planners for the candidates that are repaired alongside the best one */
+            std::vector<RepairContext> speculativeRepairs_;
+
+            /** \brief The score of each path in nearestPaths_ (the number of invalid states) */
+            std::vector<std::size_t> pathScores_;
+
+            /** \brief The distance between the endpoints of each path in nearestPaths_ and the query */
+            std::vector<double> pathDistances_;
+
+            /** \brief Whether each path in nearestPaths_ is closer to the query when reversed */
+            std::vector<bool> pathReversed_;
+
             /** \brief Debug the repair planner by saving its planner data each time it is used */
             std::vector<base::PlannerDataPtr> repairPlannerDatas_;
 
+            /** \brief Lock for repairPlannerDatas_, which concurrent repairs append to */
+            std::mutex repairPlannerDatasLock_;
+
             /** \brief The instance of the path simplifier */
             geometric::PathSimplifierPtr psk_;
 
             /** \brief Number of 'k' close solutions to choose from database for further filtering */
             int nearestK_;
+
+            /** \brief Number of best scoring candidates that are repaired concurrently */
+            unsigned int repairCandidates_{1u};
+
+            /** \brief Number of threads used to score and repair paths */
+            unsigned int threadCount_{1u};
+
+            /** \brief The worker threads that help the calling thread, if more than one thread is used */
+            std::unique_ptr<ThreadPool> threadPool_;
         };
     }
 }
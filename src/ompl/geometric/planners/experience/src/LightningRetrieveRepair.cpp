@@ -42,8 +42,8 @@
 #include "ompl/tools/config/MagicConstants.h"
 #include "ompl/tools/lightning/LightningDB.h"
 
-#include <thread>
-
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <utility>
 
@@ -60,6 +60,9 @@ ompl::geometric::LightningRetrieveRepair::LightningRetrieveRepair(const base::Sp
     repairProblemDef_ = std::make_shared<base::ProblemDefinition>(si_);
 
     psk_ = std::make_shared<PathSimplifier>(si_);
+
+    Planner::declareParam<unsigned int>("threads", this, &LightningRetrieveRepair::setThreadCount,
+                                        &LightningRetrieveRepair::getThreadCount, "1:64");
 }
 
 ompl::geometric::LightningRetrieveRepair::~LightningRetrieveRepair() = default;
@@ -71,6 +74,14 @@ void ompl::geometric::LightningRetrieveRepair::clear()
     // Clear the inner planner
     if (repairPlanner_)
         repairPlanner_->clear();
+    for (auto &context : speculativeRepairs_)
+        context.planner->clear();
+}
+
+void ompl::geometric::LightningRetrieveRepair::setThreadCount(unsigned int threads)
+{
+    threadCount_ = std::max(1u, threads);
+    threadPool_.reset(threadCount_ > 1u ? new ThreadPool(threadCount_ - 1u) : nullptr);
 }
 
 void ompl::geometric::LightningRetrieveRepair::setLightningDB(const ompl::tools::LightningDBPtr &experienceDB)
@@ -83,6 +94,17 @@ void ompl::geometric::LightningRetrieveRepair::setRepairPlanner(const base::Plan
     if (planner && planner->getSpaceInformation().get() != si_.get())
         throw Exception("LightningRetrieveRepair: Repair planner instance does not match space information");
     repairPlanner_ = planner;
+    // the allocator would not create instances of this planner for concurrent repairs
+    repairPlannerAllocator_ = nullptr;
+    speculativeRepairs_.clear();
+    setup_ = false;
+}
+
+void ompl::geometric::LightningRetrieveRepair::setRepairPlannerAllocator(const base::PlannerAllocator &pa)
+{
+    repairPlannerAllocator_ = pa;
+    repairPlanner_.reset();
+    speculativeRepairs_.clear();
     setup_ = false;
 }
 
@@ -95,7 +117,12 @@ void ompl::geometric::LightningRetrieveRepair::setup()
     if (!repairPlanner_)
     {
         // Set the repair planner
-        repairPlanner_ = std::make_shared<RRTConnect>(si_);
+        if (!repairPlannerAllocator_)
+            repairPlannerAllocator_ = [](const base::SpaceInformationPtr &si)
+            {
+                return std::make_shared<RRTConnect>(si);
+            };
+        repairPlanner_ = repairPlannerAllocator_(si_);
         OMPL_DEBUG("LightningRetrieveRepair: No repairing planner specified. Using default: %s",
                    repairPlanner_->getName().c_str());
     }
@@ -146,35 +173,25 @@ ompl::base::PlannerStatus ompl::geometric::LightningRetrieveRepair::solve(const
         return base::PlannerStatus::TIMEOUT;  // The planner failed to find a solution
     }
 
-    ompl::base::PlannerDataPtr chosenPath;
-
-    // Filter top n paths to 1
-    // TODO Rather than selecting 1 best path, you could also spawn n (n<=k) threads and repair the top n paths.
-    if (!findBestPath(startState, goalState, chosenPath))
+    // Order the n paths from best to worst
+    std::vector<std::size_t> ranking;
+    if (!rankPaths(startState, goalState, ranking))
     {
         return base::PlannerStatus::ABORT;
     }
 
-    // All saved trajectories should be at least 2 states long
-    assert(chosenPath->numVertices() >= 2);
-
-    // Convert chosen PlannerData experience to an actual path
-    auto primaryPath(std::make_shared<PathGeometric>(si_));
-    // Add start
-    primaryPath->append(startState);
-    // Add old states
-    for (std::size_t i = 0; i < chosenPath->numVertices(); ++i)
+    std::size_t candidates = std::min<std::size_t>(repairCandidates_, ranking.size());
+    if (candidates > 1 && !repairPlannerAllocator_)
     {
-        primaryPath->append(chosenPath->getVertex(i).getState());
+        OMPL_WARN("LightningRetrieveRepair: A repair planner instance was set, so only the best path is repaired. Set a "
+                  "repair planner allocator to repair %u paths concurrently.",
+                  repairCandidates_);
+        candidates = 1;
     }
-    // Add goal
-    primaryPath->append(goalState);
-
-    // All save trajectories should be at least 2 states long, and then we append the start and goal states
-    assert(primaryPath->getStateCount() >= 4);
 
-    // Repair chosen path
-    if (!repairPath(ptc, *primaryPath))
+    // Repair the best path, or the first of the best paths to be repaired
+    PathGeometricPtr primaryPath = repairCandidates(ptc, startState, goalState, ranking, candidates);
+    if (!primaryPath)
     {
         OMPL_INFORM("LightningRetrieveRepair: repairPath failed or aborted");
         return base::PlannerStatus::ABORT;
@@ -198,58 +215,74 @@ ompl::base::PlannerStatus ompl::geometric::LightningRetrieveRepair::solve(const
 bool ompl::geometric::LightningRetrieveRepair::findBestPath(const base::State *startState, const base::State *goalState,
                                                             ompl::base::PlannerDataPtr &chosenPath)
 {
-    OMPL_INFORM("LightningRetrieveRepair: Found %d similar paths. Filtering", nearestPaths_.size());
+    std::vector<std::size_t> ranking;
+    if (!rankPaths(startState, goalState, ranking))
+        return false;
+
+    nearestPathsChosenID_ = ranking.front();
+    const ompl::base::PlannerDataPtr &bestPath = nearestPaths_[nearestPathsChosenID_];
+    if ((bestPath->numVertices() == 0u) || bestPath->numVertices() == 1)
+    {
+        OMPL_ERROR("LightningRetrieveRepair: Only %d verticies found in PlannerData loaded from file. This is a bug.",
+                   bestPath->numVertices());
+        return false;
+    }
 
-    // Filter down to just 1 chosen path
-    ompl::base::PlannerDataPtr bestPath = nearestPaths_.front();
-    std::size_t bestPathScore = std::numeric_limits<std::size_t>::max();
+    // Reverse the path if necessary
+    chosenPath = getRecalledPath(nearestPathsChosenID_);
+    OMPL_DEBUG("LightningRetrieveRepair: Done Filtering\n");
 
-    // Track which path has the shortest distance
-    std::vector<double> distances(nearestPaths_.size(), 0);
-    std::vector<bool> isReversed(nearestPaths_.size());
+    return true;
+}
 
-    assert(isReversed.size() == nearestPaths_.size());
+bool ompl::geometric::LightningRetrieveRepair::rankPaths(const base::State *startState, const base::State *goalState,
+                                                         std::vector<std::size_t> &ranking)
+{
+    OMPL_INFORM("LightningRetrieveRepair: Found %d similar paths. Filtering", nearestPaths_.size());
 
-    for (std::size_t pathID = 0; pathID < nearestPaths_.size(); ++pathID)
+    for (const auto &currentPath : nearestPaths_)
     {
-        const ompl::base::PlannerDataPtr &currentPath = nearestPaths_[pathID];
-
         // Error check
         if (currentPath->numVertices() < 2)  // needs at least a start and a goal
         {
             OMPL_ERROR("A path was recalled that somehow has less than 2 vertices, which shouldn't happen");
             return false;
         }
+    }
 
+    pathScores_.assign(nearestPaths_.size(), std::numeric_limits<std::size_t>::max());
+    pathDistances_.assign(nearestPaths_.size(), 0.0);
+    pathReversed_.assign(nearestPaths_.size(), false);
+
+    // With more than one thread, paths are scored concurrently. Each thread takes the next unscored path, so the
+    // paths closest to the query are scored first.
+    std::atomic<bool> perfect(false);
+    // std::vector<bool> packs its values, so the flags are written once the scoring is done
+    std::vector<char> reversed(nearestPaths_.size(), 0);
+    auto scorePath = [this, startState, goalState, &perfect, &reversed](std::size_t pathID)
+    {
+        if (perfect)
+            return;
+        const ompl::base::PlannerDataPtr &currentPath = nearestPaths_[pathID];
         const ompl::base::State *pathStartState = currentPath->getVertex(0).getState();
         const ompl::base::State *pathGoalState = currentPath->getVertex(currentPath->numVertices() - 1).getState();
 
-        double regularDistance = si_->distance(startState, pathStartState) + si_->distance(goalState, pathGoalState);
-        double reversedDistance = si_->distance(startState, pathGoalState) + si_->distance(goalState, pathStartState);
+        double regularDistance =
+            si_->distance(startState, pathStartState) + si_->distance(goalState, pathGoalState);
+        double reversedDistance =
+            si_->distance(startState, pathGoalState) + si_->distance(goalState, pathStartState);
 
-        // Check if path is reversed from normal [start->goal] direction and cache the distance
-        if (regularDistance > reversedDistance)
-        {
-            // The distance between starts and goals is less when in reverse
-            isReversed[pathID] = true;
-            distances[pathID] = reversedDistance;
-            // We won't actually flip it until later to save memory operations and not alter our NN tree in the
-            // LightningDB
-        }
-        else
-        {
-            isReversed[pathID] = false;
-            distances[pathID] = regularDistance;
-        }
+        // Check if path is reversed from normal [start->goal] direction and cache the distance. We won't
+        // actually flip it until later to save memory operations and not alter our NN tree in the LightningDB
+        bool isReversed = regularDistance > reversedDistance;
+        pathDistances_[pathID] = isReversed ? reversedDistance : regularDistance;
+        reversed[pathID] = isReversed;
 
         std::size_t pathScore = 0;  // the score
 
         // Check the validity between our start location and the path's start
         // TODO: this might bias the score to be worse for the little connecting segment
-        if (!isReversed[pathID])
-            pathScore += checkMotionScore(startState, pathStartState);
-        else
-            pathScore += checkMotionScore(startState, pathGoalState);
+        pathScore += checkMotionScore(startState, isReversed ? pathGoalState : pathStartState);
 
         // Score current path for validity
         std::size_t invalidStates = 0;
@@ -266,91 +299,167 @@ bool ompl::geometric::LightningRetrieveRepair::findBestPath(const base::State *s
 
         // Check the validity between our goal location and the path's goal
         // TODO: this might bias the score to be worse for the little connecting segment
-        if (!isReversed[pathID])
-            pathScore += checkMotionScore(goalState, pathGoalState);
-        else
-            pathScore += checkMotionScore(goalState, pathStartState);
+        pathScore += checkMotionScore(goalState, isReversed ? pathStartState : pathGoalState);
+        pathScores_[pathID] = pathScore;
 
-        // Factor in the distance between start/goal and our new start/goal
         OMPL_INFORM("LightningRetrieveRepair: Path %d | %d verticies | %d invalid | score %d | reversed: %s | "
                     "distance: %f",
                     int(pathID), currentPath->numVertices(), invalidStates, pathScore,
-                    isReversed[pathID] ? "true" : "false", distances[pathID]);
+                    isReversed ? "true" : "false", pathDistances_[pathID]);
 
         // Check if we have a perfect score (0) and this is the shortest path (the first one)
         if (pathID == 0 && pathScore == 0)
         {
             OMPL_DEBUG("LightningRetrieveRepair:  --> The shortest path (path 0) has a perfect score (0), ending "
                        "filtering early.");
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
-            break;  // end the for loop
+            perfect = true;
         }
+    };
 
-        // Check if this is the best score we've seen so far
-        if (pathScore < bestPathScore)
-        {
-            OMPL_DEBUG("LightningRetrieveRepair:  --> This path is the best we've seen so far. Previous best: %d",
-                       bestPathScore);
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
-        }
-        // if the best score is the same as a previous one we've seen,
-        // choose the one that has the shortest connecting component
-        else if (pathScore == bestPathScore && distances[nearestPathsChosenID_] > distances[pathID])
+    if (threadPool_)
+        threadPool_->parallelFor(nearestPaths_.size(), scorePath);
+    else
+        for (std::size_t pathID = 0; pathID < nearestPaths_.size(); ++pathID)
+            scorePath(pathID);
+    for (std::size_t pathID = 0; pathID < reversed.size(); ++pathID)
+        pathReversed_[pathID] = reversed[pathID] != 0;
+
+    // The best path has the lowest score; among paths with the same score, the one that has the shortest
+    // connecting component, and then the one closest to the query in the database
+    ranking.resize(nearestPaths_.size());
+    for (std::size_t i = 0; i < ranking.size(); ++i)
+        ranking[i] = i;
+    std::stable_sort(ranking.begin(), ranking.end(), [this](std::size_t a, std::size_t b)
+                     {
+                         if (pathScores_[a] != pathScores_[b])
+                             return pathScores_[a] < pathScores_[b];
+                         return pathDistances_[a] < pathDistances_[b];
+                     });
+    if (perfect)
+        ranking.resize(1);
+
+    OMPL_DEBUG("LightningRetrieveRepair:  --> Best path is %d with score %d", ranking.front(),
+               pathScores_[ranking.front()]);
+    return true;
+}
+
+ompl::base::PlannerDataPtr ompl::geometric::LightningRetrieveRepair::getRecalledPath(std::size_t pathID) const
+{
+    const ompl::base::PlannerDataPtr &path = nearestPaths_[pathID];
+    if (!pathReversed_[pathID])
+        return path;
+
+    // We allocate memory for this so that we don't alter the database
+    OMPL_DEBUG("LightningRetrieveRepair: Reversing planner data verticies count %d", path->numVertices());
+    auto newPath(std::make_shared<ompl::base::PlannerData>(si_));
+    for (std::size_t i = path->numVertices(); i > 0; --i)  // size_t can't go negative so subtract 1 instead
+    {
+        newPath->addVertex(path->getVertex(i - 1));
+    }
+    return newPath;
+}
+
+ompl::geometric::PathGeometricPtr ompl::geometric::LightningRetrieveRepair::repairCandidates(
+    const base::PlannerTerminationCondition &ptc, const base::State *startState, const base::State *goalState,
+    const std::vector<std::size_t> &ranking, std::size_t count)
+{
+    // Convert a PlannerData experience to an actual path
+    auto candidatePath = [this, startState, goalState](std::size_t pathID)
+    {
+        base::PlannerDataPtr chosenPath = getRecalledPath(pathID);
+
+        // All saved trajectories should be at least 2 states long
+        assert(chosenPath->numVertices() >= 2);
+
+        auto primaryPath(std::make_shared<PathGeometric>(si_));
+        // Add start
+        primaryPath->append(startState);
+        // Add old states
+        for (std::size_t i = 0; i < chosenPath->numVertices(); ++i)
         {
-            // This new path is a shorter distance
-            OMPL_DEBUG("LightningRetrieveRepair:  --> This path is as good as the best we've seen so far, but its path "
-                       "is shorter. Previous best score: %d from index %d",
-                       bestPathScore, nearestPathsChosenID_);
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
+            primaryPath->append(chosenPath->getVertex(i).getState());
         }
-        else
-            OMPL_DEBUG("LightningRetrieveRepair:  --> Not best. Best score: %d from index %d", bestPathScore,
-                       nearestPathsChosenID_);
+        // Add goal
+        primaryPath->append(goalState);
+
+        // All save trajectories should be at least 2 states long, and then we append the start and goal states
+        assert(primaryPath->getStateCount() >= 4);
+        return primaryPath;
+    };
+
+    nearestPathsChosenID_ = ranking.front();
+    RepairContext primary{repairPlanner_, repairProblemDef_, psk_};
+    if (count <= 1)
+    {
+        PathGeometricPtr primaryPath = candidatePath(nearestPathsChosenID_);
+        return repairPath(ptc, *primaryPath, primary) ? primaryPath : nullptr;
     }
 
-    // Check if we have a solution
-    if (!bestPath)
+    // Each candidate after the best one is repaired with its own planner
+    while (speculativeRepairs_.size() < count - 1)
     {
-        OMPL_ERROR("LightningRetrieveRepair: No best path found from k filtered paths");
-        return false;
+        RepairContext context;
+        context.planner = repairPlannerAllocator_(si_);
+        context.problemDef = std::make_shared<base::ProblemDefinition>(si_);
+        context.planner->setProblemDefinition(context.problemDef);
+        context.simplifier = std::make_shared<PathSimplifier>(si_);
+        speculativeRepairs_.push_back(context);
     }
-    if ((bestPath->numVertices() == 0u) || bestPath->numVertices() == 1)
+    for (std::size_t i = 0; i < count - 1; ++i)
     {
-        OMPL_ERROR("LightningRetrieveRepair: Only %d verticies found in PlannerData loaded from file. This is a bug.",
-                   bestPath->numVertices());
-        return false;
+        const RepairContext &context = speculativeRepairs_[i];
+        context.problemDef->setOptimizationObjective(pdef_->getOptimizationObjective());
+        if (!context.planner->isSetup())
+            context.planner->setup();
     }
 
-    // Reverse the path if necessary. We allocate memory for this so that we don't alter the database
-    if (isReversed[nearestPathsChosenID_])
+    OMPL_INFORM("LightningRetrieveRepair: Repairing the %d best paths with %u threads", count, threadCount_);
+
+    // The repairs still running are cancelled once a path has been repaired
+    std::atomic<bool> repaired(false);
+    base::PlannerTerminationCondition cancel = base::plannerOrTerminationCondition(
+        ptc, base::PlannerTerminationCondition([&repaired]
+                                               {
+                                                   return repaired.load();
+                                               }));
+
+    std::mutex resultLock;
+    PathGeometricPtr result;
+    auto repairCandidate = [&](std::size_t rank)
     {
-        OMPL_DEBUG("LightningRetrieveRepair: Reversing planner data verticies count %d", bestPath->numVertices());
-        auto newPath(std::make_shared<ompl::base::PlannerData>(si_));
-        for (std::size_t i = bestPath->numVertices(); i > 0; --i)  // size_t can't go negative so subtract 1 instead
+        PathGeometricPtr path = candidatePath(ranking[rank]);
+        if (repairPath(cancel, *path, rank == 0 ? primary : speculativeRepairs_[rank - 1]))
         {
-            newPath->addVertex(bestPath->getVertex(i - 1));
+            std::lock_guard<std::mutex> _(resultLock);
+            if (!result)
+            {
+                OMPL_DEBUG("LightningRetrieveRepair: Path %d was repaired first", ranking[rank]);
+                result = path;
+                nearestPathsChosenID_ = ranking[rank];
+                repaired = true;
+            }
         }
-        // Set result
-        chosenPath = newPath;
-    }
+    };
+
+    // the candidates are taken in order of their rank, so the best one is repaired first
+    if (threadPool_)
+        threadPool_->parallelFor(count, repairCandidate);
     else
-    {
-        // Set result
-        chosenPath = bestPath;
-    }
-    OMPL_DEBUG("LightningRetrieveRepair: Done Filtering\n");
+        for (std::size_t rank = 0; rank < count && !repaired; ++rank)
+            repairCandidate(rank);
 
-    return true;
+    return result;
 }
 
 bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTerminationCondition &ptc,
                                                           ompl::geometric::PathGeometric &primaryPath)
+{
+    return repairPath(ptc, primaryPath, RepairContext{repairPlanner_, repairProblemDef_, psk_});
+}
+
+bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTerminationCondition &ptc,
+                                                          ompl::geometric::PathGeometric &primaryPath,
+                                                          const RepairContext &context)
 {
     // \todo: we should reuse our collision checking from the previous step to make this faster
 
@@ -420,7 +529,7 @@ bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTer
             // Not valid motion, replan
             OMPL_DEBUG("LightningRetrieveRepair: Planning from %d to %d", fromID, toID);
 
-            if (!replan(fromState, toState, newPathSegment, ptc))
+            if (!replan(fromState, toState, newPathSegment, ptc, context))
             {
                 OMPL_INFORM("LightningRetrieveRepair: Unable to repair path between state %d and %d", fromID, toID);
                 return false;
@@ -473,26 +582,37 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
                                                       PathGeometric &newPathSegment,
                                                       const base::PlannerTerminationCondition &ptc)
 {
+    return replan(start, goal, newPathSegment, ptc, RepairContext{repairPlanner_, repairProblemDef_, psk_});
+}
+
+bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *start, const ompl::base::State *goal,
+                                                      PathGeometric &newPathSegment,
+                                                      const base::PlannerTerminationCondition &ptc,
+                                                      const RepairContext &context)
+{
+    const base::PlannerPtr &repairPlanner = context.planner;
+    const base::ProblemDefinitionPtr &repairProblemDef = context.problemDef;
+
     // Reset problem definition
-    repairProblemDef_->clearSolutionPaths();
-    repairProblemDef_->clearStartStates();
-    repairProblemDef_->clearGoal();
+    repairProblemDef->clearSolutionPaths();
+    repairProblemDef->clearStartStates();
+    repairProblemDef->clearGoal();
 
     // Reset planner
-    repairPlanner_->clear();
+    repairPlanner->clear();
 
     // Configure problem definition
-    repairProblemDef_->setStartAndGoalStates(start, goal);
+    repairProblemDef->setStartAndGoalStates(start, goal);
 
     // Configure planner
-    repairPlanner_->setProblemDefinition(repairProblemDef_);
+    repairPlanner->setProblemDefinition(repairProblemDef);
 
     // Solve
     OMPL_INFORM("LightningRetrieveRepair: Preparing to repair path");
     base::PlannerStatus lastStatus = base::PlannerStatus::UNKNOWN;
     time::point startTime = time::now();
 
-    lastStatus = repairPlanner_->solve(ptc);
+    lastStatus = repairPlanner->solve(ptc);
 
     // Results
     double planTime = time::seconds(time::now() - startTime);
@@ -504,15 +624,15 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
     }
 
     // Check if approximate
-    if (repairProblemDef_->hasApproximateSolution() ||
-        repairProblemDef_->getSolutionDifference() > std::numeric_limits<double>::epsilon())
+    if (repairProblemDef->hasApproximateSolution() ||
+        repairProblemDef->getSolutionDifference() > std::numeric_limits<double>::epsilon())
     {
         OMPL_INFORM("LightningRetrieveRepair: Solution is approximate, not using");
         return false;
     }
 
     // Convert solution into a PathGeometric path
-    base::PathPtr p = repairProblemDef_->getSolutionPath();
+    base::PathPtr p = repairProblemDef->getSolutionPath();
     if (!p)
     {
         OMPL_ERROR("LightningRetrieveRepair: Unable to get solution path from problem definition");
@@ -525,16 +645,19 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
     OMPL_INFORM("LightningRetrieveRepair: Simplifying solution (smoothing)...");
     time::point simplifyStart = time::now();
     std::size_t numStates = newPathSegment.getStateCount();
-    psk_->simplify(newPathSegment, ptc);
+    context.simplifier->simplify(newPathSegment, ptc);
     double simplifyTime = time::seconds(time::now() - simplifyStart);
     OMPL_INFORM("LightningRetrieveRepair: Path simplification took %f seconds and removed %d states", simplifyTime,
                 numStates - newPathSegment.getStateCount());
 
     // Save the planner data for debugging purposes
-    repairPlannerDatas_.push_back(std::make_shared<ompl::base::PlannerData>(si_));
-    repairPlanner_->getPlannerData(*repairPlannerDatas_.back());
-    repairPlannerDatas_.back()->decoupleFromPlanner();  // copy states so that when planner unloads/clears we don't lose
-                                                        // them
+    auto repairPlannerData(std::make_shared<ompl::base::PlannerData>(si_));
+    repairPlanner->getPlannerData(*repairPlannerData);
+    repairPlannerData->decoupleFromPlanner();  // copy states so that when planner unloads/clears we don't lose them
+    {
+        std::lock_guard<std::mutex> _(repairPlannerDatasLock_);
+        repairPlannerDatas_.push_back(repairPlannerData);
+    }
 
     // Return success
     OMPL_INFORM("LightningRetrieveRepair: solution found in %f seconds with %d states", planTime,
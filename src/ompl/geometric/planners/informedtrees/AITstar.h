@@ -38,10 +38,14 @@
 #define OMPL_GEOMETRIC_PLANNERS_INFORMEDTREES_AITSTAR_
 
 #include <algorithm>
+#include <future>
+#include <map>
 #include <memory>
+#include <utility>
 
 #include "ompl/base/Planner.h"
-#include "ompl/datastructures/BinaryHeap.h"
+#include "ompl/geometric/planners/informedtrees/QueueHeap.h"
+#include "ompl/util/ThreadPool.h"
 #include "ompl/geometric/PathGeometric.h"
 #include "ompl/geometric/planners/informedtrees/aitstar/Edge.h"
 #include "ompl/geometric/planners/informedtrees/aitstar/ImplicitGraph.h"
@@ -142,6 +146,15 @@ namespace ompl
             /** \brief Enable LPA* repair of reverse search. */
             void setRepairReverseSearch(bool repairReverseSearch);
 
+            /** \brief Set the number of threads used for collision checking. With more than one thread, new samples
+             * are checked for validity in parallel, and the most promising edges in the forward queue are checked for
+             * collision by worker threads while the main thread continues with the reverse and forward searches.
+             * The state validity checker and motion validator must be thread safe. */
+            void setThreadCount(unsigned int threads);
+
+            /** \brief Get the number of threads used for collision checking. */
+            unsigned int getThreadCount() const;
+
             /** \brief Get the edge queue. */
             std::vector<aitstar::Edge> getEdgesInQueue() const;
 
@@ -167,6 +180,20 @@ namespace ompl
             /** \brief Performs one reverse search iterations. */
             void performReverseSearchIteration();
 
+            /** \brief Checks whether the edge from \e parent to \e child is valid, using the white- and blacklists
+             * and the results of the edge checks started by dispatchEdgeChecks(). Valid edges are whitelisted and
+             * invalid edges are blacklisted. */
+            bool checkEdge(const std::shared_ptr<aitstar::Vertex> &parent,
+                           const std::shared_ptr<aitstar::Vertex> &child);
+
+            /** \brief Starts collision checks of the most promising edges in the forward queue on the worker
+             * threads. */
+            void dispatchEdgeChecks();
+
+            /** \brief White- or blacklists the edges whose collision checks have finished. If \e wait is true, waits
+             * for all started checks first. */
+            void collectEdgeChecks(bool wait);
+
             /** \brief Updates a vertex in the reverse search queue (LPA* update). */
             void reverseSearchUpdateVertex(const std::shared_ptr<aitstar::Vertex> &vertex);
 
@@ -255,8 +282,8 @@ namespace ompl
             aitstar::ImplicitGraph graph_;
 
             /** \brief The type of the edge queue. */
-            using EdgeQueue =
-                ompl::BinaryHeap<aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>;
+            using EdgeQueue = ompl::geometric::QueueHeap<
+                aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>;
 
             /** \brief The forward queue. */
             EdgeQueue forwardQueue_;
@@ -265,8 +292,8 @@ namespace ompl
             using KeyVertexPair = std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<aitstar::Vertex>>;
 
             /** \brief The type of the vertex queue. */
-            using VertexQueue =
-                ompl::BinaryHeap<KeyVertexPair, std::function<bool(const KeyVertexPair &, const KeyVertexPair &)>>;
+            using VertexQueue = ompl::geometric::QueueHeap<
+                KeyVertexPair, std::function<bool(const KeyVertexPair &, const KeyVertexPair &)>>;
 
             /** \brief The reverse queue. */
             VertexQueue reverseQueue_;
@@ -309,6 +336,26 @@ namespace ompl
 
             /** \brief The number of edge collision checks performed. */
             std::size_t numEdgeCollisionChecks_{0u};
+
+            /** \brief The number of threads used for collision checking. */
+            unsigned int threadCount_{1u};
+
+            /** \brief A collision check of an edge running on the worker threads. The vertices are kept alive until
+             * the result has been collected. */
+            struct EdgeCheck
+            {
+                std::shared_ptr<aitstar::Vertex> parent;
+                std::shared_ptr<aitstar::Vertex> child;
+                std::future<bool> isValid;
+            };
+
+            /** \brief The edge checks that have been started but whose results have not been collected, by the ids of
+             * the parent and child. */
+            std::map<std::pair<std::size_t, std::size_t>, EdgeCheck> edgeChecks_;
+
+            /** \brief The worker threads, nullptr if threadCount_ is 1. Declared last so that it is destroyed (and
+             * its workers have finished) before the vertices of pending edge checks are released. */
+            std::unique_ptr<ThreadPool> threadPool_;
         };
     }  // namespace geometric
 }  // namespace ompl
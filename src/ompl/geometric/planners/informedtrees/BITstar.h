@@ -37,6 +37,7 @@
 #ifndef OMPL_GEOMETRIC_PLANNERS_INFORMEDTREES_BITSTAR_
 #define OMPL_GEOMETRIC_PLANNERS_INFORMEDTREES_BITSTAR_
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -44,6 +45,7 @@
 #include "ompl/base/Planner.h"
 #include "ompl/base/samplers/InformedStateSampler.h"
 #include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/util/ThreadPool.h"
 
 // Defining BITSTAR_DEBUG enables (significant) debug output. Do not enable unless necessary.
 // #define BITSTAR_DEBUG
@@ -219,6 +221,24 @@ namespace ompl
             /** \brief Get whether a k-nearest search is being used.*/
             bool getUseKNearest() const;
 
+            /** \brief Allow the nearest neighbor queries of the implicit graph to return approximate results, with
+             * approximation factor \e epsilon (see NearestNeighbors::setApproximationFactor()). Larger values make
+             * the queries faster at the cost of slightly worse solutions for the same number of samples. The
+             * default of 0 means exact queries. */
+            void setNearestNeighborsApproximation(double epsilon);
+
+            /** \brief Get the approximation factor for nearest neighbor queries. */
+            double getNearestNeighborsApproximation() const;
+
+            /** \brief Set the number of threads used to check new samples and the edges at the front of the edge
+             * queue for collision. With more than one thread, the edges the search is about to process are checked
+             * speculatively in parallel and the results are cached in the white- and blacklists of the vertices. The
+             * search itself stays sequential, so the order in which edges are processed does not change. */
+            void setThreadCount(unsigned int threads);
+
+            /** \brief Get the number of threads used for collision checking. */
+            unsigned int getThreadCount() const;
+
             /** \brief Enable "strict sorting" of the edge queue. Rewirings can change the position in the queue of an
              * edge. When strict sorting is enabled, the effected edges are resorted immediately, while disabling strict
              * sorting delays this resorting until the end of the batch. */
@@ -364,6 +384,10 @@ namespace ompl
              * collision checks. */
             bool checkEdge(const VertexConstPtrPair &edge);
 
+            /** \brief Checks \e edge and the edges that follow it at the front of the edge queue for collision in
+             * parallel, and white- or blacklists them accordingly. Requires a thread pool. */
+            void checkEdgesAhead(const VertexPtrPair &edge);
+
             /** \brief Blacklists an edge (useful if an edge is in collision). */
             void blacklistEdge(const VertexPtrPair &edge) const;
 
@@ -548,6 +572,12 @@ namespace ompl
             /** \brief The number of samples per batch. */
             unsigned int samplesPerBatch_{100u};
 
+            /** \brief The number of threads used for collision checking. */
+            unsigned int threadCount_{1u};
+
+            /** \brief The workers used for collision checking, nullptr if threadCount_ is 1. */
+            std::unique_ptr<ThreadPool> threadPool_;
+
             /** \brief Whether to use graph pruning. */
             bool isPruningEnabled_{true};
 
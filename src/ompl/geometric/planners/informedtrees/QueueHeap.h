@@ -0,0 +1,64 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_GEOMETRIC_PLANNERS_INFORMEDTREES_QUEUEHEAP_
+#define OMPL_GEOMETRIC_PLANNERS_INFORMEDTREES_QUEUEHEAP_
+
+#include "ompl/config.h"
+
+#if OMPL_INFORMED_TREES_BINARY_HEAP
+#include "ompl/datastructures/BinaryHeap.h"
+#else
+#include "ompl/datastructures/DAryHeap.h"
+#endif
+
+namespace ompl
+{
+    namespace geometric
+    {
+        /** \brief The heap used for the queues of BIT*, ABIT* and AIT*. It is a 4-ary heap (see DAryHeap), which
+            recycles its elements instead of allocating one per insertion and has shallower trees. If OMPL is
+            configured with OMPL_INFORMED_TREES_BINARY_HEAP, it is BinaryHeap instead; both heaps have the same
+            interface. */
+        template <typename _T, typename LessThan>
+#if OMPL_INFORMED_TREES_BINARY_HEAP
+        using QueueHeap = BinaryHeap<_T, LessThan>;
+#else
+        using QueueHeap = DAryHeap<_T, LessThan>;
+#endif
+    }
+}
+
+#endif
@@ -46,6 +46,7 @@
 #include "ompl/base/Planner.h"
 
 #include "ompl/datastructures/NearestNeighborsGNATNoThreadSafety.h"
+#include "ompl/util/ThreadPool.h"
 
 #include "ompl/geometric/planners/informedtrees/aitstar/Vertex.h"
 
@@ -78,6 +79,10 @@ namespace ompl
                 /** \brief Get the reqire factor of the RGG. */
                 double getRewireFactor() const;
 
+                /** \brief Set the thread pool used to check new samples for validity, or nullptr to check them
+                 * serially. The pool is not owned by the graph. */
+                void setThreadPool(ThreadPool *threadPool);
+
                 /** \brief Whether to use a k-nearest connection model. If false, it uses an r-disc model. */
                 void setUseKNearest(bool useKNearest);
 
@@ -174,6 +179,9 @@ namespace ompl
                 /** \brief The rewire factor of the RGG. */
                 double rewireFactor_{1.0};
 
+                /** \brief The thread pool used to check new samples for validity, if any. */
+                ThreadPool *threadPool_{nullptr};
+
                 /** \brief Whether to track approximate solutions. */
                 bool trackApproximateSolution_{false};
 
@@ -45,7 +45,7 @@
 #include "ompl/base/ScopedState.h"
 #include "ompl/base/SpaceInformation.h"
 #include "ompl/base/State.h"
-#include "ompl/datastructures/BinaryHeap.h"
+#include "ompl/geometric/planners/informedtrees/QueueHeap.h"
 
 #include "ompl/geometric/planners/informedtrees/aitstar/Edge.h"
 
@@ -207,14 +207,14 @@ namespace ompl
 
                 /** \brief Sets the reverse queue pointer of this vertex. */
                 void setReverseQueuePointer(
-                    typename ompl::BinaryHeap<
+                    typename ompl::geometric::QueueHeap<
                         std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>,
                         std::function<bool(const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &,
                                            const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>
                                                &)>>::Element *pointer);
 
                 /** \brief Returns the reverse queue pointer of this vertex. */
-                typename ompl::BinaryHeap<
+                typename ompl::geometric::QueueHeap<
                     std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>,
                     std::function<bool(const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &,
                                        const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &)>>::
@@ -226,36 +226,36 @@ namespace ompl
 
                 /** \brief Adds an element to the forward queue incoming lookup. */
                 void addToForwardQueueIncomingLookup(
-                    typename ompl::BinaryHeap<
+                    typename ompl::geometric::QueueHeap<
                         aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
                         *pointer);
 
                 /** \brief Adds an element to the forward queue outgoing lookup. */
                 void addToForwardQueueOutgoingLookup(
-                    typename ompl::BinaryHeap<
+                    typename ompl::geometric::QueueHeap<
                         aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
                         *pointer);
 
                 /** \brief Returns the forward queue incoming lookup of this vertex. */
-                std::vector<ompl::BinaryHeap<
+                std::vector<ompl::geometric::QueueHeap<
                     aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *>
                 getForwardQueueIncomingLookup() const;
 
                 /** \brief Returns the forward queue outgoing lookup of this vertex. */
-                std::vector<ompl::BinaryHeap<
+                std::vector<ompl::geometric::QueueHeap<
                     aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *>
                 getForwardQueueOutgoingLookup() const;
 
                 /** \brief Remove an element from the incoming queue lookup. */
                 void removeFromForwardQueueIncomingLookup(
-                    ompl::BinaryHeap<aitstar::Edge,
-                                     std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
+                    ompl::geometric::QueueHeap<
+                        aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
                         *element);
 
                 /** \brief Remove an element from the outgoing queue lookup. */
                 void removeFromForwardQueueOutgoingLookup(
-                    ompl::BinaryHeap<aitstar::Edge,
-                                     std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
+                    ompl::geometric::QueueHeap<
+                        aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element
                         *element);
 
                 /** \brief Resets the forward queue incoming lookup. */
@@ -339,7 +339,7 @@ namespace ompl
                 mutable std::size_t reverseQueuePointerId_{0u};
 
                 /** \brief The type of the elements in the reverse queue. */
-                using ReverseQueueElement = typename ompl::BinaryHeap<
+                using ReverseQueueElement = typename ompl::geometric::QueueHeap<
                     std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>,
                     std::function<bool(const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &,
                                        const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &)>>::
@@ -349,7 +349,7 @@ namespace ompl
                 mutable ReverseQueueElement *reverseQueuePointer_{nullptr};
 
                 /** \brief The type of the elements in the forward queue. */
-                using ForwardQueueElement = typename ompl::BinaryHeap<
+                using ForwardQueueElement = typename ompl::geometric::QueueHeap<
                     aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element;
 
                 /** \brief The lookup to incoming edges in the forward queue. */
@@ -92,6 +92,11 @@ namespace ompl
                 return rewireFactor_;
             }
 
+            void ImplicitGraph::setThreadPool(ThreadPool *threadPool)
+            {
+                threadPool_ = threadPool;
+            }
+
             void ImplicitGraph::setUseKNearest(bool useKNearest)
             {
                 useKNearest_ = useKNearest;
@@ -322,21 +327,69 @@ namespace ompl
                 // Create new vertices.
                 std::vector<std::shared_ptr<Vertex>> newVertices;
                 newVertices.reserve(numNewSamples);
-                while (newVertices.size() < numNewSamples)
+                if (threadPool_ == nullptr)
                 {
-                    // Create a new vertex.
-                    newVertices.emplace_back(std::make_shared<Vertex>(spaceInformation_, problemDefinition_, batchId_));
+                    while (newVertices.size() < numNewSamples)
+                    {
+                        // Create a new vertex.
+                        newVertices.emplace_back(
+                            std::make_shared<Vertex>(spaceInformation_, problemDefinition_, batchId_));
 
-                    do
+                        do
+                        {
+                            // Sample the associated state uniformly within the informed set.
+                            sampler_->sampleUniform(newVertices.back()->getState(), solutionCost_);
+
+                            // Count how many states we've checked.
+                            ++numSampledStates_;
+                        } while (
+                            !spaceInformation_->getStateValidityChecker()->isValid(newVertices.back()->getState()));
+
+                        ++numValidSamples_;
+                    }
+                }
+                else
+                {
+                    // The sampler is not thread safe, so sample all missing states first, check them for validity in
+                    // parallel, and resample the invalid ones until the batch is complete.
+                    const auto validityChecker = spaceInformation_->getStateValidityChecker();
+                    std::vector<std::shared_ptr<Vertex>> candidates;
+                    std::vector<char> isValid;
+                    while (newVertices.size() < numNewSamples)
                     {
-                        // Sample the associated state uniformly within the informed set.
-                        sampler_->sampleUniform(newVertices.back()->getState(), solutionCost_);
+                        while (candidates.size() < numNewSamples - newVertices.size())
+                        {
+                            candidates.emplace_back(
+                                std::make_shared<Vertex>(spaceInformation_, problemDefinition_, batchId_));
+                        }
+                        for (const auto &candidate : candidates)
+                        {
+                            sampler_->sampleUniform(candidate->getState(), solutionCost_);
+                            ++numSampledStates_;
+                        }
 
-                        // Count how many states we've checked.
-                        ++numSampledStates_;
-                    } while (!spaceInformation_->getStateValidityChecker()->isValid(newVertices.back()->getState()));
+                        isValid.assign(candidates.size(), 0);
+                        const auto checkCandidate = [&validityChecker, &candidates, &isValid](std::size_t i) {
+                            isValid[i] = validityChecker->isValid(candidates[i]->getState()) ? 1 : 0;
+                        };
+                        threadPool_->parallelFor(candidates.size(), checkCandidate);
 
-                    ++numValidSamples_;
+                        // Keep the valid samples and reuse the vertices of the invalid ones.
+                        std::size_t numInvalid = 0u;
+                        for (std::size_t i = 0u; i < candidates.size(); ++i)
+                        {
+                            if (isValid[i] != 0)
+                            {
+                                newVertices.emplace_back(candidates[i]);
+                                ++numValidSamples_;
+                            }
+                            else
+                            {
+                                candidates[numInvalid++] = candidates[i];
+                            }
+                        }
+                        candidates.resize(numInvalid);
+                    }
                 }
 
                 // Add all new vertices to the nearest neighbor structure.
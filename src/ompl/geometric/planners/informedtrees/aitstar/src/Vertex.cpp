@@ -333,7 +333,9 @@ namespace ompl
             {
                 for (const auto &whitelistedChild : whitelistedChildren_)
                 {
-                    if (whitelistedChild.lock()->getId() == vertex->getId())
+                    // The child might have been pruned since it was listed.
+                    const auto child = whitelistedChild.lock();
+                    if (child && child->getId() == vertex->getId())
                     {
                         return true;
                     }
@@ -350,7 +352,9 @@ namespace ompl
             {
                 for (const auto &blacklistedChild : blacklistedChildren_)
                 {
-                    if (blacklistedChild.lock()->getId() == vertex->getId())
+                    // The child might have been pruned since it was listed.
+                    const auto child = blacklistedChild.lock();
+                    if (child && child->getId() == vertex->getId())
                     {
                         return true;
                     }
@@ -439,7 +443,7 @@ namespace ompl
             }
 
             void Vertex::setReverseQueuePointer(
-                typename ompl::BinaryHeap<
+                typename ompl::geometric::QueueHeap<
                     std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>,
                     std::function<bool(const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &,
                                        const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &)>>::
@@ -449,7 +453,7 @@ namespace ompl
                 reverseQueuePointer_ = pointer;
             }
 
-            typename ompl::BinaryHeap<
+            typename ompl::geometric::QueueHeap<
                 std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>>,
                 std::function<bool(const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &,
                                    const std::pair<std::array<ompl::base::Cost, 2u>, std::shared_ptr<Vertex>> &)>>::
@@ -469,27 +473,27 @@ namespace ompl
             }
 
             void Vertex::addToForwardQueueIncomingLookup(
-                typename ompl::BinaryHeap<
+                typename ompl::geometric::QueueHeap<
                     aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *pointer)
             {
                 forwardQueueIncomingLookup_.emplace_back(pointer);
             }
 
             void Vertex::addToForwardQueueOutgoingLookup(
-                typename ompl::BinaryHeap<
+                typename ompl::geometric::QueueHeap<
                     aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *pointer)
             {
                 forwardQueueOutgoingLookup_.emplace_back(pointer);
             }
 
-            typename std::vector<ompl::BinaryHeap<
+            typename std::vector<ompl::geometric::QueueHeap<
                 aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *>
             Vertex::getForwardQueueIncomingLookup() const
             {
                 return forwardQueueIncomingLookup_;
             }
 
-            typename std::vector<ompl::BinaryHeap<
+            typename std::vector<ompl::geometric::QueueHeap<
                 aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *>
             Vertex::getForwardQueueOutgoingLookup() const
             {
@@ -497,16 +501,16 @@ namespace ompl
             }
 
             void Vertex::removeFromForwardQueueIncomingLookup(
-                ompl::BinaryHeap<aitstar::Edge,
-                                 std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *element)
+                ompl::geometric::QueueHeap<
+                    aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *element)
             {
                 forwardQueueIncomingLookup_.erase(
                     std::remove(forwardQueueIncomingLookup_.begin(), forwardQueueIncomingLookup_.end(), element));
             }
 
             void Vertex::removeFromForwardQueueOutgoingLookup(
-                ompl::BinaryHeap<aitstar::Edge,
-                                 std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *element)
+                ompl::geometric::QueueHeap<
+                    aitstar::Edge, std::function<bool(const aitstar::Edge &, const aitstar::Edge &)>>::Element *element)
             {
                 forwardQueueOutgoingLookup_.erase(
                     std::remove(forwardQueueOutgoingLookup_.begin(), forwardQueueOutgoingLookup_.end(), element));
@@ -200,6 +200,16 @@ namespace ompl
             /** \brief Get whether a k-nearest search is being used.*/
             bool getUseKNearest() const;
 
+            /** \brief Set the approximation factor for nearest neighbor queries. */
+            void setNearestNeighborsApproximation(double epsilon);
+
+            /** \brief Get the approximation factor for nearest neighbor queries. */
+            double getNearestNeighborsApproximation() const;
+
+            /** \brief Set the thread pool used to check new samples for validity. nullptr checks them serially. The
+             * pool is not owned by the graph. */
+            void setThreadPool(ThreadPool *threadPool);
+
             /** Enable sampling "just-in-time", i.e., only when necessary for a nearest-neighbour search. */
             void setJustInTimeSampling(bool useJit);
 
@@ -463,6 +473,12 @@ namespace ompl
             /** \brief Option to use k-nearest search for rewiring. */
             bool useKNearest_{true};
 
+            /** \brief The approximation factor for nearest neighbor queries. */
+            double nnApproximation_{0.0};
+
+            /** \brief The thread pool used to check new samples for validity, if any. */
+            ThreadPool *threadPool_{nullptr};
+
             /** \brief Whether to use just-in-time sampling. */
             bool useJustInTimeSampling_{false};
 
@@ -46,7 +46,7 @@
 
 #include "ompl/base/Cost.h"
 #include "ompl/base/OptimizationObjective.h"
-#include "ompl/datastructures/BinaryHeap.h"
+#include "ompl/geometric/planners/informedtrees/QueueHeap.h"
 #include "ompl/datastructures/NearestNeighbors.h"
 #include "ompl/geometric/planners/informedtrees/BITstar.h"
 
@@ -57,7 +57,7 @@ namespace ompl
         /** @anchor SearchQueue
         \par Short Description
         A search queue holding edges ordered on a sort key, i.e., a cost triple with a lexicographical comparison.
-        The queue is implemented as a binary heap.
+        The queue is implemented as a 4-ary heap by default (see QueueHeap).
         */
 
         /** \brief A queue of edges, sorted according to a sort key. */
@@ -71,16 +71,16 @@ namespace ompl
             /** \brief A triplet of costs, i.e., the edge queue sorting key. */
             using SortKey = std::array<ompl::base::Cost, 3u>;
 
-            /** \brief The data stored in the edge-queue binary heap. */
+            /** \brief The data stored in the edge-queue heap. */
             using SortKeyAndVertexPtrPair = std::pair<SortKey, VertexPtrPair>;
 
             /** \brief The function signature of the sorting function for the Edge Queue*/
             using EdgeComparisonFunction = std::function<bool(const SortKeyAndVertexPtrPair &, const SortKeyAndVertexPtrPair &)>;
 
             /** \brief The underlying edge queue. Using static keys for the same reason as the Vertex Queue */
-            using EdgeQueue = ompl::BinaryHeap<SortKeyAndVertexPtrPair, EdgeComparisonFunction>;
+            using EdgeQueue = ompl::geometric::QueueHeap<SortKeyAndVertexPtrPair, EdgeComparisonFunction>;
 
-            /** \brief An element pointer into the edge queue binary heap */
+            /** \brief An element pointer into the edge queue heap */
             using EdgeQueueElemPtr = EdgeQueue::Element*;
 
             /** \brief A vector of edge queue pointers */
@@ -128,6 +128,10 @@ namespace ompl
             /** \brief Get the best edge on the queue, leaving it at the front of the edge queue. */
             VertexPtrPair getFrontEdge();
 
+            /** \brief Append the (up to) \e count best edges on the queue to \e edges, in order, leaving them in the
+             * queue. */
+            void getFrontEdges(std::size_t count, VertexPtrPairVector *edges) const;
+
             /** \brief Get the value of the best edge on the queue, leaving it at the front of the edge queue. */
             SortKey getFrontEdgeValue();
 
@@ -110,6 +110,7 @@ namespace ompl
             if (!static_cast<bool>(samples_))
             {
                 samples_.reset(ompl::tools::SelfConfig::getDefaultNearestNeighbors<VertexPtr>(plannerPtr));
+                samples_->setApproximationFactor(nnApproximation_);
             }
             // No else, already allocated (by a call to setNearestNeighbors())
 
@@ -963,24 +964,54 @@ namespace ompl
                 // Actually generate the new samples
                 VertexPtrVector newStates{};
                 newStates.reserve(numRequiredSamples);
-                for (std::size_t tries = 0u;
-                     tries < averageNumOfAllowedFailedAttemptsWhenSampling_ * numRequiredSamples &&
-                     numSamples_ < numRequiredSamples;
-                     ++tries)
+                VertexPtrVector candidates{};
+                std::vector<char> isValid{};
+                const std::size_t maxTries = averageNumOfAllowedFailedAttemptsWhenSampling_ * numRequiredSamples;
+                for (std::size_t tries = 0u; tries < maxTries && numSamples_ < numRequiredSamples;)
                 {
-                    // Variable
-                    // The new state:
-                    auto newState =
-                        std::make_shared<Vertex>(spaceInformation_, costHelpPtr_, queuePtr_, approximationId_);
+                    // Draw one state at a time, or as many as are still missing if they can be checked in parallel.
+                    const std::size_t numCandidates =
+                        threadPool_ == nullptr ? 1u :
+                                                 std::min<std::size_t>(numRequiredSamples - numSamples_, maxTries - tries);
+                    candidates.clear();
+                    for (std::size_t i = 0u; i < numCandidates; ++i, ++tries)
+                    {
+                        // Variable
+                        // The new state:
+                        auto newState =
+                            std::make_shared<Vertex>(spaceInformation_, costHelpPtr_, queuePtr_, approximationId_);
+
+                        // Sample in the interval [costSampled_, costReqd):
+                        if (sampler_->sampleUniform(newState->state(), sampledCost_, requiredCost))
+                        {
+                            candidates.push_back(newState);
+                        }
+                        // No else
+                    }
+
+                    // Check the candidates for collision.
+                    numStateCollisionChecks_ += candidates.size();
+                    isValid.assign(candidates.size(), 0);
+                    const auto checkCandidate = [this, &candidates, &isValid](std::size_t i)
+                    { isValid[i] = spaceInformation_->isValid(candidates[i]->state()) ? 1 : 0; };
+                    if (threadPool_ != nullptr)
+                    {
+                        threadPool_->parallelFor(candidates.size(), checkCandidate);
+                    }
+                    else
+                    {
+                        for (std::size_t i = 0u; i < candidates.size(); ++i)
+                        {
+                            checkCandidate(i);
+                        }
+                    }
 
-                    // Sample in the interval [costSampled_, costReqd):
-                    if (sampler_->sampleUniform(newState->state(), sampledCost_, requiredCost))
+                    // If a state is collision free, add it to the set of free states
+                    for (std::size_t i = 0u; i < candidates.size(); ++i)
                     {
-                        // If the state is collision free, add it to the set of free states
-                        ++numStateCollisionChecks_;
-                        if (spaceInformation_->isValid(newState->state()))
+                        if (isValid[i] != 0)
                         {
-                            newStates.push_back(newState);
+                            newStates.push_back(candidates[i]);
 
                             // Update the number of uniformly distributed states
                             ++numUniformStates_;
@@ -1586,6 +1617,33 @@ namespace ompl
             return useKNearest_;
         }
 
+        void BITstar::ImplicitGraph::setNearestNeighborsApproximation(double epsilon)
+        {
+            if (epsilon < 0.0)
+            {
+                throw ompl::Exception("The nearest neighbors approximation factor must be non-negative.");
+            }
+
+            // Store
+            nnApproximation_ = epsilon;
+
+            // Update the existing structure, if any
+            if (static_cast<bool>(samples_))
+            {
+                samples_->setApproximationFactor(nnApproximation_);
+            }
+        }
+
+        double BITstar::ImplicitGraph::getNearestNeighborsApproximation() const
+        {
+            return nnApproximation_;
+        }
+
+        void BITstar::ImplicitGraph::setThreadPool(ThreadPool *threadPool)
+        {
+            threadPool_ = threadPool;
+        }
+
         void BITstar::ImplicitGraph::setJustInTimeSampling(bool useJit)
         {
             // Assure that we're not trying to enable k-nearest with JIT sampling already on
@@ -200,6 +200,18 @@ namespace ompl
             return edgeQueue_.top()->data.second;
         }
 
+        void BITstar::SearchQueue::getFrontEdges(std::size_t count, VertexPtrPairVector *edges) const
+        {
+            ASSERT_SETUP
+
+            std::vector<EdgeQueue::Element *> front;
+            edgeQueue_.getTop(count, front);
+            for (const auto &element : front)
+            {
+                edges->push_back(element->data.second);
+            }
+        }
+
         BITstar::SearchQueue::SortKey BITstar::SearchQueue::getFrontEdgeValue()
         {
             ASSERT_SETUP
@@ -438,7 +450,7 @@ namespace ompl
             // Clear the inout argument.
             edgeQueue->clear();
 
-            // Get the contents on the binary heap (key and edge).
+            // Get the contents of the heap (key and edge).
             std::vector<SortKeyAndVertexPtrPair> queueContents;
             edgeQueue_.getContent(queueContents);
 
@@ -35,6 +35,7 @@
 // Authors: Marlin Strub
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <string>
 
@@ -89,6 +90,7 @@ namespace ompl
             declareParam<bool>("use_graph_pruning", this, &AITstar::enablePruning, &AITstar::isPruningEnabled, "0,1");
             declareParam<bool>("find_approximate_solutions", this, &AITstar::trackApproximateSolutions,
                                &AITstar::areApproximateSolutionsTracked, "0,1");
+            declareParam<unsigned int>("threads", this, &AITstar::setThreadCount, &AITstar::getThreadCount, "1:64");
 
             // Register the progress properties.
             addPlannerProgressProperty("iterations INTEGER", [this]() { return std::to_string(numIterations_); });
@@ -154,6 +156,7 @@ namespace ompl
 
         void AITstar::clear()
         {
+            collectEdgeChecks(true);
             graph_.clear();
             forwardQueue_.clear();
             reverseQueue_.clear();
@@ -216,6 +219,9 @@ namespace ompl
                 iterate();
             }
 
+            // Don't leave edge checks running on the worker threads between calls to solve.
+            collectEdgeChecks(true);
+
             // Someone might call ProblemDefinition::clearSolutionPaths() between invokations of Planner::solve(), in
             // which case previously found solutions are not registered with the problem definition anymore.
             updateExactSolution();
@@ -361,6 +367,21 @@ namespace ompl
             repairReverseSearch_ = repairReverseSearch;
         }
 
+        void AITstar::setThreadCount(unsigned int threads)
+        {
+            // The checks that are still running need the current workers.
+            collectEdgeChecks(true);
+            threadCount_ = std::max(1u, threads);
+            graph_.setThreadPool(nullptr);
+            threadPool_.reset(threadCount_ > 1u ? new ThreadPool(threadCount_ - 1u) : nullptr);
+            graph_.setThreadPool(threadPool_.get());
+        }
+
+        unsigned int AITstar::getThreadCount() const
+        {
+            return threadCount_;
+        }
+
         void AITstar::rebuildForwardQueue()
         {
             // Get all edges from the queue.
@@ -575,6 +596,13 @@ namespace ompl
             // Keep track of the number of iterations.
             ++numIterations_;
 
+            // Keep the worker threads busy with the most promising edges of the forward queue.
+            if (threadPool_)
+            {
+                collectEdgeChecks(false);
+                dispatchEdgeChecks();
+            }
+
             // If the algorithm is in a state that requires performing a reverse search iteration, try to perform one.
             if (performReverseSearchIteration_)
             {
@@ -788,16 +816,8 @@ namespace ompl
                 // If the edge cannot improve the cost to come to the child, we're done processing it.
                 return;
             }  // The edge can possibly improve the solution and the path to the child. Let's check it for collision.
-            else if (parent->isWhitelistedAsChild(child) ||
-                     motionValidator_->checkMotion(parent->getState(), child->getState()))
+            else if (checkEdge(parent, child))
             {
-                // Remember that this is a good edge.
-                if (!parent->isWhitelistedAsChild(child))
-                {
-                    parent->whitelistAsChild(child);
-                    numEdgeCollisionChecks_++;
-                }
-
                 // Compute the edge cost.
                 auto edgeCost = objective_->motionCost(parent->getState(), child->getState());
 
@@ -846,8 +866,7 @@ namespace ompl
             }
             else
             {
-                // This child should be blacklisted.
-                parent->blacklistAsChild(child);
+                // The edge is invalid; checkEdge() has blacklisted the child.
 
                 // If desired, now is the time to repair the reverse search.
                 if (repairReverseSearch_)
@@ -890,6 +909,108 @@ namespace ompl
             }
         }
 
+        bool AITstar::checkEdge(const std::shared_ptr<aitstar::Vertex> &parent,
+                                const std::shared_ptr<aitstar::Vertex> &child)
+        {
+            // Edges that have been checked before don't need to be checked again.
+            if (parent->isWhitelistedAsChild(child))
+            {
+                return true;
+            }
+            if (parent->isBlacklistedAsChild(child))
+            {
+                return false;
+            }
+
+            // Use the result of a check on the worker threads if there is one, otherwise check the edge here.
+            bool isValid;
+            auto edgeCheck = edgeChecks_.find(std::make_pair(parent->getId(), child->getId()));
+            if (edgeCheck != edgeChecks_.end())
+            {
+                isValid = edgeCheck->second.isValid.get();
+                edgeChecks_.erase(edgeCheck);
+            }
+            else
+            {
+                isValid = motionValidator_->checkMotion(parent->getState(), child->getState());
+            }
+            ++numEdgeCollisionChecks_;
+
+            // Remember the outcome. Edges that were known to be invalid returned above, so each blacklisted child
+            // is only recorded once, also when it was blacklisted by collectEdgeChecks().
+            if (isValid)
+            {
+                parent->whitelistAsChild(child);
+            }
+            else
+            {
+                parent->blacklistAsChild(child);
+            }
+            return isValid;
+        }
+
+        void AITstar::dispatchEdgeChecks()
+        {
+            // Keep a few checks per thread in flight.
+            const std::size_t maxNumEdgeChecks = 2u * threadCount_;
+            if (edgeChecks_.size() >= maxNumEdgeChecks || forwardQueue_.empty())
+            {
+                return;
+            }
+
+            std::vector<EdgeQueue::Element *> frontEdges;
+            forwardQueue_.getTop(maxNumEdgeChecks, frontEdges);
+            for (const auto &element : frontEdges)
+            {
+                if (edgeChecks_.size() >= maxNumEdgeChecks)
+                {
+                    break;
+                }
+
+                // Skip edges that are already known, are being checked, or are part of the forward tree.
+                const auto parent = element->data.getParent();
+                const auto child = element->data.getChild();
+                const auto key = std::make_pair(parent->getId(), child->getId());
+                if (edgeChecks_.count(key) != 0u || parent->isWhitelistedAsChild(child) ||
+                    parent->isBlacklistedAsChild(child) ||
+                    (child->hasForwardParent() && child->getForwardParent()->getId() == parent->getId()))
+                {
+                    continue;
+                }
+
+                // The task only touches the states, the vertices are kept alive by the edge check.
+                auto task = std::make_shared<std::packaged_task<bool()>>(
+                    [motionValidator = motionValidator_, parentState = parent->getState(),
+                     childState = child->getState()] { return motionValidator->checkMotion(parentState, childState); });
+                edgeChecks_.emplace(key, EdgeCheck{parent, child, task->get_future()});
+                threadPool_->post([task] { (*task)(); });
+            }
+        }
+
+        void AITstar::collectEdgeChecks(bool wait)
+        {
+            for (auto edgeCheck = edgeChecks_.begin(); edgeCheck != edgeChecks_.end();)
+            {
+                auto &isValid = edgeCheck->second.isValid;
+                if (!wait && isValid.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    ++edgeCheck;
+                    continue;
+                }
+
+                if (isValid.get())
+                {
+                    edgeCheck->second.parent->whitelistAsChild(edgeCheck->second.child);
+                }
+                else
+                {
+                    edgeCheck->second.parent->blacklistAsChild(edgeCheck->second.child);
+                }
+                ++numEdgeCollisionChecks_;
+                edgeCheck = edgeChecks_.erase(edgeCheck);
+            }
+        }
+
         void AITstar::performReverseSearchIteration()
         {
             assert(!reverseQueue_.empty());
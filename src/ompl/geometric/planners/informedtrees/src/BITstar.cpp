@@ -93,6 +93,10 @@ namespace ompl
             Planner::declareParam<bool>("use_k_nearest", this, &BITstar::setUseKNearest, &BITstar::getUseKNearest,
                                         "0,"
                                         "1");
+            Planner::declareParam<double>("nn_approximation", this, &BITstar::setNearestNeighborsApproximation,
+                                          &BITstar::getNearestNeighborsApproximation, "0.:.05:1.");
+            Planner::declareParam<unsigned int>("threads", this, &BITstar::setThreadCount, &BITstar::getThreadCount,
+                                                "1:64");
             Planner::declareParam<bool>("use_graph_pruning", this, &BITstar::setPruning, &BITstar::getPruning,
                                         "0,"
                                         "1");
@@ -575,6 +579,14 @@ namespace ompl
                                                            costHelpPtr_->costToGoHeuristic(edge.second)),
                                 bestCost_))
                         {
+                            // With multiple threads, check this edge together with the ones the search is likely
+                            // to process next.
+                            if (threadPool_ && !edge.first->isWhitelistedAsChild(edge.second) &&
+                                !edge.first->isBlacklistedAsChild(edge.second))
+                            {
+                                this->checkEdgesAhead(edge);
+                            }
+
                             // Does this edge have a collision?
                             if (this->checkEdge(edge))
                             {
@@ -799,7 +811,8 @@ namespace ompl
         bool BITstar::checkEdge(const VertexConstPtrPair &edge)
         {
 #ifdef BITSTAR_DEBUG
-            if (edge.first->isBlacklistedAsChild(edge.second))
+            // Edges that are still in the queue may have been blacklisted by checkEdgesAhead.
+            if (!threadPool_ && edge.first->isBlacklistedAsChild(edge.second))
             {
                 throw ompl::Exception("A blacklisted edge made it into the edge queue.");
             }
@@ -809,6 +822,11 @@ namespace ompl
             {
                 return true;
             }
+            // If it is blacklisted, it has already been found to be in collision.
+            if (edge.first->isBlacklistedAsChild(edge.second))
+            {
+                return false;
+            }
             else  // This is a new edge, we need to check whether it is feasible.
             {
                 ++numEdgeCollisionChecks_;
@@ -816,6 +834,51 @@ namespace ompl
             }
         }
 
+        void BITstar::checkEdgesAhead(const VertexPtrPair &edge)
+        {
+            // Gather the edges at the front of the queue that would pass the same heuristic tests as the current one.
+            VertexPtrPairVector frontEdges{};
+            queuePtr_->getFrontEdges(2u * threadCount_ - 1u, &frontEdges);
+            VertexPtrPairVector edges{edge};
+            for (const auto &frontEdge : frontEdges)
+            {
+                if (frontEdge.first->isWhitelistedAsChild(frontEdge.second) ||
+                    frontEdge.first->isBlacklistedAsChild(frontEdge.second) ||
+                    (frontEdge.second->hasParent() && frontEdge.second->getParent()->getId() == frontEdge.first->getId()))
+                {
+                    continue;
+                }
+                if (costHelpPtr_->isCostBetterThan(
+                        costHelpPtr_->inflateCost(costHelpPtr_->currentHeuristicEdge(frontEdge), truncationFactor_),
+                        bestCost_) &&
+                    costHelpPtr_->isCostBetterThan(costHelpPtr_->currentHeuristicToTarget(frontEdge),
+                                                   frontEdge.second->getCost()))
+                {
+                    edges.push_back(frontEdge);
+                }
+            }
+
+            // Check them all at once.
+            std::vector<char> isValid(edges.size(), 0);
+            threadPool_->parallelFor(edges.size(), [this, &edges, &isValid](std::size_t i) {
+                isValid[i] = Planner::si_->checkMotion(edges[i].first->state(), edges[i].second->state()) ? 1 : 0;
+            });
+            numEdgeCollisionChecks_ += edges.size();
+
+            // Remember the results, so that the search does not check these edges again.
+            for (std::size_t i = 0u; i < edges.size(); ++i)
+            {
+                if (isValid[i] != 0)
+                {
+                    this->whitelistEdge(edges[i]);
+                }
+                else
+                {
+                    this->blacklistEdge(edges[i]);
+                }
+            }
+        }
+
         void BITstar::addEdge(const VertexPtrPair &edge, const ompl::base::Cost &edgeCost)
         {
 #ifdef BITSTAR_DEBUG
@@ -1211,6 +1274,29 @@ namespace ompl
             return graphPtr_->getUseKNearest();
         }
 
+        void BITstar::setNearestNeighborsApproximation(double epsilon)
+        {
+            graphPtr_->setNearestNeighborsApproximation(epsilon);
+        }
+
+        double BITstar::getNearestNeighborsApproximation() const
+        {
+            return graphPtr_->getNearestNeighborsApproximation();
+        }
+
+        void BITstar::setThreadCount(unsigned int threads)
+        {
+            threadCount_ = std::max(1u, threads);
+            graphPtr_->setThreadPool(nullptr);
+            threadPool_.reset(threadCount_ > 1u ? new ThreadPool(threadCount_ - 1u) : nullptr);
+            graphPtr_->setThreadPool(threadPool_.get());
+        }
+
+        unsigned int BITstar::getThreadCount() const
+        {
+            return threadCount_;
+        }
+
         void BITstar::setStrictQueueOrdering(bool /* beStrict */)
         {
             OMPL_WARN("%s: This option no longer has any effect; The queue is always strictly ordered.",
@@ -38,9 +38,13 @@
 #define OMPL_GEOMETRIC_PLANNERS_PRM_LAZY_PRM_
 
 #include "ompl/geometric/planners/PlannerIncludes.h"
+#include "ompl/base/FlatRoadmap.h"
 #include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/util/ThreadPool.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 #include <map>
@@ -149,6 +153,13 @@ namespace ompl
             /** \brief Constructor */
             LazyPRM(const base::PlannerData &data, bool starStrategy = false);
 
+            /** \brief Constructor. The roadmap is initialized with the vertices and edges of \e roadmap. The states
+                are deserialized from the mapped file into states of the planner, which are then added to the
+                nearest-neighbor structure. All vertices and edges are marked as not yet validated; edges stored in
+                both directions are added once. */
+            LazyPRM(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap,
+                    bool starStrategy = false);
+
             ~LazyPRM() override;
 
             /** \brief Set the maximum length of a motion to be added to the roadmap. */
@@ -220,6 +231,19 @@ namespace ompl
                 connectionFilter_ = connectionFilter;
             }
 
+            /** \brief Set the number of threads used to check the vertices and edges of a
+                candidate solution path for validity. With more than one thread, all the unchecked
+                vertices and edges of the path are checked concurrently; once one of them is found
+                to be invalid, checks that have not started yet are skipped. The default is 1
+                (the path is checked sequentially). */
+            void setValidationThreads(unsigned int threads);
+
+            /** \brief Get the number of threads used to check candidate solution paths */
+            unsigned int getValidationThreads() const
+            {
+                return validationThreads_;
+            }
+
             /** \brief Return the number of milestones currently in the graph */
             unsigned long int milestoneCount() const
             {
@@ -295,6 +319,17 @@ namespace ompl
              * it as the solution */
             ompl::base::PathPtr constructSolution(const Vertex &start, const Vertex &goal);
 
+            /** \brief Check the vertices and edges of the candidate path \e path (from the goal to the start
+                vertex) concurrently and update the roadmap. Return the path if it is valid. */
+            ompl::base::PathPtr validatePathParallel(const std::vector<Vertex> &path);
+
+            /** \brief Remove invalid milestones from the roadmap and update the connected components
+                of their neighbors (\e start is a vertex of the component the milestones were part of) */
+            void removeMilestones(const Vertex &start, const std::set<Vertex> &milestonesToRemove);
+
+            /** \brief Remove an invalid edge from the roadmap and update the connected components */
+            void removeInvalidEdge(Vertex a, Vertex b);
+
             /** \brief Compute distance between two milestones (this is simply distance between the states of the
              * milestones) */
             double distanceFunction(const Vertex a, const Vertex b) const
@@ -367,6 +402,12 @@ namespace ompl
 
             base::Cost bestCost_{std::numeric_limits<double>::quiet_NaN()};
 
+            /** \brief Number of threads used to check candidate solution paths */
+            unsigned int validationThreads_{1u};
+
+            /** \brief Worker threads used to check candidate solution paths */
+            std::unique_ptr<ThreadPool> validationPool_;
+
             unsigned long int iterations_{0};
         };
     }
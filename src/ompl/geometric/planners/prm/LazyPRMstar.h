@@ -71,6 +71,9 @@ namespace ompl
 
             /** \brief Constructor */
             LazyPRMstar(const base::PlannerData &data);
+
+            /** \brief Constructor */
+            LazyPRMstar(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap);
         };
     }
 }
@@ -38,10 +38,14 @@
 #define OMPL_GEOMETRIC_PLANNERS_PRM_PRM_
 
 #include "ompl/geometric/planners/PlannerIncludes.h"
+#include "ompl/base/FlatRoadmap.h"
 #include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/util/ThreadPool.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/pending/disjoint_sets.hpp>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -146,6 +150,11 @@ namespace ompl
             /** \brief Constructor */
             PRM(const base::PlannerData &data, bool starStrategy = false);
 
+            /** \brief Constructor. The roadmap is initialized with the vertices and edges of \e roadmap. The states
+                are deserialized from the mapped file into states of the planner, which are then added to the
+                nearest-neighbor structure. Edges stored in both directions are added once. */
+            PRM(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap, bool starStrategy = false);
+
             ~PRM() override;
 
             void setProblemDefinition(const base::ProblemDefinitionPtr &pdef) override;
@@ -201,6 +210,31 @@ namespace ompl
                 connectionFilter_ = connectionFilter;
             }
 
+            /** \brief Set the number of threads that grow the roadmap. With more than one thread,
+                each thread samples valid milestones and checks the connections to their neighbors
+                concurrently; the lock on the roadmap is only taken to insert a batch of milestones
+                and, later, the connections found to be valid. The state validity checker and the
+                optimization objective must be thread safe. The default is 1. */
+            void setThreadCount(unsigned int threads);
+
+            /** \brief Get the number of threads that grow the roadmap */
+            unsigned int getThreadCount() const
+            {
+                return threadCount_;
+            }
+
+            /** \brief Allow the nearest neighbor queries used to connect milestones to return approximate results, with
+                approximation factor \e epsilon (see NearestNeighbors::setApproximationFactor()). Larger
+                values make the queries faster at the cost of slightly worse roadmap connectivity. The default of 0 means
+                exact queries. */
+            void setNearestNeighborsApproximation(double epsilon);
+
+            /** \brief Get the approximation factor for nearest neighbor queries */
+            double getNearestNeighborsApproximation() const
+            {
+                return nnApproximation_;
+            }
+
             void getPlannerData(base::PlannerData &data) const override;
 
             /** \brief While the termination condition allows, this function will construct the roadmap (using
@@ -311,6 +345,13 @@ namespace ompl
                  \e ptc returns true.  Use \e workState as temporary memory. */
             void growRoadmap(const base::PlannerTerminationCondition &ptc, base::State *workState);
 
+            /** \brief Grow the roadmap on getThreadCount() threads until \e ptc evaluates true */
+            void growRoadmapParallel(const base::PlannerTerminationCondition &ptc);
+
+            /** \brief The work done by each thread in growRoadmapParallel(): sample batches of valid
+                states with \e sampler, add them to the roadmap and connect them to their neighbors. */
+            void growRoadmapWorker(const base::PlannerTerminationCondition &ptc, base::ValidStateSampler *sampler);
+
             /** \brief Attempt to connect disjoint components in the
                 roadmap using random bounding motions (the PRM
                 expansion step) */
@@ -423,6 +464,28 @@ namespace ompl
             /** \brief Mutex to guard access to the Graph member (g_) */
             mutable std::mutex graphMutex_;
 
+            /** \brief Notified (with graphMutex_ held) when two connected components of the roadmap are
+                merged or roadmap construction stops */
+            std::condition_variable componentsMergedCondition_;
+
+            /** \brief The number of times two connected components of the roadmap were merged */
+            unsigned long int componentMerges_{0};
+
+            /** \brief Flag telling the thread that checks for solutions to stop */
+            bool stopSolutionCheck_{false};
+
+            /** \brief The number of threads that grow the roadmap */
+            unsigned int threadCount_{1u};
+
+            /** \brief The approximation factor for nearest neighbor queries */
+            double nnApproximation_{0.0};
+
+            /** \brief Worker threads used to grow the roadmap */
+            std::unique_ptr<ThreadPool> roadmapPool_;
+
+            /** \brief Valid state samplers for the threads that grow the roadmap */
+            std::vector<base::ValidStateSamplerPtr> workerSamplers_;
+
             /** \brief Objective cost function for PRM graph edges */
             base::OptimizationObjectivePtr opt_;
 
@@ -69,6 +69,8 @@ namespace ompl
             PRMstar(const base::SpaceInformationPtr &si);
             /** \brief Constructor */
             PRMstar(const base::PlannerData &data);
+            /** \brief Constructor */
+            PRMstar(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap);
 
         };
     }
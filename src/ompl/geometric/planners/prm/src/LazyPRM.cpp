@@ -43,6 +43,8 @@
 #include <boost/graph/incremental_components.hpp>
 #include <boost/graph/lookup_edge.hpp>
 #include <boost/foreach.hpp>
+#include <algorithm>
+#include <atomic>
 #include <queue>
 
 #include "GoalVisitor.hpp"
@@ -82,6 +84,8 @@ ompl::geometric::LazyPRM::LazyPRM(const base::SpaceInformationPtr &si, bool star
     if (!starStrategy_)
         Planner::declareParam<unsigned int>("max_nearest_neighbors", this, &LazyPRM::setMaxNearestNeighbors,
                                             std::string("8:1000"));
+    Planner::declareParam<unsigned int>("validation_threads", this, &LazyPRM::setValidationThreads,
+                                        &LazyPRM::getValidationThreads, "1:64");
 
     addPlannerProgressProperty("iterations INTEGER", [this]
                                {
@@ -148,6 +152,49 @@ ompl::geometric::LazyPRM::LazyPRM(const base::PlannerData &data, bool starStrate
     }
 }
 
+ompl::geometric::LazyPRM::LazyPRM(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap,
+                                  bool starStrategy)
+  : LazyPRM(si, starStrategy)
+{
+    if (roadmap.numVertices() == 0)
+        return;
+
+    // vertices are created in the order of the roadmap, so the index of a vertex in the roadmap is the index
+    // of the corresponding Vertex in the graph
+    std::vector<Vertex> vertices(roadmap.numVertices());
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        Vertex m = boost::add_vertex(g_);
+        stateProperty_[m] = si_->allocState();
+        roadmap.copyState(i, stateProperty_[m]);
+        vertexValidityProperty_[m] = VALIDITY_UNKNOWN;
+        unsigned long int newComponent = componentCount_++;
+        vertexComponentProperty_[m] = newComponent;
+        vertices[i] = m;
+    }
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        const std::uint32_t *neighbors = roadmap.getNeighbors(i);
+        const double *weights = roadmap.getEdgeWeights(i);
+        for (std::size_t j = 0; j < roadmap.getNeighborCount(i); ++j)
+        {
+            std::size_t n = neighbors[j];
+            if (n < i && roadmap.edgeExists(n, i))
+                continue;  // the reverse edge was added already
+            const Graph::edge_property_type properties(base::Cost(weights[j]));
+            const Edge &edge = boost::add_edge(vertices[i], vertices[n], properties, g_).first;
+            edgeValidityProperty_[edge] = VALIDITY_UNKNOWN;
+            uniteComponents(vertices[i], vertices[n]);
+        }
+    }
+
+    specs_.multithreaded = false;  // temporarily set to false since nn_ is used only in single thread
+    nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Vertex>(this));
+    specs_.multithreaded = true;
+    nn_->setDistanceFunction([this](const Vertex a, const Vertex b) { return distanceFunction(a, b); });
+    nn_->add(vertices);
+}
+
 ompl::geometric::LazyPRM::~LazyPRM() = default;
 
 void ompl::geometric::LazyPRM::setup()
@@ -206,6 +253,12 @@ void ompl::geometric::LazyPRM::setRange(double distance)
         setup();
 }
 
+void ompl::geometric::LazyPRM::setValidationThreads(unsigned int threads)
+{
+    validationThreads_ = std::max(1u, threads);
+    validationPool_.reset();
+}
+
 void ompl::geometric::LazyPRM::setMaxNearestNeighbors(unsigned int k)
 {
     if (starStrategy_)
@@ -519,6 +572,15 @@ ompl::base::PathPtr ompl::geometric::LazyPRM::constructSolution(const Vertex &st
     if (prev[goal] == goal)
         throw Exception(name_, "Could not find solution path");
 
+    if (validationThreads_ > 1)
+    {
+        std::vector<Vertex> path(1, goal);
+        for (Vertex pos = prev[goal]; prev[pos] != pos; pos = prev[pos])
+            path.push_back(pos);
+        path.push_back(start);
+        return validatePathParallel(path);
+    }
+
     // First, get the solution states without copying them, and check them for validity.
     // We do all the node validity checks for the vertices, as this may remove a larger
     // part of the graph (compared to removing an edge).
@@ -543,34 +605,7 @@ ompl::base::PathPtr ompl::geometric::LazyPRM::constructSolution(const Vertex &st
     // rather than collision checking, so this modification is in the spirit of the paper.
     if (!milestonesToRemove.empty())
     {
-        unsigned long int comp = vertexComponentProperty_[start];
-        // Remember the current neighbors.
-        std::set<Vertex> neighbors;
-        for (auto it = milestonesToRemove.begin(); it != milestonesToRemove.end(); ++it)
-        {
-            boost::graph_traits<Graph>::adjacency_iterator nbh, last;
-            for (boost::tie(nbh, last) = boost::adjacent_vertices(*it, g_); nbh != last; ++nbh)
-                if (milestonesToRemove.find(*nbh) == milestonesToRemove.end())
-                    neighbors.insert(*nbh);
-            // Remove vertex from nearest neighbors data structure.
-            nn_->remove(*it);
-            // Free vertex state.
-            si_->freeState(stateProperty_[*it]);
-            // Remove all edges.
-            boost::clear_vertex(*it, g_);
-            // Remove the vertex.
-            boost::remove_vertex(*it, g_);
-        }
-        // Update the connected component ID for neighbors.
-        for (auto neighbor : neighbors)
-        {
-            if (comp == vertexComponentProperty_[neighbor])
-            {
-                unsigned long int newComponent = componentCount_++;
-                componentSize_[newComponent] = 0;
-                markComponent(neighbor, newComponent);
-            }
-        }
+        removeMilestones(start, milestonesToRemove);
         return base::PathPtr();
     }
 
@@ -591,10 +626,7 @@ ompl::base::PathPtr ompl::geometric::LazyPRM::constructSolution(const Vertex &st
         }
         if ((evd & VALIDITY_TRUE) == 0)
         {
-            boost::remove_edge(e, g_);
-            unsigned long int newComponent = componentCount_++;
-            componentSize_[newComponent] = 0;
-            markComponent(pos, newComponent);
+            removeInvalidEdge(pos, prevVertex);
             return base::PathPtr();
         }
         prevState = state;
@@ -609,6 +641,127 @@ ompl::base::PathPtr ompl::geometric::LazyPRM::constructSolution(const Vertex &st
     return p;
 }
 
+ompl::base::PathPtr ompl::geometric::LazyPRM::validatePathParallel(const std::vector<Vertex> &path)
+{
+    // Collect the vertices (other than the start and goal) and edges that still need checking.
+    // The states are looked up here, so the worker threads do not access the graph.
+    std::vector<Vertex> vertices;
+    std::vector<std::pair<Vertex, Vertex>> edges;
+    std::vector<std::pair<const base::State *, const base::State *>> checks;
+    for (std::size_t i = 1; i + 1 < path.size(); ++i)
+        if ((vertexValidityProperty_[path[i]] & VALIDITY_TRUE) == 0)
+        {
+            vertices.push_back(path[i]);
+            checks.emplace_back(stateProperty_[path[i]], nullptr);
+        }
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        Edge e = boost::lookup_edge(path[i + 1], path[i], g_).first;
+        if ((edgeValidityProperty_[e] & VALIDITY_TRUE) == 0)
+        {
+            edges.emplace_back(path[i + 1], path[i]);
+            checks.emplace_back(stateProperty_[path[i + 1]], stateProperty_[path[i]]);
+        }
+    }
+
+    // 0: not checked, 1: valid, 2: invalid
+    std::vector<unsigned char> result(checks.size(), 0);
+    if (!checks.empty())
+    {
+        if (!validationPool_)
+            validationPool_.reset(new ThreadPool(validationThreads_ - 1));
+        std::atomic<bool> failed(false);
+        validationPool_->parallelFor(checks.size(), [this, &checks, &result, &failed](std::size_t i)
+                                     {
+                                         if (failed)
+                                             return;
+                                         const auto &c = checks[i];
+                                         bool valid = c.second == nullptr ? si_->isValid(c.first) :
+                                                                            si_->checkMotion(c.first, c.second);
+                                         result[i] = valid ? 1 : 2;
+                                         if (!valid)
+                                             failed = true;
+                                     });
+    }
+
+    // Record the outcome of all the completed checks, so later candidate paths do not repeat them.
+    std::set<Vertex> milestonesToRemove;
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        if (result[i] == 1)
+            vertexValidityProperty_[vertices[i]] |= VALIDITY_TRUE;
+        else if (result[i] == 2)
+            milestonesToRemove.insert(vertices[i]);
+    }
+    bool invalidEdge = false;
+    for (std::size_t i = 0; i < edges.size(); ++i)
+    {
+        unsigned char r = result[vertices.size() + i];
+        if (r == 1)
+            edgeValidityProperty_[boost::lookup_edge(edges[i].first, edges[i].second, g_).first] |= VALIDITY_TRUE;
+        else if (r == 2)
+            invalidEdge = true;
+    }
+
+    if (!milestonesToRemove.empty())
+    {
+        removeMilestones(path.back(), milestonesToRemove);
+        return base::PathPtr();
+    }
+    if (invalidEdge)
+    {
+        for (std::size_t i = 0; i < edges.size(); ++i)
+            if (result[vertices.size() + i] == 2)
+                removeInvalidEdge(edges[i].first, edges[i].second);
+        return base::PathPtr();
+    }
+
+    auto p(std::make_shared<PathGeometric>(si_));
+    for (auto v = path.rbegin(); v != path.rend(); ++v)
+        p->append(stateProperty_[*v]);
+    return p;
+}
+
+void ompl::geometric::LazyPRM::removeMilestones(const Vertex &start, const std::set<Vertex> &milestonesToRemove)
+{
+    unsigned long int comp = vertexComponentProperty_[start];
+    // Remember the current neighbors.
+    std::set<Vertex> neighbors;
+    for (auto it = milestonesToRemove.begin(); it != milestonesToRemove.end(); ++it)
+    {
+        boost::graph_traits<Graph>::adjacency_iterator nbh, last;
+        for (boost::tie(nbh, last) = boost::adjacent_vertices(*it, g_); nbh != last; ++nbh)
+            if (milestonesToRemove.find(*nbh) == milestonesToRemove.end())
+                neighbors.insert(*nbh);
+        // Remove vertex from nearest neighbors data structure.
+        nn_->remove(*it);
+        // Free vertex state.
+        si_->freeState(stateProperty_[*it]);
+        // Remove all edges.
+        boost::clear_vertex(*it, g_);
+        // Remove the vertex.
+        boost::remove_vertex(*it, g_);
+    }
+    // Update the connected component ID for neighbors.
+    for (auto neighbor : neighbors)
+    {
+        if (comp == vertexComponentProperty_[neighbor])
+        {
+            unsigned long int newComponent = componentCount_++;
+            componentSize_[newComponent] = 0;
+            markComponent(neighbor, newComponent);
+        }
+    }
+}
+
+void ompl::geometric::LazyPRM::removeInvalidEdge(Vertex a, Vertex b)
+{
+    boost::remove_edge(boost::lookup_edge(a, b, g_).first, g_);
+    unsigned long int newComponent = componentCount_++;
+    componentSize_[newComponent] = 0;
+    markComponent(a, newComponent);
+}
+
 ompl::base::Cost ompl::geometric::LazyPRM::costHeuristic(Vertex u, Vertex v) const
 {
     return opt_->motionCostHeuristic(stateProperty_[u], stateProperty_[v]);
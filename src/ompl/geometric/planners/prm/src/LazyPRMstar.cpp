@@ -49,3 +49,11 @@ ompl::geometric::LazyPRMstar::LazyPRMstar(const base::PlannerData &data) : LazyP
     params_.remove("range");
     params_.remove("max_nearest_neighbors");
 }
+
+ompl::geometric::LazyPRMstar::LazyPRMstar(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap)
+  : LazyPRM(si, roadmap, true)
+{
+    setName("LazyPRMstar");
+    params_.remove("range");
+    params_.remove("max_nearest_neighbors");
+}
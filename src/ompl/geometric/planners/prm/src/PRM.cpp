@@ -45,6 +45,8 @@
 #include <boost/graph/incremental_components.hpp>
 #include <boost/property_map/vector_property_map.hpp>
 #include <boost/foreach.hpp>
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <typeinfo>
 
@@ -66,6 +68,14 @@ namespace ompl
         /** \brief The number of nearest neighbors to consider by
             default in the construction of the PRM roadmap */
         static const unsigned int DEFAULT_NEAREST_NEIGHBORS = 10;
+
+        /** \brief The number of milestones each thread samples before adding them to the
+            roadmap when the roadmap is grown by multiple threads */
+        static const unsigned int PARALLEL_ROADMAP_BATCH_SIZE = 4;
+
+        /** \brief The time in seconds after which the thread that checks for solutions
+            looks for new goal states even if no connected components were merged */
+        static const double SOLUTION_CHECK_TIMEOUT = 0.1;
     }  // namespace magic
 }  // namespace ompl
 
@@ -86,6 +96,9 @@ ompl::geometric::PRM::PRM(const base::SpaceInformationPtr &si, bool starStrategy
     if (!starStrategy_)
         Planner::declareParam<unsigned int>("max_nearest_neighbors", this, &PRM::setMaxNearestNeighbors,
                                             &PRM::getMaxNearestNeighbors, std::string("8:1000"));
+    Planner::declareParam<unsigned int>("threads", this, &PRM::setThreadCount, &PRM::getThreadCount, "1:64");
+    Planner::declareParam<double>("nn_approximation", this, &PRM::setNearestNeighborsApproximation,
+                                  &PRM::getNearestNeighborsApproximation, "0.:.05:1.");
 
     addPlannerProgressProperty("iterations INTEGER", [this] { return getIterationCount(); });
     addPlannerProgressProperty("best cost REAL", [this] { return getBestCost(); });
@@ -147,6 +160,51 @@ ompl::geometric::PRM::PRM(const base::PlannerData &data, bool starStrategy)
     }
 }
 
+ompl::geometric::PRM::PRM(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap, bool starStrategy)
+  : PRM(si, starStrategy)
+{
+    if (roadmap.numVertices() == 0)
+        return;
+
+    // vertices are created in the order of the roadmap, so the index of a vertex in the roadmap is the index
+    // of the corresponding Vertex in the graph
+    std::vector<Vertex> vertices(roadmap.numVertices());
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        Vertex m = boost::add_vertex(g_);
+        stateProperty_[m] = si_->allocState();
+        roadmap.copyState(i, stateProperty_[m]);
+        totalConnectionAttemptsProperty_[m] = 1;
+        successfulConnectionAttemptsProperty_[m] = 0;
+        disjointSets_.make_set(m);
+        vertices[i] = m;
+    }
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        const std::uint32_t *neighbors = roadmap.getNeighbors(i);
+        const double *weights = roadmap.getEdgeWeights(i);
+        for (std::size_t j = 0; j < roadmap.getNeighborCount(i); ++j)
+        {
+            std::size_t n = neighbors[j];
+            if (n < i && roadmap.edgeExists(n, i))
+                continue;  // the reverse edge was added already
+            totalConnectionAttemptsProperty_[vertices[i]]++;
+            successfulConnectionAttemptsProperty_[vertices[i]]++;
+            totalConnectionAttemptsProperty_[vertices[n]]++;
+            successfulConnectionAttemptsProperty_[vertices[n]]++;
+            const Graph::edge_property_type properties(base::Cost(weights[j]));
+            boost::add_edge(vertices[i], vertices[n], properties, g_);
+            uniteComponents(vertices[i], vertices[n]);
+        }
+    }
+
+    specs_.multithreaded = false;  // temporarily set to false since nn_ is used only in single thread
+    nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Vertex>(this));
+    specs_.multithreaded = true;
+    nn_->setDistanceFunction([this](const Vertex a, const Vertex b) { return distanceFunction(a, b); });
+    nn_->add(vertices);
+}
+
 ompl::geometric::PRM::~PRM()
 {
     freeMemory();
@@ -161,6 +219,7 @@ void ompl::geometric::PRM::setup()
         nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Vertex>(this));
         specs_.multithreaded = true;
         nn_->setDistanceFunction([this](const Vertex a, const Vertex b) { return distanceFunction(a, b); });
+        nn_->setApproximationFactor(nnApproximation_);
     }
     if (!connectionStrategy_)
         setDefaultConnectionStrategy();
@@ -200,6 +259,7 @@ void ompl::geometric::PRM::setMaxNearestNeighbors(unsigned int k)
         nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Vertex>(this));
         specs_.multithreaded = true;
         nn_->setDistanceFunction([this](const Vertex a, const Vertex b) { return distanceFunction(a, b); });
+        nn_->setApproximationFactor(nnApproximation_);
     }
     if (!userSetConnectionStrategy_)
         connectionStrategy_ = KStrategy<Vertex>(k, nn_);
@@ -207,6 +267,21 @@ void ompl::geometric::PRM::setMaxNearestNeighbors(unsigned int k)
         setup();
 }
 
+void ompl::geometric::PRM::setNearestNeighborsApproximation(double epsilon)
+{
+    if (epsilon < 0.0)
+        throw Exception("The nearest neighbors approximation factor must be non-negative");
+    nnApproximation_ = epsilon;
+    if (nn_)
+        nn_->setApproximationFactor(epsilon);
+}
+
+void ompl::geometric::PRM::setThreadCount(unsigned int threads)
+{
+    threadCount_ = std::max(1u, threads);
+    roadmapPool_.reset();
+}
+
 unsigned int ompl::geometric::PRM::getMaxNearestNeighbors() const
 {
     const auto strategy = connectionStrategy_.target<KStrategy<Vertex>>();
@@ -239,6 +314,7 @@ void ompl::geometric::PRM::clear()
     Planner::clear();
     sampler_.reset();
     simpleSampler_.reset();
+    workerSamplers_.clear();
     freeMemory();
     if (nn_)
         nn_->clear();
@@ -355,6 +431,12 @@ void ompl::geometric::PRM::growRoadmap(const base::PlannerTerminationCondition &
 
 void ompl::geometric::PRM::growRoadmap(const base::PlannerTerminationCondition &ptc, base::State *workState)
 {
+    if (threadCount_ > 1)
+    {
+        growRoadmapParallel(ptc);
+        return;
+    }
+
     /* grow roadmap in the regular fashion -- sample valid states, add them to the roadmap, add valid connections */
     while (!ptc)
     {
@@ -376,11 +458,105 @@ void ompl::geometric::PRM::growRoadmap(const base::PlannerTerminationCondition &
     }
 }
 
+void ompl::geometric::PRM::growRoadmapParallel(const base::PlannerTerminationCondition &ptc)
+{
+    if (!roadmapPool_)
+        roadmapPool_.reset(new ThreadPool(threadCount_ - 1));
+    while (workerSamplers_.size() < threadCount_)
+        workerSamplers_.push_back(si_->allocValidStateSampler());
+    roadmapPool_->parallelFor(threadCount_,
+                              [this, &ptc](std::size_t i) { growRoadmapWorker(ptc, workerSamplers_[i].get()); });
+}
+
+void ompl::geometric::PRM::growRoadmapWorker(const base::PlannerTerminationCondition &ptc,
+                                             base::ValidStateSampler *sampler)
+{
+    base::State *workState = si_->allocState();
+    std::vector<base::State *> states;
+    std::vector<std::pair<Vertex, Vertex>> candidates;
+    std::vector<std::pair<const base::State *, const base::State *>> motions;
+    std::vector<base::Cost> weights;
+
+    while (!ptc)
+    {
+        // sample a batch of valid states; no lock is held
+        states.clear();
+        while (states.size() < magic::PARALLEL_ROADMAP_BATCH_SIZE && !ptc)
+        {
+            bool found = false;
+            unsigned int attempts = 0;
+            do
+            {
+                found = sampler->sample(workState);
+                attempts++;
+            } while (attempts < magic::FIND_VALID_STATE_ATTEMPTS_WITHOUT_TERMINATION_CHECK && !found);
+            if (found)
+                states.push_back(si_->cloneState(workState));
+        }
+        if (states.empty())
+            break;
+
+        // add the milestones and select the connections to attempt
+        candidates.clear();
+        motions.clear();
+        {
+            std::lock_guard<std::mutex> _(graphMutex_);
+            for (base::State *state : states)
+            {
+                iterations_++;
+                Vertex m = boost::add_vertex(g_);
+                stateProperty_[m] = state;
+                totalConnectionAttemptsProperty_[m] = 1;
+                successfulConnectionAttemptsProperty_[m] = 0;
+                disjointSets_.make_set(m);
+
+                foreach (Vertex n, connectionStrategy_(m))
+                    if (connectionFilter_(n, m))
+                    {
+                        totalConnectionAttemptsProperty_[m]++;
+                        totalConnectionAttemptsProperty_[n]++;
+                        candidates.emplace_back(n, m);
+                        motions.emplace_back(stateProperty_[n], state);
+                    }
+                nn_->add(m);
+            }
+        }
+
+        // check the connections; no lock is held
+        weights.resize(motions.size());
+        for (std::size_t i = 0; i < motions.size(); ++i)
+            weights[i] = si_->checkMotion(motions[i].first, motions[i].second) ?
+                             opt_->motionCost(motions[i].first, motions[i].second) :
+                             opt_->infiniteCost();
+
+        // insert the valid connections
+        std::lock_guard<std::mutex> _(graphMutex_);
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+            if (opt_->isFinite(weights[i]))
+            {
+                Vertex n = candidates[i].first, m = candidates[i].second;
+                successfulConnectionAttemptsProperty_[m]++;
+                successfulConnectionAttemptsProperty_[n]++;
+                const Graph::edge_property_type properties(weights[i]);
+                boost::add_edge(n, m, properties, g_);
+                uniteComponents(n, m);
+            }
+    }
+
+    si_->freeState(workState);
+}
+
 void ompl::geometric::PRM::checkForSolution(const base::PlannerTerminationCondition &ptc, base::PathPtr &solution)
 {
     auto *goal = static_cast<base::GoalSampleableRegion *>(pdef_->getGoal().get());
+    unsigned long int seenMerges = 0;
     while (!ptc && !addedNewSolution_)
     {
+        {
+            std::lock_guard<std::mutex> _(graphMutex_);
+            seenMerges = componentMerges_;
+        }
+
         // Check for any new goal states
         if (goal->maxSampleCount() > goalM_.size())
         {
@@ -391,9 +567,14 @@ void ompl::geometric::PRM::checkForSolution(const base::PlannerTerminationCondit
 
         // Check for a solution
         addedNewSolution_ = maybeConstructSolution(startM_, goalM_, solution);
-        // Sleep for 1ms
+        // Wait until connected components are merged, so a new solution may exist
         if (!addedNewSolution_)
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        {
+            std::unique_lock<std::mutex> lock(graphMutex_);
+            componentsMergedCondition_.wait_for(lock, std::chrono::duration<double>(magic::SOLUTION_CHECK_TIMEOUT),
+                                                [this, seenMerges]
+                                                { return componentMerges_ != seenMerges || stopSolutionCheck_; });
+        }
     }
 }
 
@@ -489,6 +670,7 @@ ompl::base::PlannerStatus ompl::geometric::PRM::solve(const base::PlannerTermina
 
     // Reset addedNewSolution_ member and create solution checking thread
     addedNewSolution_ = false;
+    stopSolutionCheck_ = false;
     base::PathPtr sol;
     std::thread slnThread([this, &ptc, &sol] { checkForSolution(ptc, sol); });
 
@@ -498,6 +680,11 @@ ompl::base::PlannerStatus ompl::geometric::PRM::solve(const base::PlannerTermina
     constructRoadmap(ptcOrSolutionFound);
 
     // Ensure slnThread is ceased before exiting solve
+    {
+        std::lock_guard<std::mutex> _(graphMutex_);
+        stopSolutionCheck_ = true;
+    }
+    componentsMergedCondition_.notify_all();
     slnThread.join();
 
     OMPL_INFORM("%s: Created %u states", getName().c_str(), boost::num_vertices(g_) - nrStartStates);
@@ -597,7 +784,13 @@ ompl::geometric::PRM::Vertex ompl::geometric::PRM::addMilestone(base::State *sta
 
 void ompl::geometric::PRM::uniteComponents(Vertex m1, Vertex m2)
 {
-    disjointSets_.union_set(m1, m2);
+    Vertex r1 = disjointSets_.find_set(m1);
+    Vertex r2 = disjointSets_.find_set(m2);
+    if (r1 == r2)
+        return;
+    disjointSets_.link(r1, r2);
+    componentMerges_++;
+    componentsMergedCondition_.notify_all();
 }
 
 bool ompl::geometric::PRM::sameComponent(Vertex m1, Vertex m2)
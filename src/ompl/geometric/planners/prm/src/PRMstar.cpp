@@ -47,3 +47,10 @@ ompl::geometric::PRMstar::PRMstar(const base::PlannerData &data) : PRM(data, tru
     setName("PRMstar");
     params_.remove("max_nearest_neighbors");
 }
+
+ompl::geometric::PRMstar::PRMstar(const base::SpaceInformationPtr &si, const base::FlatRoadmap &roadmap)
+  : PRM(si, roadmap, true)
+{
+    setName("PRMstar");
+    params_.remove("max_nearest_neighbors");
+}
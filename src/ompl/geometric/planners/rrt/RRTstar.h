@@ -306,6 +306,18 @@ namespace ompl
                 return useKNearest_;
             }
 
+            /** \brief Allow the nearest neighbor queries used to extend and rewire the tree to return approximate results, with
+                approximation factor \e epsilon (see NearestNeighbors::setApproximationFactor()). Larger
+                values make the queries faster at the cost of slightly worse rewiring. The default of 0 means
+                exact queries. */
+            void setNearestNeighborsApproximation(double epsilon);
+
+            /** \brief Get the approximation factor for nearest neighbor queries */
+            double getNearestNeighborsApproximation() const
+            {
+                return nnApproximation_;
+            }
+
             /** \brief Set the number of attempts to make while performing rejection or informed sampling */
             void setNumSamplingAttempts(unsigned int numAttempts)
             {
@@ -444,6 +456,9 @@ namespace ompl
             /** \brief Option to use k-nearest search for rewiring */
             bool useKNearest_{true};
 
+            /** \brief The approximation factor for nearest neighbor queries */
+            double nnApproximation_{0.0};
+
             /** \brief The rewiring factor, s, so that r_rrt = s \times r_rrt* > r_rrt* (or k_rrt = s \times k_rrt* >
              * k_rrt*) */
             double rewireFactor_{1.1};
@@ -74,9 +74,12 @@ void ompl::geometric::RRT::setup()
     tools::SelfConfig sc(si_, getName());
     sc.configurePlannerRange(maxDistance_);
 
+    auto motionState = [](Motion *const &motion) -> const base::State * { return motion->state; };
     if (!nn_)
-        nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this));
+        nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this, motionState));
     nn_->setDistanceFunction([this](const Motion *a, const Motion *b) { return distanceFunction(a, b); });
+    nn_->setBatchDistanceFunction(tools::SelfConfig::getDefaultBatchDistanceFunction<Motion *>(si_->getStateSpace()));
+    nn_->setPackedDistance(tools::SelfConfig::getDefaultPackedDistance<Motion *>(si_->getStateSpace()));
 }
 
 void ompl::geometric::RRT::freeMemory()
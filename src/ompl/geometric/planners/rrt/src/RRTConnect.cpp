@@ -65,12 +65,19 @@ void ompl::geometric::RRTConnect::setup()
     tools::SelfConfig sc(si_, getName());
     sc.configurePlannerRange(maxDistance_);
 
+    auto motionState = [](Motion *const &motion) -> const base::State * { return motion->state; };
     if (!tStart_)
-        tStart_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this));
+        tStart_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this, motionState));
     if (!tGoal_)
-        tGoal_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this));
+        tGoal_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this, motionState));
     tStart_->setDistanceFunction([this](const Motion *a, const Motion *b) { return distanceFunction(a, b); });
+    tStart_->setBatchDistanceFunction(
+        tools::SelfConfig::getDefaultBatchDistanceFunction<Motion *>(si_->getStateSpace()));
+    tStart_->setPackedDistance(tools::SelfConfig::getDefaultPackedDistance<Motion *>(si_->getStateSpace()));
     tGoal_->setDistanceFunction([this](const Motion *a, const Motion *b) { return distanceFunction(a, b); });
+    tGoal_->setBatchDistanceFunction(
+        tools::SelfConfig::getDefaultBatchDistanceFunction<Motion *>(si_->getStateSpace()));
+    tGoal_->setPackedDistance(tools::SelfConfig::getDefaultPackedDistance<Motion *>(si_->getStateSpace()));
 }
 
 void ompl::geometric::RRTConnect::freeMemory()
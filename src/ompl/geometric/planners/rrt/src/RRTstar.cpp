@@ -61,6 +61,8 @@ ompl::geometric::RRTstar::RRTstar(const base::SpaceInformationPtr &si)
     Planner::declareParam<double>("rewire_factor", this, &RRTstar::setRewireFactor, &RRTstar::getRewireFactor,
                                   "1.0:0.01:2.0");
     Planner::declareParam<bool>("use_k_nearest", this, &RRTstar::setKNearest, &RRTstar::getKNearest, "0,1");
+    Planner::declareParam<double>("nn_approximation", this, &RRTstar::setNearestNeighborsApproximation,
+                                  &RRTstar::getNearestNeighborsApproximation, "0.:.05:1.");
     Planner::declareParam<bool>("delay_collision_checking", this, &RRTstar::setDelayCC, &RRTstar::getDelayCC, "0,1");
     Planner::declareParam<bool>("tree_pruning", this, &RRTstar::setTreePruning, &RRTstar::getTreePruning, "0,1");
     Planner::declareParam<double>("prune_threshold", this, &RRTstar::setPruneThreshold, &RRTstar::getPruneThreshold,
@@ -101,9 +103,15 @@ void ompl::geometric::RRTstar::setup()
         OMPL_WARN("%s requires a state space with symmetric distance and symmetric interpolation.", getName().c_str());
     }
 
+    auto motionState = [](Motion *const &motion) -> const base::State * { return motion->state; };
     if (!nn_)
-        nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this));
+    {
+        nn_.reset(tools::SelfConfig::getDefaultNearestNeighbors<Motion *>(this, motionState));
+        nn_->setApproximationFactor(nnApproximation_);
+    }
     nn_->setDistanceFunction([this](const Motion *a, const Motion *b) { return distanceFunction(a, b); });
+    nn_->setBatchDistanceFunction(tools::SelfConfig::getDefaultBatchDistanceFunction<Motion *>(si_->getStateSpace()));
+    nn_->setPackedDistance(tools::SelfConfig::getDefaultPackedDistance<Motion *>(si_->getStateSpace()));
 
     // Setup optimization objective
     //
@@ -142,6 +150,15 @@ void ompl::geometric::RRTstar::setup()
     calculateRewiringLowerBounds();
 }
 
+void ompl::geometric::RRTstar::setNearestNeighborsApproximation(double epsilon)
+{
+    if (epsilon < 0.0)
+        throw Exception("The nearest neighbors approximation factor must be non-negative");
+    nnApproximation_ = epsilon;
+    if (nn_)
+        nn_->setApproximationFactor(epsilon);
+}
+
 void ompl::geometric::RRTstar::clear()
 {
     setup_ = false;
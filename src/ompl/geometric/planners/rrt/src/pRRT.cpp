@@ -96,16 +96,18 @@ void ompl::geometric::pRRT::freeMemory()
     }
 }
 
-void ompl::geometric::pRRT::threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc,
-                                        SolutionInfo *sol)
+void ompl::geometric::pRRT::threadSolve(unsigned int tid, std::uint_fast32_t seed,
+                                        const base::PlannerTerminationCondition &ptc, SolutionInfo *sol)
 {
     base::Goal *goal = pdef_->getGoal().get();
     auto *goal_s = dynamic_cast<base::GoalSampleableRegion *>(goal);
-    RNG rng;
+    RNG rng(seed, 2 * tid);
+    samplerArray_[tid]->setLocalStream(seed, 2 * tid + 1);
 
     auto *rmotion = new Motion(si_);
     base::State *rstate = rmotion->state;
     base::State *xstate = si_->allocState();
+    const bool concurrentNN = nn_->supportsConcurrentAccess();
 
     while (sol->solution == nullptr && ptc == false)
     {
@@ -116,9 +118,14 @@ void ompl::geometric::pRRT::threadSolve(unsigned int tid, const base::PlannerTer
             samplerArray_[tid]->sampleUniform(rstate);
 
         /* find closest state in the tree */
-        nnLock_.lock();
-        Motion *nmotion = nn_->nearest(rmotion);
-        nnLock_.unlock();
+        Motion *nmotion;
+        if (concurrentNN)
+            nmotion = nn_->nearest(rmotion);
+        else
+        {
+            std::lock_guard<std::mutex> _(nnLock_);
+            nmotion = nn_->nearest(rmotion);
+        }
         base::State *dstate = rstate;
 
         /* find state to add */
@@ -136,9 +143,13 @@ void ompl::geometric::pRRT::threadSolve(unsigned int tid, const base::PlannerTer
             si_->copyState(motion->state, dstate);
             motion->parent = nmotion;
 
-            nnLock_.lock();
-            nn_->add(motion);
-            nnLock_.unlock();
+            if (concurrentNN)
+                nn_->add(motion);
+            else
+            {
+                std::lock_guard<std::mutex> _(nnLock_);
+                nn_->add(motion);
+            }
 
             double dist = 0.0;
             bool solved = goal->isSatisfied(motion->state, &dist);
@@ -203,11 +214,13 @@ ompl::base::PlannerStatus ompl::geometric::pRRT::solve(const base::PlannerTermin
     sol.approxsol = nullptr;
     sol.approxdif = std::numeric_limits<double>::infinity();
 
+    // each thread draws from its own stream, so its numbers do not depend on the order in which the threads start
+    const std::uint_fast32_t seed = RNG().getLocalSeed();
     std::vector<std::thread *> th(threadCount_);
     for (unsigned int i = 0; i < threadCount_; ++i)
-        th[i] = new std::thread([this, i, &ptc, &sol]
+        th[i] = new std::thread([this, i, seed, &ptc, &sol]
                                 {
-                                    return threadSolve(i, ptc, &sol);
+                                    return threadSolve(i, seed, ptc, &sol);
                                 });
     for (unsigned int i = 0; i < threadCount_; ++i)
     {
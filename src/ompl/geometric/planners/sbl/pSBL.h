@@ -233,7 +233,10 @@ namespace ompl
                 std::mutex lock;
             };
 
-            void threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc, SolutionInfo *sol);
+            /** \brief The work of thread \e tid. The thread and its sampler draw from streams 2 \e tid and
+                2 \e tid + 1 of \e seed. */
+            void threadSolve(unsigned int tid, std::uint_fast32_t seed, const base::PlannerTerminationCondition &ptc,
+                             SolutionInfo *sol);
 
             void freeMemory()
             {
@@ -99,10 +99,11 @@ void ompl::geometric::pSBL::freeGridMotions(Grid<MotionInfo> &grid)
     }
 }
 
-void ompl::geometric::pSBL::threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc,
-                                        SolutionInfo *sol)
+void ompl::geometric::pSBL::threadSolve(unsigned int tid, std::uint_fast32_t seed,
+                                        const base::PlannerTerminationCondition &ptc, SolutionInfo *sol)
 {
-    RNG rng;
+    RNG rng(seed, 2 * tid);
+    samplerArray_[tid]->setLocalStream(seed, 2 * tid + 1);
 
     std::vector<Motion *> solution;
     base::State *xstate = si_->allocState();
@@ -240,9 +241,11 @@ ompl::base::PlannerStatus ompl::geometric::pSBL::solve(const base::PlannerTermin
     sol.found = false;
     loopCounter_ = 0;
 
+    // each thread draws from its own stream, so its numbers do not depend on the order in which the threads start
+    const std::uint_fast32_t seed = RNG().getLocalSeed();
     std::vector<std::thread *> th(threadCount_);
     for (unsigned int i = 0; i < threadCount_; ++i)
-        th[i] = new std::thread([this, i, &ptc, &sol] { threadSolve(i, ptc, &sol); });
+        th[i] = new std::thread([this, i, seed, &ptc, &sol] { threadSolve(i, seed, ptc, &sol); });
     for (unsigned int i = 0; i < threadCount_; ++i)
     {
         th[i]->join();
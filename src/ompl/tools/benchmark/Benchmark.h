@@ -39,11 +39,18 @@
 
 #include "ompl/geometric/SimpleSetup.h"
 #include "ompl/control/SimpleSetup.h"
+#include "ompl/tools/benchmark/MachineSpecs.h"
+#include "ompl/util/ClassForward.h"
 
 namespace ompl
 {
     namespace tools
     {
+        /// @cond IGNORE
+        /** \brief Forward declaration of ompl::tools::ResultsStream */
+        OMPL_CLASS_FORWARD(ResultsStream);
+        /// @endcond
+
         /** \brief Benchmark a set of planners on a problem instance */
         class Benchmark
         {
@@ -158,7 +165,7 @@ namespace ompl
                 /** \brief Constructor that provides default values for all members */
                 Request(double maxTime = 5.0, double maxMem = 4096.0, unsigned int runCount = 100,
                         double timeBetweenUpdates = 0.05, bool displayProgress = true, bool saveConsoleOutput = true,
-                        bool simplify = true)
+                        bool simplify = true, unsigned int processCount = 1)
                   : maxTime(maxTime)
                   , maxMem(maxMem)
                   , runCount(runCount)
@@ -166,6 +173,7 @@ namespace ompl
                   , displayProgress(displayProgress)
                   , saveConsoleOutput(saveConsoleOutput)
                   , simplify(simplify)
+                  , processCount(processCount)
                 {
                 }
 
@@ -192,6 +200,32 @@ namespace ompl
 
                 /// \brief flag indicating whether simplification should be applied to path; true by default
                 bool simplify;
+
+                /// \brief the number of processes the runs are distributed over; 1 by default.
+                /// With more than one process, the runs are executed by worker processes forked from this one.
+                /// Memory limits then apply to each worker, and runs lost to a crashed worker are recorded with status
+                /// CRASH. The planner events are called in the workers. Threads that planners start before
+                /// benchmark() is called are not copied to the workers, except for the ones of a ThreadPool, which
+                /// starts them again. Ignored if runCount is 0 or fork() is not available.
+                /// With any number of processes, the sequence of seeds of new generators is restarted for every run
+                /// from a seed derived from the experiment seed and the position of the run in the experiment (see
+                /// RNG::restartSeedSequence()). The samplers a planner allocates after being cleared then get the same
+                /// seeds with any number of processes. Generators that exist before the run, such as the ones a planner
+                /// allocates when it is constructed, are not reseeded.
+                unsigned int processCount;
+
+                /// \brief if not empty, the results are appended to this file (see ResultsStream) as soon as each run
+                /// completes, instead of being kept in memory; empty by default.
+                /// Progress properties are written in chunks while the planner runs. The data returned by
+                /// getRecordedExperimentData() then contains no runs; ResultsStream::read() loads them from the file.
+                /// With more than one process, the runs are written when the worker processes are done.
+                std::string streamFilename;
+
+                /// \brief with more than one process, the time (seconds) a worker process may take for a run in
+                /// addition to maxTime, including the preparation of the planner and the simplification of the
+                /// solution; 60.0 by default. A worker that exceeds it is killed, the run is recorded with status
+                /// CRASH, and a new worker executes the remaining runs of the killed one.
+                double gracePeriod{60.0};
             };
 
             /** \brief Constructor needs the SimpleSetup instance needed for planning. Optionally, the experiment name
@@ -308,7 +342,8 @@ namespace ompl
             /** \brief Return all the experiment data that would be
                 written to the results file. The data should not be
                 changed, but it could be useful to quickly extract cartain
-                statistics. */
+                statistics. If the results were streamed to a file
+                (Request::streamFilename), the runs are not included. */
             const CompleteExperiment &getRecordedExperimentData() const
             {
                 return exp_;
@@ -348,6 +383,26 @@ namespace ompl
 
             /// Event to be called after the run of a planner
             PostSetupEvent postRun_;
+
+        private:
+            /// The file the results are streamed to during benchmark(), if Request::streamFilename is set
+            ResultsStreamPtr stream_;
+
+            /// Execute the planner-switch event for planner \e i and record its parameters
+            void preparePlanner(unsigned int i);
+
+            /// Execute a run of planner \e i, limited to \e maxTime seconds, and add its results to the experiment.
+            /// Returns the time used by the run.
+            double runPlanner(unsigned int i, double maxTime, const Request &req, machine::MemUsage_t memStart);
+
+            /// Execute the runs in req.processCount worker processes and merge their results. Returns false if no
+            /// worker could be started.
+            bool runInProcesses(const Request &req, time::ProgressDisplay *progress);
+
+            /// Execute every \e workerCount-th run, starting at run \e firstRun (numbered planner by planner), and
+            /// write their results to \e filename
+            void runWorker(const Request &req, std::size_t firstRun, unsigned int workerCount,
+                           const std::string &filename);
         };
     }
 }
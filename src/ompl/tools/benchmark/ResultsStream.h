@@ -0,0 +1,141 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_TOOLS_BENCHMARK_RESULTS_STREAM_
+#define OMPL_TOOLS_BENCHMARK_RESULTS_STREAM_
+
+#include "ompl/tools/benchmark/Benchmark.h"
+#include <algorithm>
+#include <fstream>
+
+namespace ompl
+{
+    namespace tools
+    {
+        /** \brief Append-only, columnar file to which the results of a benchmark are written as they are produced.
+
+            The file is a sequence of records that are each written and flushed as a whole, so a file cut short
+            by a crash can still be read up to the last complete record. Run properties are stored in typed
+            columns (the type is the last word of the property name: REAL, INTEGER, BOOLEAN or ENUM; anything
+            else is stored as a string). Each planner has its own set of columns, which grows when a run reports
+            a property that was not seen before. Progress properties are stored separately, in chunks of at most
+            getProgressChunkSize() samples, so the samples of a run do not have to be kept in memory until the
+            run ends. Values that cannot be converted to the type of their column are not stored.
+
+            A file can be read back into a Benchmark::CompleteExperiment with read(), e.g., to write it in the
+            text format of Benchmark::saveResultsToStream(). */
+        class ResultsStream
+        {
+        public:
+            /** \brief Create (or truncate) the file \e filename */
+            ResultsStream(const std::string &filename);
+
+            ~ResultsStream();
+
+            /** \brief Check whether all records could be written so far */
+            bool good() const
+            {
+                return out_.good();
+            }
+
+            /** \brief Write the information about the experiment. This does not include its planners. */
+            void writeExperiment(const Benchmark::CompleteExperiment &exp);
+
+            /** \brief Write the name, common properties and progress property names of planner \e i. If \e
+                hasProgress is false, the planner reports no progress data. */
+            void writePlanner(unsigned int i, const Benchmark::PlannerExperiment &planner, bool hasProgress);
+
+            /** \brief Write the properties of run \e run of planner \e i */
+            void writeRun(unsigned int i, unsigned int run, const Benchmark::RunProperties &properties);
+
+            /** \brief Add a progress sample for run \e run of planner \e i. Samples are written once a chunk
+                is complete, or when flushProgress() is called. Samples must be added for one run at a time. */
+            void addProgress(unsigned int i, unsigned int run, const std::map<std::string, std::string> &sample);
+
+            /** \brief Write the progress samples that were added but not written yet */
+            void flushProgress();
+
+            /** \brief Write the total duration of the experiment, which marks the experiment as complete */
+            void writeDuration(double duration);
+
+            /** \brief Get the maximum number of progress samples per chunk */
+            unsigned int getProgressChunkSize() const
+            {
+                return progressChunkSize_;
+            }
+
+            /** \brief Set the maximum number of progress samples per chunk */
+            void setProgressChunkSize(unsigned int size)
+            {
+                progressChunkSize_ = std::max(size, 1u);
+            }
+
+            /** \brief Read the file \e filename into \e exp. Reading stops at the first incomplete record.
+                Returns false if the file could not be opened, is not a results stream, or does not contain the
+                information about the experiment. */
+            static bool read(const std::string &filename, Benchmark::CompleteExperiment &exp);
+
+        private:
+            /** \brief The columns of a planner */
+            struct Schema
+            {
+                std::vector<std::string> names;
+                std::vector<char> types;
+                std::map<std::string, unsigned int> index;
+            };
+
+            void writeRecord(char type, const std::string &payload);
+
+            std::ofstream out_;
+
+            /** \brief The run columns of each planner */
+            std::vector<Schema> schemas_;
+
+            /** \brief The progress columns of each planner */
+            std::vector<Schema> progressSchemas_;
+
+            /** \brief The encoded progress samples that have not been written yet (presence and values of each
+                column), and the run they belong to */
+            std::vector<std::pair<std::vector<bool>, std::string>> progress_;
+            unsigned int progressRows_{0};
+            unsigned int progressPlanner_{0};
+            unsigned int progressRun_{0};
+
+            unsigned int progressChunkSize_{1024};
+        };
+    }
+}
+
+#endif
@@ -36,6 +36,7 @@
 
 #include "ompl/tools/benchmark/Benchmark.h"
 #include "ompl/tools/benchmark/MachineSpecs.h"
+#include "ompl/tools/benchmark/ResultsStream.h"
 #include "ompl/util/Time.h"
 #include "ompl/config.h"
 #include "ompl/util/String.h"
@@ -43,8 +44,18 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#ifndef _WIN32
+#include <csignal>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 /// @cond IGNORE
 namespace ompl
@@ -65,6 +76,119 @@ namespace ompl
             return "ompl_" + exp.host + "_" + time::as_string(exp.startTime) + ".console";
         }
 
+        /** \brief The run index used to compute the seed for the preparation of a planner */
+        static const unsigned int PREPARATION_RUN = std::numeric_limits<unsigned int>::max();
+
+        /** \brief Compute the seed of run \e run of planner \e planner from the experiment seed (splitmix64), so
+         * that it does not depend on which process executes the run */
+        static std::uint_fast32_t getRunSeed(std::uint_fast32_t seed, unsigned int planner, unsigned int run)
+        {
+            std::uint64_t z = (static_cast<std::uint64_t>(seed) << 32) + (static_cast<std::uint64_t>(planner) << 20) +
+                              run + 0x9e3779b97f4a7c15ULL;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            z ^= z >> 31;
+            return static_cast<std::uint_fast32_t>(z % 1000000000u) + 1u;
+        }
+
+        /** \brief Write a string prefixed by its length, so that it may contain any character */
+        static void writeString(std::ostream &out, const std::string &str)
+        {
+            out << str.size() << ' ' << str << ' ';
+        }
+
+        static bool readString(std::istream &in, std::string &str)
+        {
+            std::size_t size;
+            if (!(in >> size) || in.get() != ' ')
+                return false;
+            str.resize(size);
+            return size == 0 || static_cast<bool>(in.read(&str[0], size));
+        }
+
+        static void writeProperties(std::ostream &out, const std::map<std::string, std::string> &properties)
+        {
+            out << properties.size() << ' ';
+            for (const auto &property : properties)
+            {
+                writeString(out, property.first);
+                writeString(out, property.second);
+            }
+        }
+
+        static bool readProperties(std::istream &in, std::map<std::string, std::string> &properties)
+        {
+            std::size_t size;
+            if (!(in >> size))
+                return false;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                std::string name, value;
+                if (!readString(in, name) || !readString(in, value))
+                    return false;
+                properties[name] = value;
+            }
+            return true;
+        }
+
+        /** \brief The runs read from the files of the worker processes, by planner and run */
+        using WorkerResults =
+            std::vector<std::map<unsigned int, std::pair<Benchmark::RunProperties, Benchmark::RunProgressData>>>;
+
+        /** \brief Read the file of a worker process up to its first incomplete record. The information about the
+         * planners is stored in \e planners and the runs in \e results. Returns the position (planner * \e runCount +
+         * run) of the last run the worker started, or the number of runs if it did not start any. */
+        static std::size_t readWorkerFile(const std::string &filename, unsigned int runCount,
+                                          std::vector<Benchmark::PlannerExperiment> &planners,
+                                          WorkerResults &results)
+        {
+            std::size_t started = planners.size() * runCount;
+            std::ifstream in(filename.c_str(), std::ios::binary);
+            char type;
+            while (in >> type)
+            {
+                unsigned int i, j;
+                if (!(in >> i) || i >= planners.size())
+                    break;
+                if (type == 'S')
+                {
+                    if (!(in >> j) || j >= runCount)
+                        break;
+                    started = i * runCount + j;
+                }
+                else if (type == 'P')
+                {
+                    Benchmark::PlannerExperiment &planner = planners[i];
+                    std::size_t count;
+                    if (!readProperties(in, planner.common) || !(in >> count))
+                        break;
+                    planner.progressPropertyNames.resize(count);
+                    bool good = true;
+                    for (auto &name : planner.progressPropertyNames)
+                        good = good && readString(in, name);
+                    if (!good)
+                        break;
+                }
+                else if (type == 'R')
+                {
+                    std::pair<Benchmark::RunProperties, Benchmark::RunProgressData> result;
+                    std::size_t count;
+                    if (!(in >> j) || !readProperties(in, result.first) || !(in >> count))
+                        break;
+                    result.second.resize(count);
+                    bool good = true;
+                    for (auto &data : result.second)
+                        good = good && readProperties(in, data);
+                    if (!good)
+                        break;
+                    results[i][j] = std::move(result);
+                }
+                else
+                    break;
+            }
+            return started;
+        }
+
         static bool terminationCondition(const machine::MemUsage_t maxMem, const time::point &endTime)
         {
             if (time::now() < endTime && machine::getProcessMemoryUsage() < maxMem)
@@ -80,6 +204,15 @@ namespace ompl
             {
             }
 
+            /** \brief Write the progress data to \e stream as run \e run of planner \e planner instead of
+             * keeping it */
+            void streamProgress(ResultsStream *stream, unsigned int planner, unsigned int run)
+            {
+                stream_ = stream;
+                streamPlanner_ = planner;
+                streamRun_ = run;
+            }
+
             void run(const base::PlannerPtr &planner, const machine::MemUsage_t memStart,
                      const machine::MemUsage_t maxMem, const double maxTime, const double timeBetweenUpdates)
             {
@@ -176,7 +309,10 @@ namespace ompl
                         {
                             data[property.first] = property.second();
                         }
-                        runProgressData_.push_back(data);
+                        if (stream_ != nullptr)
+                            stream_->addProgress(streamPlanner_, streamRun_, data);
+                        else
+                            runProgressData_.push_back(data);
                     }
                 }
             }
@@ -186,6 +322,9 @@ namespace ompl
             machine::MemUsage_t memUsed_;
             base::PlannerStatus status_;
             Benchmark::RunProgressData runProgressData_;
+            ResultsStream *stream_{nullptr};
+            unsigned int streamPlanner_{0};
+            unsigned int streamRun_{0};
 
             // variables needed for progress property collection
             bool solved_;
@@ -422,6 +561,17 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
 
     OMPL_INFORM("Done saving information");
 
+    if (!req.streamFilename.empty())
+    {
+        stream_ = std::make_shared<ResultsStream>(req.streamFilename);
+        stream_->writeExperiment(exp_);
+        if (!stream_->good())
+        {
+            OMPL_ERROR("Unable to stream results to '%s'; keeping them in memory", req.streamFilename.c_str());
+            stream_.reset();
+        }
+    }
+
     OMPL_INFORM("Beginning benchmark");
     msg::OutputHandler *oh = msg::getOutputHandler();
     boost::scoped_ptr<msg::OutputHandlerFile> ohf;
@@ -447,44 +597,21 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
     }
 
     machine::MemUsage_t memStart = machine::getProcessMemoryUsage();
-    auto maxMemBytes = (machine::MemUsage_t)(req.maxMem * 1024 * 1024);
 
-    for (unsigned int i = 0; i < planners_.size(); ++i)
+    bool ranInProcesses = false;
+    if (req.processCount > 1)
     {
-        status_.activePlanner = exp_.planners[i].name;
-        // execute planner switch event, if set
-        try
-        {
-            if (plannerSwitch_)
-            {
-                OMPL_INFORM("Executing planner-switch event for planner %s ...", status_.activePlanner.c_str());
-                plannerSwitch_(planners_[i]);
-                OMPL_INFORM("Completed execution of planner-switch event");
-            }
-        }
-        catch (std::runtime_error &e)
-        {
-            std::stringstream es;
-            es << "There was an error executing the planner-switch event for planner " << status_.activePlanner
-               << std::endl;
-            es << "*** " << e.what() << std::endl;
-            std::cerr << es.str();
-            OMPL_ERROR(es.str().c_str());
-        }
-        if (gsetup_)
-            gsetup_->setup();
+        if (req.runCount == 0)
+            OMPL_WARN("Runs that share a total time limit (runCount = 0) are executed in a single process");
         else
-            csetup_->setup();
-        planners_[i]->params().getParams(exp_.planners[i].common);
-        planners_[i]->getSpaceInformation()->params().getParams(exp_.planners[i].common);
+            ranInProcesses = runInProcesses(req, progress.get());
+    }
 
-        // Add planner progress property names to struct
-        exp_.planners[i].progressPropertyNames.emplace_back("time REAL");
-        for (const auto &property : planners_[i]->getPlannerProgressProperties())
-        {
-            exp_.planners[i].progressPropertyNames.push_back(property.first);
-        }
-        std::sort(exp_.planners[i].progressPropertyNames.begin(), exp_.planners[i].progressPropertyNames.end());
+    for (unsigned int i = 0; i < planners_.size() && !ranInProcesses; ++i)
+    {
+        preparePlanner(i);
+        if (stream_)
+            stream_->writePlanner(i, exp_.planners[i], !planners_[i]->getPlannerProgressProperties().empty());
 
         // run the planner
         double maxTime = req.maxTime;
@@ -500,212 +627,505 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
                 while (status_.progressPercentage > progress->count())
                     ++(*progress);
 
-            OMPL_INFORM("Preparing for run %d of %s", status_.activeRun, status_.activePlanner.c_str());
+            double timeUsed = runPlanner(i, maxTime, req, memStart);
 
-            // make sure all planning data structures are cleared
-            try
+            ++j;
+            if (req.runCount == 0)
             {
-                planners_[i]->clear();
-                if (gsetup_)
-                {
-                    gsetup_->getProblemDefinition()->clearSolutionPaths();
-                    gsetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
-                }
-                else
-                {
-                    csetup_->getProblemDefinition()->clearSolutionPaths();
-                    csetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
-                }
+                maxTime -= timeUsed;
+                if (maxTime < 0.)
+                    break;
             }
-            catch (std::runtime_error &e)
+            else
             {
-                std::stringstream es;
-                es << "There was an error while preparing for run " << status_.activeRun << " of planner "
-                   << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
+                if (j >= req.runCount)
+                    break;
             }
+        }
+        planners_[i]->clear();
+    }
+
+    status_.running = false;
+    status_.progressPercentage = 100.0;
+    if (req.displayProgress)
+    {
+        while (status_.progressPercentage > progress->count())
+            ++(*progress);
+        std::cout << std::endl;
+    }
+
+    exp_.totalDuration = time::seconds(time::now() - exp_.startTime);
+    if (stream_)
+    {
+        stream_->writeDuration(exp_.totalDuration);
+        stream_.reset();
+    }
+
+    OMPL_INFORM("Benchmark complete");
+    msg::useOutputHandler(oh);
+    OMPL_INFORM("Benchmark complete");
+}
+
+void ompl::tools::Benchmark::preparePlanner(unsigned int i)
+{
+    status_.activePlanner = exp_.planners[i].name;
+    // the generators created while preparing the planner get the same seeds in every process
+    RNG::restartSeedSequence(getRunSeed(exp_.seed, i, PREPARATION_RUN));
+    // execute planner switch event, if set
+    try
+    {
+        if (plannerSwitch_)
+        {
+            OMPL_INFORM("Executing planner-switch event for planner %s ...", status_.activePlanner.c_str());
+            plannerSwitch_(planners_[i]);
+            OMPL_INFORM("Completed execution of planner-switch event");
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error executing the planner-switch event for planner " << status_.activePlanner
+           << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
+    if (gsetup_)
+        gsetup_->setup();
+    else
+        csetup_->setup();
+    planners_[i]->params().getParams(exp_.planners[i].common);
+    planners_[i]->getSpaceInformation()->params().getParams(exp_.planners[i].common);
 
-            // execute pre-run event, if set
-            try
+    // Add planner progress property names to struct
+    exp_.planners[i].progressPropertyNames.emplace_back("time REAL");
+    for (const auto &property : planners_[i]->getPlannerProgressProperties())
+    {
+        exp_.planners[i].progressPropertyNames.push_back(property.first);
+    }
+    std::sort(exp_.planners[i].progressPropertyNames.begin(), exp_.planners[i].progressPropertyNames.end());
+}
+
+double ompl::tools::Benchmark::runPlanner(unsigned int i, double maxTime, const Request &req,
+                                          machine::MemUsage_t memStart)
+{
+    OMPL_INFORM("Preparing for run %d of %s", status_.activeRun, status_.activePlanner.c_str());
+
+    // make sure all planning data structures are cleared
+    try
+    {
+        planners_[i]->clear();
+        if (gsetup_)
+        {
+            gsetup_->getProblemDefinition()->clearSolutionPaths();
+            gsetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
+        }
+        else
+        {
+            csetup_->getProblemDefinition()->clearSolutionPaths();
+            csetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error while preparing for run " << status_.activeRun << " of planner "
+           << status_.activePlanner << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
+
+    // every run starts from its own seed: the samplers the planner allocates after being cleared take their seeds
+    // from it, so they do not depend on the runs executed before or on the number of processes. Generators that
+    // already exist (including the ones of the user) are not changed.
+    const std::uint_fast32_t seed = getRunSeed(exp_.seed, i, status_.activeRun);
+    RNG::restartSeedSequence(seed);
+
+    // execute pre-run event, if set
+    try
+    {
+        if (preRun_)
+        {
+            OMPL_INFORM("Executing pre-run event for run %d of planner %s ...", status_.activeRun,
+                        status_.activePlanner.c_str());
+            preRun_(planners_[i]);
+            OMPL_INFORM("Completed execution of pre-run event");
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error executing the pre-run event for run " << status_.activeRun << " of planner "
+           << status_.activePlanner << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
+
+    RunPlanner rp(this);
+    if (stream_)
+        rp.streamProgress(stream_.get(), i, status_.activeRun);
+    rp.run(planners_[i], memStart, (machine::MemUsage_t)(req.maxMem * 1024 * 1024), maxTime,
+           req.timeBetweenUpdates);
+    if (stream_)
+        stream_->flushProgress();
+    bool solved = gsetup_ ? gsetup_->haveSolutionPath() : csetup_->haveSolutionPath();
+
+    // store results
+    try
+    {
+        RunProperties run;
+
+        run["random seed INTEGER"] = std::to_string(seed);
+        run["time REAL"] = ompl::toString(rp.getTimeUsed());
+        run["memory REAL"] = ompl::toString((double)rp.getMemUsed() / (1024.0 * 1024.0));
+        run["status ENUM"] = std::to_string((int)static_cast<base::PlannerStatus::StatusType>(rp.getStatus()));
+        if (gsetup_)
+        {
+            run["solved BOOLEAN"] = std::to_string(gsetup_->haveExactSolutionPath());
+            run["valid segment fraction REAL"] =
+                ompl::toString(gsetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
+        }
+        else
+        {
+            run["solved BOOLEAN"] = std::to_string(csetup_->haveExactSolutionPath());
+            run["valid segment fraction REAL"] =
+                ompl::toString(csetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
+        }
+
+        if (solved)
+        {
+            if (gsetup_)
             {
-                if (preRun_)
+                run["approximate solution BOOLEAN"] =
+                    std::to_string(gsetup_->getProblemDefinition()->hasApproximateSolution());
+                run["solution difference REAL"] =
+                    ompl::toString(gsetup_->getProblemDefinition()->getSolutionDifference());
+                run["solution length REAL"] = ompl::toString(gsetup_->getSolutionPath().length());
+                run["solution smoothness REAL"] = ompl::toString(gsetup_->getSolutionPath().smoothness());
+                run["solution clearance REAL"] = ompl::toString(gsetup_->getSolutionPath().clearance());
+                run["solution segments INTEGER"] =
+                    std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
+                run["correct solution BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
+
+                unsigned int factor = gsetup_->getStateSpace()->getValidSegmentCountFactor();
+                gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
+                run["correct solution strict BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
+                gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
+
+                if (req.simplify)
                 {
-                    OMPL_INFORM("Executing pre-run event for run %d of planner %s ...", status_.activeRun,
-                                status_.activePlanner.c_str());
-                    preRun_(planners_[i]);
-                    OMPL_INFORM("Completed execution of pre-run event");
+                    // simplify solution
+                    time::point timeStart = time::now();
+                    gsetup_->simplifySolution();
+                    double timeUsed = time::seconds(time::now() - timeStart);
+                    run["simplification time REAL"] = ompl::toString(timeUsed);
+                    run["simplified solution length REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().length());
+                    run["simplified solution smoothness REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().smoothness());
+                    run["simplified solution clearance REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().clearance());
+                    run["simplified solution segments INTEGER"] =
+                        std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
+                    run["simplified correct solution BOOLEAN"] =
+                        std::to_string(gsetup_->getSolutionPath().check());
+                    gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
+                    run["simplified correct solution strict BOOLEAN"] =
+                        std::to_string(gsetup_->getSolutionPath().check());
+                    gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
                 }
             }
-            catch (std::runtime_error &e)
+            else
             {
-                std::stringstream es;
-                es << "There was an error executing the pre-run event for run " << status_.activeRun << " of planner "
-                   << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
+                run["approximate solution BOOLEAN"] =
+                    std::to_string(csetup_->getProblemDefinition()->hasApproximateSolution());
+                run["solution difference REAL"] =
+                    ompl::toString(csetup_->getProblemDefinition()->getSolutionDifference());
+                run["solution length REAL"] = ompl::toString(csetup_->getSolutionPath().length());
+                run["solution clearance REAL"] =
+                    ompl::toString(csetup_->getSolutionPath().asGeometric().clearance());
+                run["solution segments INTEGER"] = std::to_string(csetup_->getSolutionPath().getControlCount());
+                run["correct solution BOOLEAN"] = std::to_string(csetup_->getSolutionPath().check());
             }
+        }
+
+        base::PlannerData pd(gsetup_ ? gsetup_->getSpaceInformation() : csetup_->getSpaceInformation());
+        planners_[i]->getPlannerData(pd);
+        run["graph states INTEGER"] = std::to_string(pd.numVertices());
+        run["graph motions INTEGER"] = std::to_string(pd.numEdges());
 
-            RunPlanner rp(this);
-            rp.run(planners_[i], memStart, maxMemBytes, maxTime, req.timeBetweenUpdates);
-            bool solved = gsetup_ ? gsetup_->haveSolutionPath() : csetup_->haveSolutionPath();
+        for (const auto &prop : pd.properties)
+            run[prop.first] = prop.second;
 
-            // store results
-            try
+        // execute post-run event, if set
+        try
+        {
+            if (postRun_)
             {
-                RunProperties run;
+                OMPL_INFORM("Executing post-run event for run %d of planner %s ...", status_.activeRun,
+                            status_.activePlanner.c_str());
+                postRun_(planners_[i], run);
+                OMPL_INFORM("Completed execution of post-run event");
+            }
+        }
+        catch (std::runtime_error &e)
+        {
+            std::stringstream es;
+            es << "There was an error in the execution of the post-run event for run " << status_.activeRun
+               << " of planner " << status_.activePlanner << std::endl;
+            es << "*** " << e.what() << std::endl;
+            std::cerr << es.str();
+            OMPL_ERROR(es.str().c_str());
+        }
 
-                run["time REAL"] = ompl::toString(rp.getTimeUsed());
-                run["memory REAL"] = ompl::toString((double)rp.getMemUsed() / (1024.0 * 1024.0));
-                run["status ENUM"] = std::to_string((int)static_cast<base::PlannerStatus::StatusType>(rp.getStatus()));
-                if (gsetup_)
-                {
-                    run["solved BOOLEAN"] = std::to_string(gsetup_->haveExactSolutionPath());
-                    run["valid segment fraction REAL"] =
-                        ompl::toString(gsetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
-                }
-                else
-                {
-                    run["solved BOOLEAN"] = std::to_string(csetup_->haveExactSolutionPath());
-                    run["valid segment fraction REAL"] =
-                        ompl::toString(csetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
-                }
+        if (stream_)
+            stream_->writeRun(i, status_.activeRun, run);
+        else
+            exp_.planners[i].runs.push_back(run);
 
-                if (solved)
-                {
-                    if (gsetup_)
-                    {
-                        run["approximate solution BOOLEAN"] =
-                            std::to_string(gsetup_->getProblemDefinition()->hasApproximateSolution());
-                        run["solution difference REAL"] =
-                            ompl::toString(gsetup_->getProblemDefinition()->getSolutionDifference());
-                        run["solution length REAL"] = ompl::toString(gsetup_->getSolutionPath().length());
-                        run["solution smoothness REAL"] = ompl::toString(gsetup_->getSolutionPath().smoothness());
-                        run["solution clearance REAL"] = ompl::toString(gsetup_->getSolutionPath().clearance());
-                        run["solution segments INTEGER"] =
-                            std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
-                        run["correct solution BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
-
-                        unsigned int factor = gsetup_->getStateSpace()->getValidSegmentCountFactor();
-                        gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
-                        run["correct solution strict BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
-                        gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
-
-                        if (req.simplify)
-                        {
-                            // simplify solution
-                            time::point timeStart = time::now();
-                            gsetup_->simplifySolution();
-                            double timeUsed = time::seconds(time::now() - timeStart);
-                            run["simplification time REAL"] = ompl::toString(timeUsed);
-                            run["simplified solution length REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().length());
-                            run["simplified solution smoothness REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().smoothness());
-                            run["simplified solution clearance REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().clearance());
-                            run["simplified solution segments INTEGER"] =
-                                std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
-                            run["simplified correct solution BOOLEAN"] =
-                                std::to_string(gsetup_->getSolutionPath().check());
-                            gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
-                            run["simplified correct solution strict BOOLEAN"] =
-                                std::to_string(gsetup_->getSolutionPath().check());
-                            gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
-                        }
-                    }
-                    else
-                    {
-                        run["approximate solution BOOLEAN"] =
-                            std::to_string(csetup_->getProblemDefinition()->hasApproximateSolution());
-                        run["solution difference REAL"] =
-                            ompl::toString(csetup_->getProblemDefinition()->getSolutionDifference());
-                        run["solution length REAL"] = ompl::toString(csetup_->getSolutionPath().length());
-                        run["solution clearance REAL"] =
-                            ompl::toString(csetup_->getSolutionPath().asGeometric().clearance());
-                        run["solution segments INTEGER"] = std::to_string(csetup_->getSolutionPath().getControlCount());
-                        run["correct solution BOOLEAN"] = std::to_string(csetup_->getSolutionPath().check());
-                    }
-                }
+        // Add planner progress data from the planner progress
+        // collector if there was anything to report
+        if (!stream_ && planners_[i]->getPlannerProgressProperties().size() > 0)
+        {
+            exp_.planners[i].runsProgressData.push_back(rp.getRunProgressData());
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error in the extraction of planner results: planner = " << status_.activePlanner
+           << ", run = " << status_.activePlanner << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
 
-                base::PlannerData pd(gsetup_ ? gsetup_->getSpaceInformation() : csetup_->getSpaceInformation());
-                planners_[i]->getPlannerData(pd);
-                run["graph states INTEGER"] = std::to_string(pd.numVertices());
-                run["graph motions INTEGER"] = std::to_string(pd.numEdges());
+    return rp.getTimeUsed();
+}
 
-                for (const auto &prop : pd.properties)
-                    run[prop.first] = prop.second;
+bool ompl::tools::Benchmark::runInProcesses(const Request &req, time::ProgressDisplay *progress)
+{
+#ifdef _WIN32
+    (void)req;
+    (void)progress;
+    OMPL_WARN("Executing runs in multiple processes requires fork(); using a single process");
+    return false;
+#else
+    const std::size_t runCount = planners_.size() * req.runCount;
+    const auto processCount = (unsigned int)std::min<std::size_t>(req.processCount, runCount);
+
+    // each worker process writes the results of its runs to a temporary file. A worker that replaces a killed one
+    // gets a new file.
+    struct Worker
+    {
+        pid_t pid;
+        std::size_t firstRun;
+        std::string file;
+        off_t fileSize;
+        time::point lastWrite;
+    };
+    std::vector<std::string> files;
+    std::vector<Worker> workers;
+    auto startWorker = [&](std::size_t firstRun)
+    {
+        char name[] = "/tmp/ompl_benchmark_XXXXXX";
+        int fd = mkstemp(name);
+        if (fd < 0)
+        {
+            OMPL_ERROR("Unable to create a temporary file for a benchmark worker process");
+            return;
+        }
+        close(fd);
+        files.emplace_back(name);
 
-                // execute post-run event, if set
-                try
+        // make sure that buffered output is not written again by the worker
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            runWorker(req, firstRun, processCount, files.back());
+            std::fflush(nullptr);
+            std::_Exit(0);
+        }
+        if (pid < 0)
+            OMPL_ERROR("Unable to start a benchmark worker process");
+        else
+            workers.push_back(Worker{pid, firstRun, files.back(), 0, time::now()});
+    };
+
+    for (unsigned int k = 0; k < processCount; ++k)
+        startWorker(k);
+    if (workers.empty())
+    {
+        for (const auto &file : files)
+            std::remove(file.c_str());
+        OMPL_WARN("Using a single process");
+        return false;
+    }
+
+    // A worker writes to its file when it starts a run and when it completes one. One that does not write anything
+    // for longer than the time limit of a run plus the grace period is killed; the run it started is recorded as
+    // crashed, and a new worker executes its remaining runs.
+    const time::duration timeout = time::seconds(req.maxTime + req.gracePeriod);
+    unsigned int finished = 0;
+    while (!workers.empty())
+    {
+        std::vector<std::size_t> restarts;
+        for (auto worker = workers.begin(); worker != workers.end();)
+        {
+            int wstatus = 0;
+            pid_t pid = waitpid(worker->pid, &wstatus, WNOHANG);
+            if (pid == 0)
+            {
+                struct stat info;
+                if (stat(worker->file.c_str(), &info) == 0 && info.st_size != worker->fileSize)
                 {
-                    if (postRun_)
-                    {
-                        OMPL_INFORM("Executing post-run event for run %d of planner %s ...", status_.activeRun,
-                                    status_.activePlanner.c_str());
-                        postRun_(planners_[i], run);
-                        OMPL_INFORM("Completed execution of post-run event");
-                    }
+                    worker->fileSize = info.st_size;
+                    worker->lastWrite = time::now();
                 }
-                catch (std::runtime_error &e)
+                else if (time::now() - worker->lastWrite > timeout)
                 {
-                    std::stringstream es;
-                    es << "There was an error in the execution of the post-run event for run " << status_.activeRun
-                       << " of planner " << status_.activePlanner << std::endl;
-                    es << "*** " << e.what() << std::endl;
-                    std::cerr << es.str();
-                    OMPL_ERROR(es.str().c_str());
+                    OMPL_WARN("Benchmark worker process %d exceeded the time limit of its run; the run is marked as "
+                              "crashed",
+                              (int)worker->pid);
+                    kill(worker->pid, SIGKILL);
+                    while (waitpid(worker->pid, &wstatus, 0) < 0 && errno == EINTR)
+                        ;
+                    WorkerResults results(planners_.size());
+                    std::size_t run = readWorkerFile(worker->file, req.runCount, exp_.planners, results);
+                    if (run == runCount)
+                        run = worker->firstRun;
+                    if (run + processCount < runCount)
+                        restarts.push_back(run + processCount);
+                    else
+                        ++finished;
+                    worker = workers.erase(worker);
+                    continue;
                 }
+                ++worker;
+                continue;
+            }
+            if (pid < 0 && errno == EINTR)
+                continue;
+            if (pid < 0 || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+                OMPL_WARN("Benchmark worker process %d terminated abnormally; its remaining runs are marked as crashed",
+                          (int)worker->pid);
+            ++finished;
+            worker = workers.erase(worker);
+        }
+        for (std::size_t run : restarts)
+            startWorker(run);
+
+        status_.progressPercentage = (double)(100 * finished) / (double)processCount;
+        if (progress != nullptr)
+            while (status_.progressPercentage > progress->count())
+                ++(*progress);
+        if (!workers.empty())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
 
-                exp_.planners[i].runs.push_back(run);
+    // merge the results of the workers, in the order in which a single process would have produced them
+    WorkerResults results(planners_.size());
+    for (const auto &file : files)
+    {
+        readWorkerFile(file, req.runCount, exp_.planners, results);
+        std::remove(file.c_str());
+    }
 
-                // Add planner progress data from the planner progress
-                // collector if there was anything to report
-                if (planners_[i]->getPlannerProgressProperties().size() > 0)
-                {
-                    exp_.planners[i].runsProgressData.push_back(rp.getRunProgressData());
-                }
-            }
-            catch (std::runtime_error &e)
+    for (unsigned int i = 0; i < planners_.size(); ++i)
+    {
+        const bool progressData = !planners_[i]->getPlannerProgressProperties().empty();
+        if (stream_)
+            stream_->writePlanner(i, exp_.planners[i], progressData);
+        for (unsigned int j = 0; j < req.runCount; ++j)
+        {
+            auto result = results[i].find(j);
+            if (result == results[i].end())
             {
-                std::stringstream es;
-                es << "There was an error in the extraction of planner results: planner = " << status_.activePlanner
-                   << ", run = " << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
+                results[i][j].first["status ENUM"] = std::to_string((int)base::PlannerStatus::CRASH);
+                results[i][j].first["solved BOOLEAN"] = std::to_string(false);
+                result = results[i].find(j);
             }
-
-            ++j;
-            if (req.runCount == 0)
+            if (stream_)
             {
-                maxTime -= rp.getTimeUsed();
-                if (maxTime < 0.)
-                    break;
+                for (const auto &data : result->second.second)
+                    stream_->addProgress(i, j, data);
+                stream_->flushProgress();
+                stream_->writeRun(i, j, result->second.first);
             }
             else
             {
-                if (j >= req.runCount)
-                    break;
+                exp_.planners[i].runs.push_back(std::move(result->second.first));
+                if (progressData)
+                    exp_.planners[i].runsProgressData.push_back(std::move(result->second.second));
             }
+            results[i].erase(result);
         }
-        planners_[i]->clear();
     }
+    return true;
+#endif
+}
 
-    status_.running = false;
-    status_.progressPercentage = 100.0;
-    if (req.displayProgress)
-    {
-        while (status_.progressPercentage > progress->count())
-            ++(*progress);
-        std::cout << std::endl;
-    }
+void ompl::tools::Benchmark::runWorker(const Request &req, std::size_t firstRun, unsigned int workerCount,
+                                       const std::string &filename)
+{
+    // the results of the worker are merged (and streamed, if requested) by the parent process
+    stream_.reset();
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    machine::MemUsage_t memStart = machine::getProcessMemoryUsage();
 
-    exp_.totalDuration = time::seconds(time::now() - exp_.startTime);
+    // the runs are numbered planner by planner; this worker executes every workerCount-th of them, starting at
+    // firstRun
+    auto current = (unsigned int)planners_.size();
+    for (std::size_t job = firstRun; job < planners_.size() * req.runCount; job += workerCount)
+    {
+        const auto i = (unsigned int)(job / req.runCount);
+        const auto j = (unsigned int)(job % req.runCount);
 
-    OMPL_INFORM("Benchmark complete");
-    msg::useOutputHandler(oh);
-    OMPL_INFORM("Benchmark complete");
+        // written before the planner is prepared, so that the parent knows which run a hung worker was executing
+        out << "S " << i << ' ' << j << std::endl;
+        if (i != current)
+        {
+            if (current < planners_.size())
+                planners_[current]->clear();
+            current = i;
+            preparePlanner(i);
+
+            out << "P " << i << ' ';
+            writeProperties(out, exp_.planners[i].common);
+            out << exp_.planners[i].progressPropertyNames.size() << ' ';
+            for (const auto &name : exp_.planners[i].progressPropertyNames)
+                writeString(out, name);
+            out << std::endl;
+        }
+        status_.activeRun = j;
+
+        PlannerExperiment &planner = exp_.planners[i];
+        const std::size_t runs = planner.runs.size();
+        const std::size_t progressRuns = planner.runsProgressData.size();
+        runPlanner(i, req.maxTime, req, memStart);
+        if (planner.runs.size() == runs)
+            continue;
+        const RunProperties &run = planner.runs.back();
+
+        out << "R " << i << ' ' << j << ' ';
+        writeProperties(out, run);
+        if (planner.runsProgressData.size() > progressRuns)
+        {
+            out << planner.runsProgressData.back().size() << ' ';
+            for (const auto &data : planner.runsProgressData.back())
+                writeProperties(out, data);
+        }
+        else
+            out << "0 ";
+        // flush after every run, so that completed runs are kept if the worker crashes later
+        out << std::endl;
+    }
+    if (current < planners_.size())
+        planners_[current]->clear();
 }
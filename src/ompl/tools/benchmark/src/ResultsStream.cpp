@@ -0,0 +1,583 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#include "ompl/tools/benchmark/ResultsStream.h"
+#include "ompl/util/Console.h"
+#include "ompl/util/String.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+/// @cond IGNORE
+namespace
+{
+    // The file starts with this signature, followed by records. A record is a type character, the size of its
+    // payload and the payload. Numbers are stored in little-endian byte order.
+    const char SIGNATURE[8] = {'O', 'M', 'P', 'L', 'R', 'S', '1', '\n'};
+
+    // The types of columns
+    const char REAL = 'R';
+    const char INTEGER = 'I';
+    const char BOOLEAN = 'B';
+    const char ENUM = 'E';
+    const char STRING = 'S';
+
+    char getColumnType(const std::string &name)
+    {
+        const std::size_t pos = name.rfind(' ');
+        const std::string suffix = pos == std::string::npos ? std::string() : name.substr(pos + 1);
+        if (suffix == "REAL")
+            return REAL;
+        if (suffix == "INTEGER")
+            return INTEGER;
+        if (suffix == "BOOLEAN")
+            return BOOLEAN;
+        if (suffix == "ENUM")
+            return ENUM;
+        return STRING;
+    }
+
+    void putUInt(std::string &out, std::uint64_t value, unsigned int bytes)
+    {
+        for (unsigned int i = 0; i < bytes; ++i, value >>= 8)
+            out.push_back(static_cast<char>(value & 0xff));
+    }
+
+    void putU32(std::string &out, std::size_t value)
+    {
+        putUInt(out, value, 4);
+    }
+
+    void putReal(std::string &out, double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putUInt(out, bits, 8);
+    }
+
+    void putString(std::string &out, const std::string &str)
+    {
+        putU32(out, str.size());
+        out += str;
+    }
+
+    void putProperties(std::string &out, const std::map<std::string, std::string> &properties)
+    {
+        putU32(out, properties.size());
+        for (const auto &property : properties)
+        {
+            putString(out, property.first);
+            putString(out, property.second);
+        }
+    }
+
+    /* Append the value of a column of type \e type to \e out. Returns false if \e value does not have that type. */
+    bool putValue(std::string &out, char type, const std::string &value)
+    {
+        if (value.empty())
+            return false;
+        const char *begin = value.c_str();
+        char *end = nullptr;
+        errno = 0;
+        switch (type)
+        {
+            case REAL:
+            {
+                const double v = std::strtod(begin, &end);
+                if (*end != '\0')
+                    return false;
+                putReal(out, v);
+                return true;
+            }
+            case INTEGER:
+            case ENUM:
+            {
+                const long long v = std::strtoll(begin, &end, 10);
+                if (*end != '\0' || errno == ERANGE)
+                    return false;
+                putUInt(out, static_cast<std::uint64_t>(v), 8);
+                return true;
+            }
+            case BOOLEAN:
+                if (value == "1" || value == "true")
+                    out.push_back(1);
+                else if (value == "0" || value == "false")
+                    out.push_back(0);
+                else
+                    return false;
+                return true;
+            default:
+                putString(out, value);
+                return true;
+        }
+    }
+
+    /* As putValue(), for the value of property \e name. A value that is given but does not have the type of the
+       property is recorded as missing, with a warning. */
+    bool putProperty(std::string &out, char type, const std::string &name, const std::string &value)
+    {
+        if (putValue(out, type, value))
+            return true;
+        if (!value.empty())
+            OMPL_WARN("ResultsStream: Value '%s' of property '%s' does not have the type of the property and is not "
+                      "recorded",
+                      value.c_str(), name.c_str());
+        return false;
+    }
+
+    void putBitmap(std::string &out, const std::vector<bool> &bits)
+    {
+        for (std::size_t i = 0; i < bits.size(); i += 8)
+        {
+            unsigned char byte = 0;
+            for (std::size_t j = i; j < i + 8 && j < bits.size(); ++j)
+                if (bits[j])
+                    byte |= 1u << (j - i);
+            out.push_back(static_cast<char>(byte));
+        }
+    }
+
+    /* Reads the payload of a record; every read fails once the payload is exhausted */
+    class Reader
+    {
+    public:
+        Reader(const std::string &data) : data_(data)
+        {
+        }
+
+        bool good() const
+        {
+            return good_;
+        }
+
+        std::uint64_t getUInt(unsigned int bytes)
+        {
+            if (!available(bytes))
+                return 0;
+            std::uint64_t value = 0;
+            for (unsigned int i = 0; i < bytes; ++i)
+                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(data_[pos_ + i])) << (8 * i);
+            pos_ += bytes;
+            return value;
+        }
+
+        unsigned int getU32()
+        {
+            return static_cast<unsigned int>(getUInt(4));
+        }
+
+        double getReal()
+        {
+            const std::uint64_t bits = getUInt(8);
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        std::string getString()
+        {
+            const std::size_t size = getU32();
+            if (!available(size))
+                return std::string();
+            std::string str = data_.substr(pos_, size);
+            pos_ += size;
+            return str;
+        }
+
+        std::map<std::string, std::string> getProperties()
+        {
+            std::map<std::string, std::string> properties;
+            const unsigned int count = getU32();
+            for (unsigned int i = 0; i < count && good_; ++i)
+            {
+                std::string name = getString();
+                properties[name] = getString();
+            }
+            return properties;
+        }
+
+        std::vector<bool> getBitmap(std::size_t count)
+        {
+            std::vector<bool> bits(count, false);
+            if (!available((count + 7) / 8))
+                return bits;
+            for (std::size_t i = 0; i < count; ++i)
+                bits[i] = ((static_cast<unsigned char>(data_[pos_ + i / 8]) >> (i % 8)) & 1u) != 0;
+            pos_ += (count + 7) / 8;
+            return bits;
+        }
+
+        std::string getValue(char type)
+        {
+            switch (type)
+            {
+                case REAL:
+                    return ompl::toString(getReal());
+                case INTEGER:
+                case ENUM:
+                    return std::to_string(static_cast<long long>(getUInt(8)));
+                case BOOLEAN:
+                    return std::to_string(getUInt(1) != 0);
+                default:
+                    return getString();
+            }
+        }
+
+    private:
+        bool available(std::size_t bytes)
+        {
+            if (pos_ + bytes > data_.size())
+                good_ = false;
+            return good_;
+        }
+
+        const std::string &data_;
+        std::size_t pos_{0};
+        bool good_{true};
+    };
+}
+/// @endcond
+
+ompl::tools::ResultsStream::ResultsStream(const std::string &filename)
+  : out_(filename.c_str(), std::ios::binary | std::ios::trunc)
+{
+    if (!out_.good())
+        OMPL_ERROR("Unable to write benchmark results to '%s'", filename.c_str());
+    out_.write(SIGNATURE, sizeof(SIGNATURE));
+    out_.flush();
+}
+
+ompl::tools::ResultsStream::~ResultsStream()
+{
+    flushProgress();
+}
+
+void ompl::tools::ResultsStream::writeRecord(char type, const std::string &payload)
+{
+    std::string header(1, type);
+    putU32(header, payload.size());
+    out_.write(header.data(), header.size());
+    out_.write(payload.data(), payload.size());
+    // every record is flushed, so that the file can be read up to the last record if the process dies
+    out_.flush();
+}
+
+void ompl::tools::ResultsStream::writeExperiment(const Benchmark::CompleteExperiment &exp)
+{
+    std::string payload;
+    putString(payload, exp.name);
+    putString(payload, exp.host);
+    putString(payload, exp.cpuInfo);
+    putString(payload, exp.setupInfo);
+    putUInt(payload, exp.seed, 8);
+    putReal(payload, exp.maxTime);
+    putReal(payload, exp.maxMem);
+    putU32(payload, exp.runCount);
+    putUInt(payload,
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(exp.startTime.time_since_epoch()).count()),
+            8);
+    putProperties(payload, exp.parameters);
+    writeRecord('E', payload);
+}
+
+void ompl::tools::ResultsStream::writePlanner(unsigned int i, const Benchmark::PlannerExperiment &planner,
+                                              bool hasProgress)
+{
+    if (progressSchemas_.size() <= i)
+    {
+        schemas_.resize(i + 1);
+        progressSchemas_.resize(i + 1);
+    }
+    Schema &progress = progressSchemas_[i];
+    progress = Schema();
+    for (const auto &name : planner.progressPropertyNames)
+    {
+        progress.index[name] = progress.names.size();
+        progress.names.push_back(name);
+        progress.types.push_back(getColumnType(name));
+    }
+
+    std::string payload;
+    putU32(payload, i);
+    putString(payload, planner.name);
+    payload.push_back(hasProgress ? 1 : 0);
+    putProperties(payload, planner.common);
+    putU32(payload, progress.names.size());
+    for (const auto &name : progress.names)
+        putString(payload, name);
+    writeRecord('P', payload);
+}
+
+void ompl::tools::ResultsStream::writeRun(unsigned int i, unsigned int run, const Benchmark::RunProperties &properties)
+{
+    if (schemas_.size() <= i)
+    {
+        schemas_.resize(i + 1);
+        progressSchemas_.resize(i + 1);
+    }
+    Schema &schema = schemas_[i];
+
+    // add the columns that no earlier run of this planner had
+    const std::size_t first = schema.names.size();
+    for (const auto &property : properties)
+        if (schema.index.find(property.first) == schema.index.end())
+        {
+            schema.index[property.first] = schema.names.size();
+            schema.names.push_back(property.first);
+            schema.types.push_back(getColumnType(property.first));
+        }
+    if (schema.names.size() > first)
+    {
+        std::string payload;
+        putU32(payload, i);
+        putU32(payload, first);
+        putU32(payload, schema.names.size() - first);
+        for (std::size_t c = first; c < schema.names.size(); ++c)
+        {
+            putString(payload, schema.names[c]);
+            payload.push_back(schema.types[c]);
+        }
+        writeRecord('C', payload);
+    }
+
+    std::vector<bool> present(schema.names.size(), false);
+    std::vector<std::string> values(schema.names.size());
+    for (const auto &property : properties)
+    {
+        const unsigned int c = schema.index[property.first];
+        present[c] = putProperty(values[c], schema.types[c], property.first, property.second);
+    }
+
+    std::string payload;
+    putU32(payload, i);
+    putU32(payload, run);
+    putU32(payload, schema.names.size());
+    putBitmap(payload, present);
+    for (const auto &value : values)
+        payload += value;
+    writeRecord('R', payload);
+}
+
+void ompl::tools::ResultsStream::addProgress(unsigned int i, unsigned int run,
+                                             const std::map<std::string, std::string> &sample)
+{
+    if (progressSchemas_.size() <= i)
+        return;
+    if (progressRows_ > 0 && (i != progressPlanner_ || run != progressRun_))
+        flushProgress();
+    const Schema &schema = progressSchemas_[i];
+    if (progressRows_ == 0)
+    {
+        progressPlanner_ = i;
+        progressRun_ = run;
+        progress_.assign(schema.names.size(), {});
+    }
+
+    for (std::size_t c = 0; c < schema.names.size(); ++c)
+    {
+        auto it = sample.find(schema.names[c]);
+        progress_[c].first.push_back(it != sample.end() && putProperty(progress_[c].second, schema.types[c],
+                                                                       schema.names[c], it->second));
+    }
+    if (++progressRows_ >= progressChunkSize_)
+        flushProgress();
+}
+
+void ompl::tools::ResultsStream::flushProgress()
+{
+    if (progressRows_ == 0)
+        return;
+    std::string payload;
+    putU32(payload, progressPlanner_);
+    putU32(payload, progressRun_);
+    putU32(payload, progressRows_);
+    putU32(payload, progress_.size());
+    for (const auto &column : progress_)
+    {
+        putBitmap(payload, column.first);
+        payload += column.second;
+    }
+    writeRecord('T', payload);
+    progress_.clear();
+    progressRows_ = 0;
+}
+
+void ompl::tools::ResultsStream::writeDuration(double duration)
+{
+    flushProgress();
+    std::string payload;
+    putReal(payload, duration);
+    writeRecord('D', payload);
+}
+
+bool ompl::tools::ResultsStream::read(const std::string &filename, Benchmark::CompleteExperiment &exp)
+{
+    std::ifstream in(filename.c_str(), std::ios::binary);
+    char signature[sizeof(SIGNATURE)];
+    if (!in.read(signature, sizeof(signature)) || std::memcmp(signature, SIGNATURE, sizeof(SIGNATURE)) != 0)
+    {
+        OMPL_ERROR("'%s' does not contain benchmark results", filename.c_str());
+        return false;
+    }
+
+    struct PlannerData
+    {
+        bool hasProgress{false};
+        std::vector<char> types;
+        std::vector<std::string> names;
+        std::map<unsigned int, Benchmark::RunProperties> runs;
+        std::map<unsigned int, Benchmark::RunProgressData> progress;
+    };
+    std::vector<PlannerData> planners;
+    bool haveExperiment = false;
+    exp = Benchmark::CompleteExperiment();
+    exp.totalDuration = 0.0;
+
+    std::string header(5, '\0'), payload;
+    while (in.read(&header[0], header.size()))
+    {
+        const char type = header[0];
+        Reader sizeReader(header);
+        sizeReader.getUInt(1);
+        payload.resize(sizeReader.getU32());
+        if (!payload.empty() && !in.read(&payload[0], payload.size()))
+            break;
+
+        Reader r(payload);
+        if (type == 'E')
+        {
+            exp.name = r.getString();
+            exp.host = r.getString();
+            exp.cpuInfo = r.getString();
+            exp.setupInfo = r.getString();
+            exp.seed = static_cast<std::uint_fast32_t>(r.getUInt(8));
+            exp.maxTime = r.getReal();
+            exp.maxMem = r.getReal();
+            exp.runCount = r.getU32();
+            exp.startTime = time::point(std::chrono::duration_cast<time::point::duration>(
+                std::chrono::microseconds(static_cast<std::int64_t>(r.getUInt(8)))));
+            exp.parameters = r.getProperties();
+            haveExperiment = r.good();
+        }
+        else if (type == 'D')
+            exp.totalDuration = r.getReal();
+        else if (type == 'P' || type == 'C' || type == 'R' || type == 'T')
+        {
+            const unsigned int i = r.getU32();
+            if (!r.good())
+                break;
+            if (exp.planners.size() <= i)
+            {
+                exp.planners.resize(i + 1);
+                planners.resize(i + 1);
+            }
+            PlannerData &planner = planners[i];
+            if (type == 'P')
+            {
+                exp.planners[i].name = r.getString();
+                planner.hasProgress = r.getUInt(1) != 0;
+                exp.planners[i].common = r.getProperties();
+                exp.planners[i].progressPropertyNames.resize(r.getU32());
+                for (auto &name : exp.planners[i].progressPropertyNames)
+                    name = r.getString();
+            }
+            else if (type == 'C')
+            {
+                const unsigned int first = r.getU32();
+                const unsigned int count = r.getU32();
+                if (first != planner.names.size())
+                    break;
+                for (unsigned int c = 0; c < count && r.good(); ++c)
+                {
+                    planner.names.push_back(r.getString());
+                    planner.types.push_back(static_cast<char>(r.getUInt(1)));
+                }
+            }
+            else if (type == 'R')
+            {
+                const unsigned int run = r.getU32();
+                const unsigned int count = r.getU32();
+                if (count > planner.names.size())
+                    break;
+                const std::vector<bool> present = r.getBitmap(count);
+                Benchmark::RunProperties properties;
+                for (unsigned int c = 0; c < count; ++c)
+                    if (present[c])
+                        properties[planner.names[c]] = r.getValue(planner.types[c]);
+                if (r.good())
+                    planner.runs[run] = std::move(properties);
+            }
+            else
+            {
+                const unsigned int run = r.getU32();
+                const unsigned int rows = r.getU32();
+                const unsigned int count = r.getU32();
+                const std::vector<std::string> &names = exp.planners[i].progressPropertyNames;
+                if (count != names.size())
+                    break;
+                Benchmark::RunProgressData &data = planner.progress[run];
+                const std::size_t start = data.size();
+                data.resize(start + rows);
+                for (unsigned int c = 0; c < count && r.good(); ++c)
+                {
+                    const std::vector<bool> present = r.getBitmap(rows);
+                    const char columnType = getColumnType(names[c]);
+                    for (unsigned int row = 0; row < rows; ++row)
+                        if (present[row])
+                            data[start + row][names[c]] = r.getValue(columnType);
+                }
+                if (!r.good())
+                    data.resize(start);
+            }
+        }
+        if (!r.good())
+            break;
+    }
+
+    for (std::size_t i = 0; i < planners.size(); ++i)
+    {
+        for (auto &run : planners[i].runs)
+        {
+            exp.planners[i].runs.push_back(std::move(run.second));
+            if (planners[i].hasProgress)
+                exp.planners[i].runsProgressData.push_back(std::move(planners[i].progress[run.first]));
+        }
+    }
+
+    if (!haveExperiment)
+        OMPL_ERROR("'%s' does not contain the description of the experiment", filename.c_str());
+    return haveExperiment;
+}
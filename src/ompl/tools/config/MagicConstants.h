@@ -103,6 +103,12 @@ namespace ompl
         /** \brief Default number of close solutions to choose from a path experience database
             (library) for further filtering used in the Lightning Framework */
         static const unsigned int NEAREST_K_RECALL_SOLUTIONS = 10;
+
+        /** \brief The largest number of packed coordinates per state (see
+            ompl::base::StateSpace::getPackedValueCount()) for which a kd-tree
+            is selected as the default nearest neighbors datastructure. In
+            higher dimensions, GNAT prunes its search more effectively. */
+        static const unsigned int MAX_KD_TREE_DIMENSION = 8;
     }
 }
 
@@ -44,6 +44,10 @@
 #include "ompl/datastructures/NearestNeighborsSqrtApprox.h"
 #include "ompl/datastructures/NearestNeighborsGNAT.h"
 #include "ompl/datastructures/NearestNeighborsGNATNoThreadSafety.h"
+#include "ompl/datastructures/NearestNeighborsConcurrentGNAT.h"
+#include "ompl/datastructures/NearestNeighborsKDTree.h"
+#include "ompl/tools/config/MagicConstants.h"
+#include <algorithm>
 #include <mutex>
 #include <iostream>
 #include <string>
@@ -98,7 +102,7 @@ namespace ompl
              * - If the space is a metric space and the planner is single-threaded,
              *   then the default is ompl::NearestNeighborsGNATNoThreadSafety.
              * - If the space is a metric space and the planner is multi-threaded,
-             *   then the default is ompl::NearestNeighborsGNAT.
+             *   then the default is ompl::NearestNeighborsConcurrentGNAT.
              * - If the space is a not a metric space,
              *   then the default is ompl::NearestNeighborsSqrtApprox.
              */
@@ -110,12 +114,77 @@ namespace ompl
                 if (space->isMetricSpace())
                 {
                     if (specs.multithreaded)
-                        return new NearestNeighborsGNAT<_T>();
+                        return new NearestNeighborsConcurrentGNAT<_T>();
                     return new NearestNeighborsGNATNoThreadSafety<_T>();
                 }
                 return new NearestNeighborsSqrtApprox<_T>();
             }
 
+            /** \brief Select a default nearest neighbor datastructure for a planner whose distance between
+             * elements is the distance in the state space between the states returned by \e stateFn.
+             *
+             * For single-threaded planners in spaces with at most magic::MAX_KD_TREE_DIMENSION packed
+             * coordinates (such as low-dimensional real vector spaces, SE2 and SE3), the default is
+             * ompl::NearestNeighborsKDTree. Otherwise, the choice is the same as for the function above.
+             */
+            template <typename _T>
+            static NearestNeighbors<_T> *
+            getDefaultNearestNeighbors(const base::Planner *planner,
+                                       const typename NearestNeighborsKDTree<_T>::StateFunction &stateFn)
+            {
+                const base::StateSpacePtr &space = planner->getSpaceInformation()->getStateSpace();
+                if (!planner->getSpecs().multithreaded && NearestNeighborsKDTree<_T>::isSpaceSupported(space) &&
+                    space->getPackedValueCount() <= magic::MAX_KD_TREE_DIMENSION)
+                    return new NearestNeighborsKDTree<_T>(space, stateFn);
+                return getDefaultNearestNeighbors<_T>(planner);
+            }
+
+            /** \brief Construct a batched distance function for nearest neighbor datastructures
+             * that store pointers to motions (any type with a \e state member). The distances
+             * are computed with base::StateSpace::distanceBatch(), which uses the vectorized
+             * kernels of the space, if it has them. */
+            template <typename _T>
+            static typename NearestNeighbors<_T>::BatchDistanceFunction
+            getDefaultBatchDistanceFunction(const base::StateSpacePtr &space)
+            {
+                return [space](const _T &a, const _T *b, std::size_t n, double *dist)
+                {
+                    const std::size_t blockSize = 64;
+                    const base::State *states[blockSize];
+                    for (std::size_t start = 0; start < n; start += blockSize)
+                    {
+                        std::size_t m = std::min(blockSize, n - start);
+                        for (std::size_t i = 0; i < m; ++i)
+                            states[i] = b[start + i]->state;
+                        space->distanceBatch(a->state, states, m, dist + start);
+                    }
+                };
+            }
+
+            /** \brief Construct the functions that let nearest neighbor datastructures storing pointers to
+             * motions (any type with a \e state member) keep the states packed (see base::StateBatch). The
+             * distances are then computed by base::StateSpace::accumulatePackedDistances(). If the space does
+             * not support packing, the returned value has no values per element and is ignored. */
+            template <typename _T>
+            static typename NearestNeighbors<_T>::PackedDistance getDefaultPackedDistance(const base::StateSpacePtr &space)
+            {
+                typename NearestNeighbors<_T>::PackedDistance packedDist;
+                packedDist.valueCount = space->getPackedValueCount();
+                if (packedDist.valueCount == 0)
+                    return packedDist;
+                packedDist.pack = [space](const _T &a, double *values, std::size_t stride)
+                {
+                    space->packState(a->state, values, stride);
+                };
+                packedDist.distances = [space](const _T &a, const double *values, std::size_t stride, std::size_t n,
+                                               double *dist)
+                {
+                    std::fill(dist, dist + n, 0.0);
+                    space->accumulatePackedDistances(a->state, values, stride, n, 1.0, dist);
+                };
+                return packedDist;
+            }
+
             /** \brief Given a goal specification, decide on a planner for that goal */
             static base::PlannerPtr getDefaultPlanner(const base::GoalPtr &goal);
 
@@ -68,7 +68,16 @@ namespace ompl
         /** \class ompl::geometric::LightningDBPtr
             \brief A shared pointer wrapper for ompl::tools::LightningDB */
 
-        /** \brief Save and load entire paths from file */
+        /** \brief Save and load entire paths from file
+
+            The waypoints of all paths are kept serialized in one contiguous buffer; only the start and goal of
+            each path are kept as states, for the nearest-neighbor index over (start, goal) pairs. PlannerData
+            instances are created only for the paths that are retrieved.
+
+            The database file starts with a header that identifies the state space, followed by one record per
+            path (its number of states and its serialized waypoints). Saving to the file the database was last
+            loaded from or saved to only appends the paths added since. Files written in the previous format (a
+            sequence of PlannerData instances) can still be loaded. */
         class LightningDB
         {
         public:
@@ -107,7 +116,8 @@ namespace ompl
             bool saveIfChanged(const std::string &fileName);
 
             /**
-             * \brief Save loaded database to file
+             * \brief Save loaded database to file. If the file is the one the database was last loaded from or
+             *        saved to, and it was not changed since, only the paths added since are appended to it.
              * \param fileName - name of database file
              * \return true if file saved successfully
              */
@@ -149,24 +159,74 @@ namespace ompl
             /**
              * \brief Add the distance between both path's starts and the distance between both path's ends together
              */
-            double distanceFunction(const ompl::base::PlannerDataPtr &a, const ompl::base::PlannerDataPtr &b) const;
+            double distanceFunction(std::size_t a, std::size_t b) const;
+
+            /** \brief Serialize the states of \e path into the waypoint buffer and add it to the database. Returns
+                false if the path is empty. */
+            bool storePath(const geometric::PathGeometric &path);
+
+            /** \brief Add the path whose \e count serialized states start at \e offset in the waypoint buffer */
+            void addSerializedPath(std::size_t offset, unsigned int count);
+
+            /** \brief Create a PlannerData instance that contains the states of path \e index */
+            ompl::base::PlannerDataPtr getPlannerData(std::size_t index) const;
+
+            /** \brief Load a file in the previous format, a sequence of PlannerData instances */
+            bool loadPlannerDatas(std::istream &in);
+
+            /** \brief Write the header of the database file */
+            void writeHeader(std::ostream &out) const;
+
+            /** \brief Write path \e index to the database file */
+            void writePath(std::ostream &out, std::size_t index) const;
 
         protected:
+            /** \brief The location of a path in the waypoint buffer, and its endpoints */
+            struct Experience
+            {
+                /// The offset of the first waypoint in waypoints_
+                std::size_t offset;
+
+                /// The number of waypoints
+                unsigned int stateCount;
+
+                /// Copies of the first and last waypoint, for the nearest-neighbor index
+                base::State *start;
+                base::State *goal;
+            };
+
             /// The created space information
             base::SpaceInformationPtr si_;
 
-            /// Helper class for storing each plannerData instance
+            /// Helper class for loading PlannerData instances from files in the previous format
             ompl::base::PlannerDataStorage plannerDataStorage_;
 
-            // A nearest-neighbors datastructure containing the tree of start/goal states combined
-            std::shared_ptr<NearestNeighbors<ompl::base::PlannerDataPtr>> nn_;
+            /// The serialized waypoints of all paths, one path after the other
+            std::vector<unsigned char> waypoints_;
 
-            // Reusable plannerData instance for filling in start and goal and performing searches on the tree
-            ompl::base::PlannerDataPtr nnSearchKey_;
+            /// The paths in the database
+            std::vector<Experience> experiences_;
+
+            /// The total number of waypoints
+            std::size_t statesCount_{0};
+
+            // A nearest-neighbors datastructure containing the tree of start/goal states combined, by path index
+            std::shared_ptr<NearestNeighbors<std::size_t>> nn_;
+
+            /// The start and goal of the current query, which has index queryIndex_ in the nearest-neighbors
+            /// datastructure
+            const base::State *queryStart_{nullptr};
+            const base::State *queryGoal_{nullptr};
+            static const std::size_t queryIndex_;
 
             // Track unsaved paths to determine if a save is required
             int numUnsavedPaths_{0};
 
+            /// The file the database was last loaded from or saved to, the number of paths it contains and its size
+            std::string savedFile_;
+            std::size_t savedPaths_{0};
+            std::uintmax_t savedSize_{0};
+
         };  // end of class LightningDB
 
     }  // end of namespace
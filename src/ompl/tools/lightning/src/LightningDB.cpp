@@ -44,27 +44,54 @@
 // Boost
 #include <boost/filesystem.hpp>
 
+#include <cstring>
+#include <limits>
+
+/// @cond IGNORE
+namespace
+{
+    // Identifies files in the compact format. Files in the previous format start with the number of paths as text.
+    const char FILE_SIGNATURE[8] = {'O', 'M', 'P', 'L', 'L', 'D', 'B', '1'};
+
+    template <typename T>
+    void writeValue(std::ostream &out, T value)
+    {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    bool readValue(std::istream &in, T &value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(value)));
+    }
+}
+/// @endcond
+
+const std::size_t ompl::tools::LightningDB::queryIndex_ = std::numeric_limits<std::size_t>::max();
+
 ompl::tools::LightningDB::LightningDB(const base::StateSpacePtr &space)
 {
     si_ = std::make_shared<base::SpaceInformation>(space);
 
     // Set nearest neighbor type
-    nn_ = std::make_shared<ompl::NearestNeighborsSqrtApprox<ompl::base::PlannerDataPtr>>();
+    nn_ = std::make_shared<ompl::NearestNeighborsSqrtApprox<std::size_t>>();
 
     // Use our custom distance function for nearest neighbor tree
-    nn_->setDistanceFunction([this](const ompl::base::PlannerDataPtr &a, const ompl::base::PlannerDataPtr &b)
+    nn_->setDistanceFunction([this](std::size_t a, std::size_t b)
                              {
                                  return distanceFunction(a, b);
                              });
-
-    // Load the PlannerData instance to be used for searching
-    nnSearchKey_ = std::make_shared<ompl::base::PlannerData>(si_);
 }
 
 ompl::tools::LightningDB::~LightningDB()
 {
     if (numUnsavedPaths_)
         OMPL_WARN("The database is being unloaded with unsaved experiences");
+    for (auto &experience : experiences_)
+    {
+        si_->freeState(experience.start);
+        si_->freeState(experience.goal);
+    }
 }
 
 bool ompl::tools::LightningDB::load(const std::string &fileName)
@@ -89,6 +116,82 @@ bool ompl::tools::LightningDB::load(const std::string &fileName)
     // Open a binary input stream
     std::ifstream iStream(fileName.c_str(), std::ios::binary);
 
+    // Paths can only be appended to the file later if it contains exactly the paths of the database
+    const bool wasEmpty = experiences_.empty();
+    savedFile_.clear();
+
+    char signature[sizeof(FILE_SIGNATURE)];
+    if (!iStream.read(signature, sizeof(signature)) ||
+        std::memcmp(signature, FILE_SIGNATURE, sizeof(FILE_SIGNATURE)) != 0)
+    {
+        iStream.clear();
+        iStream.seekg(0);
+        if (!loadPlannerDatas(iStream))
+            return false;
+    }
+    else
+    {
+        // Check that the file was written for the same state space
+        std::vector<int> spaceSignature, fileSignature;
+        si_->getStateSpace()->computeSignature(spaceSignature);
+        std::uint32_t length = 0, signatureSize = 0;
+        bool good = readValue(iStream, length) && readValue(iStream, signatureSize) &&
+                    signatureSize == spaceSignature.size();
+        fileSignature.resize(good ? signatureSize : 0);
+        for (auto &value : fileSignature)
+        {
+            std::int32_t v = 0;
+            good = good && readValue(iStream, v);
+            value = v;
+        }
+        if (!good || length != si_->getStateSpace()->getSerializationLength() || fileSignature != spaceSignature)
+        {
+            OMPL_ERROR("Database file %s was not saved for this state space", fileName.c_str());
+            return false;
+        }
+
+        // Read one path at a time, straight into the waypoint buffer
+        std::uintmax_t end = iStream.tellg();
+        bool complete = true;
+        while (iStream.peek() != std::char_traits<char>::eof())
+        {
+            std::uint32_t count = 0;
+            const std::size_t offset = waypoints_.size();
+            if (readValue(iStream, count) && count > 0)
+            {
+                waypoints_.resize(offset + (std::size_t)count * length);
+                if (iStream.read(reinterpret_cast<char *>(&waypoints_[offset]), waypoints_.size() - offset))
+                {
+                    addSerializedPath(offset, count);
+                    end = iStream.tellg();
+                    continue;
+                }
+            }
+            // a save was interrupted while this path was written
+            waypoints_.resize(offset);
+            complete = false;
+            break;
+        }
+        if (!complete)
+            OMPL_WARN("Database file %s ends with an incomplete path, which was ignored", fileName.c_str());
+        else if (wasEmpty)
+        {
+            savedFile_ = fileName;
+            savedPaths_ = experiences_.size();
+            savedSize_ = end;
+        }
+    }
+
+    // Close file
+    iStream.close();
+
+    double loadTime = time::seconds(time::now() - start);
+    OMPL_INFORM("Loaded database from file in %f sec with %d paths", loadTime, nn_->size());
+    return true;
+}
+
+bool ompl::tools::LightningDB::loadPlannerDatas(std::istream &iStream)
+{
     // Get the total number of paths saved
     double numPaths = 0;
     iStream >> numPaths;
@@ -104,20 +207,17 @@ bool ompl::tools::LightningDB::load(const std::string &fileName)
     for (std::size_t i = 0; i < numPaths; ++i)
     {
         // Create a new planner data instance
-        auto plannerData(std::make_shared<ompl::base::PlannerData>(si_));
+        ompl::base::PlannerData plannerData(si_);
 
         // Note: the StateStorage class checks if the states match for us
-        plannerDataStorage_.load(iStream, *plannerData.get());
+        plannerDataStorage_.load(iStream, plannerData);
 
-        // Add to nearest neighbor tree
-        nn_->add(plannerData);
+        // Add to the waypoint buffer and nearest neighbor tree
+        geometric::PathGeometric path(si_);
+        for (std::size_t j = 0; j < plannerData.numVertices(); ++j)
+            path.append(plannerData.getVertex(j).getState());
+        storePath(path);
     }
-
-    // Close file
-    iStream.close();
-
-    double loadTime = time::seconds(time::now() - start);
-    OMPL_INFORM("Loaded database from file in %f sec with %d paths", loadTime, nn_->size());
     return true;
 }
 
@@ -133,24 +233,47 @@ void ompl::tools::LightningDB::addPath(ompl::geometric::PathGeometric &solutionP
 
 void ompl::tools::LightningDB::addPathHelper(ompl::geometric::PathGeometric &solutionPath)
 {
-    // Create a new planner data instance
-    auto plannerData(std::make_shared<ompl::base::PlannerData>(si_));
+    if (storePath(solutionPath))
+        numUnsavedPaths_++;
+}
 
-    // Add the states to one nodes files
-    for (auto &i : solutionPath.getStates())
+bool ompl::tools::LightningDB::storePath(const ompl::geometric::PathGeometric &path)
+{
+    if (path.getStateCount() == 0)
     {
-        ompl::base::PlannerDataVertex vert(i);  // TODO tag?
-
-        plannerData->addVertex(vert);
+        OMPL_ERROR("Cannot add an empty path to the database");
+        return false;
     }
 
-    // Deep copy the states in the vertices so that when the planner goes out of scope, all data remains intact
-    plannerData->decoupleFromPlanner();
+    // Serialize the states at the end of the waypoint buffer
+    const base::StateSpacePtr &space = si_->getStateSpace();
+    const std::size_t length = space->getSerializationLength();
+    const std::size_t offset = waypoints_.size();
+    waypoints_.resize(offset + path.getStateCount() * length);
+    for (std::size_t i = 0; i < path.getStateCount(); ++i)
+        space->serialize(&waypoints_[offset + i * length], path.getState(i));
 
-    // Add to nearest neighbor tree
-    nn_->add(plannerData);
+    addSerializedPath(offset, path.getStateCount());
+    return true;
+}
+
+void ompl::tools::LightningDB::addSerializedPath(std::size_t offset, unsigned int count)
+{
+    const base::StateSpacePtr &space = si_->getStateSpace();
+    const std::size_t length = space->getSerializationLength();
+
+    Experience experience;
+    experience.offset = offset;
+    experience.stateCount = count;
+    experience.start = si_->allocState();
+    experience.goal = si_->allocState();
+    space->deserialize(experience.start, &waypoints_[offset]);
+    space->deserialize(experience.goal, &waypoints_[offset + (count - 1) * length]);
+    experiences_.push_back(experience);
+    statesCount_ += count;
 
-    numUnsavedPaths_++;
+    // Add to nearest neighbor tree
+    nn_->add(experiences_.size() - 1);
 }
 
 bool ompl::tools::LightningDB::saveIfChanged(const std::string &fileName)
@@ -174,46 +297,95 @@ bool ompl::tools::LightningDB::save(const std::string &fileName)
     // Save database from file, track saving time
     time::point start = time::now();
 
-    OMPL_INFORM("Saving database to file: %s", fileName.c_str());
+    // Only append the new paths if the file still is the way it was left
+    boost::system::error_code ec;
+    const bool append = fileName == savedFile_ && savedPaths_ <= experiences_.size() &&
+                        boost::filesystem::file_size(fileName, ec) == savedSize_ && !ec;
 
-    // Open a binary output stream
-    std::ofstream outStream(fileName.c_str(), std::ios::binary);
+    OMPL_INFORM("%s database to file: %s", append ? "Appending" : "Saving", fileName.c_str());
 
-    // Convert the NN tree to a vector
-    std::vector<ompl::base::PlannerDataPtr> plannerDatas;
-    nn_->list(plannerDatas);
-
-    // Write the number of paths we will be saving
-    double numPaths = plannerDatas.size();
-    outStream << numPaths;
-
-    // Start saving each planner data object
-    for (std::size_t i = 0; i < numPaths; ++i)
+    // Open a binary output stream
+    std::ofstream outStream(fileName.c_str(), append ? std::ios::binary | std::ios::app : std::ios::binary);
+    if (!append)
     {
-        ompl::base::PlannerData &pd = *plannerDatas[i].get();
-
-        // Save a single planner data
-        plannerDataStorage_.store(pd, outStream);
+        writeHeader(outStream);
+        savedPaths_ = 0;
     }
 
+    // Save every path that is not in the file yet
+    for (std::size_t i = savedPaths_; i < experiences_.size(); ++i)
+        writePath(outStream, i);
+
     // Close file
     outStream.close();
+    if (!outStream)
+    {
+        OMPL_ERROR("Unable to write database file %s", fileName.c_str());
+        savedFile_.clear();
+        return false;
+    }
 
     // Benchmark
     double loadTime = time::seconds(time::now() - start);
-    OMPL_INFORM("Saved database to file in %f sec with %d paths", loadTime, plannerDatas.size());
-
+    OMPL_INFORM("Saved database to file in %f sec with %d paths (%d new)", loadTime, experiences_.size(),
+                experiences_.size() - savedPaths_);
+
+    savedFile_ = fileName;
+    savedPaths_ = experiences_.size();
+    savedSize_ = boost::filesystem::file_size(fileName, ec);
+    if (ec)
+        savedFile_.clear();
     numUnsavedPaths_ = 0;
 
     return true;
 }
 
+void ompl::tools::LightningDB::writeHeader(std::ostream &out) const
+{
+    std::vector<int> signature;
+    si_->getStateSpace()->computeSignature(signature);
+    out.write(FILE_SIGNATURE, sizeof(FILE_SIGNATURE));
+    writeValue<std::uint32_t>(out, si_->getStateSpace()->getSerializationLength());
+    writeValue<std::uint32_t>(out, signature.size());
+    for (int value : signature)
+        writeValue<std::int32_t>(out, value);
+}
+
+void ompl::tools::LightningDB::writePath(std::ostream &out, std::size_t index) const
+{
+    const Experience &experience = experiences_[index];
+    writeValue<std::uint32_t>(out, experience.stateCount);
+    out.write(reinterpret_cast<const char *>(&waypoints_[experience.offset]),
+              (std::size_t)experience.stateCount * si_->getStateSpace()->getSerializationLength());
+}
+
+ompl::base::PlannerDataPtr ompl::tools::LightningDB::getPlannerData(std::size_t index) const
+{
+    const base::StateSpacePtr &space = si_->getStateSpace();
+    const std::size_t length = space->getSerializationLength();
+    const Experience &experience = experiences_[index];
+
+    auto plannerData(std::make_shared<ompl::base::PlannerData>(si_));
+    std::vector<base::State *> states(experience.stateCount);
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+        states[i] = si_->allocState();
+        space->deserialize(states[i], &waypoints_[experience.offset + i * length]);
+        plannerData->addVertex(ompl::base::PlannerDataVertex(states[i]));
+    }
+
+    // Deep copy the states in the vertices so that the PlannerData instance owns them
+    plannerData->decoupleFromPlanner();
+    si_->freeStates(states);
+    return plannerData;
+}
+
 void ompl::tools::LightningDB::getAllPlannerDatas(std::vector<ompl::base::PlannerDataPtr> &plannerDatas) const
 {
     OMPL_DEBUG("LightningDB: getAllPlannerDatas");
 
-    // Convert the NN tree to a vector
-    nn_->list(plannerDatas);
+    for (std::size_t i = 0; i < experiences_.size(); ++i)
+        plannerDatas.push_back(getPlannerData(i));
 
     OMPL_DEBUG("Number of paths found: %d", plannerDatas.size());
 }
@@ -222,57 +394,43 @@ std::vector<ompl::base::PlannerDataPtr> ompl::tools::LightningDB::findNearestSta
                                                                                        const base::State *start,
                                                                                        const base::State *goal)
 {
-    // Fill in our pre-made PlannerData instance with the new start and goal states to be searched for
-    if (nnSearchKey_->numVertices() == 2)
-    {
-        nnSearchKey_->getVertex(0) = ompl::base::PlannerDataVertex(start);
-        nnSearchKey_->getVertex(1) = ompl::base::PlannerDataVertex(goal);
-    }
-    else
-    {
-        nnSearchKey_->addVertex(ompl::base::PlannerDataVertex(start));
-        nnSearchKey_->addVertex(ompl::base::PlannerDataVertex(goal));
-    }
-    assert(nnSearchKey_->numVertices() == 2);
+    // The query is represented by a special index in the nearest neighbor tree
+    queryStart_ = start;
+    queryGoal_ = goal;
 
+    std::vector<std::size_t> nearestIndices;
+    nn_->nearestK(queryIndex_, nearestK, nearestIndices);
+
+    // Only the retrieved paths are converted to PlannerData instances
     std::vector<ompl::base::PlannerDataPtr> nearest;
-    nn_->nearestK(nnSearchKey_, nearestK, nearest);
+    nearest.reserve(nearestIndices.size());
+    for (std::size_t index : nearestIndices)
+        nearest.push_back(getPlannerData(index));
 
     return nearest;
 }
 
-double ompl::tools::LightningDB::distanceFunction(const ompl::base::PlannerDataPtr &a,
-                                                  const ompl::base::PlannerDataPtr &b) const
+double ompl::tools::LightningDB::distanceFunction(std::size_t a, std::size_t b) const
 {
+    const base::State *aStart = a == queryIndex_ ? queryStart_ : experiences_[a].start;
+    const base::State *aGoal = a == queryIndex_ ? queryGoal_ : experiences_[a].goal;
+    const base::State *bStart = b == queryIndex_ ? queryStart_ : experiences_[b].start;
+    const base::State *bGoal = b == queryIndex_ ? queryGoal_ : experiences_[b].goal;
+
     // Bi-directional implementation - check path b from [start, goal] and [goal, start]
     return std::min(
         // [ a.start, b.start] + [a.goal + b.goal]
-        si_->distance(a->getVertex(0).getState(), b->getVertex(0).getState()) +
-            si_->distance(a->getVertex(a->numVertices() - 1).getState(), b->getVertex(b->numVertices() - 1).getState()),
+        si_->distance(aStart, bStart) + si_->distance(aGoal, bGoal),
         // [ a.start, b.goal] + [a.goal + b.start]
-        si_->distance(a->getVertex(0).getState(), b->getVertex(b->numVertices() - 1).getState()) +
-            si_->distance(a->getVertex(a->numVertices() - 1).getState(), b->getVertex(0).getState()));
+        si_->distance(aStart, bGoal) + si_->distance(aGoal, bStart));
 }
 
 std::size_t ompl::tools::LightningDB::getExperiencesCount() const
 {
-    return nn_->size();
+    return experiences_.size();
 }
 
 std::size_t ompl::tools::LightningDB::getStatesCount() const
 {
-    // Loop through every PlannerData and sum the number of states
-    std::size_t statesCount = 0;
-
-    // Convert the NN tree to a vector
-    std::vector<ompl::base::PlannerDataPtr> plannerDatas;
-    nn_->list(plannerDatas);
-
-    // Start saving each planner data object
-    for (auto &plannerData : plannerDatas)
-    {
-        statesCount += plannerData->numVertices();
-    }
-
-    return statesCount;
+    return statesCount_;
 }
@@ -573,6 +573,26 @@ namespace ompl
              */
             void setPlannerData(const base::PlannerData &data);
 
+            /**
+             * \brief Copy the sparse graph and the parameters of another roadmap into this one, which must be set up.
+             * The first call copies the whole graph into an empty roadmap. Later calls with the same roadmap only
+             * copy the guards and edges it has gained since, so \e other must only have grown in between. The lazy
+             * collision checking state of the copied edges is copied too.
+             * \param other - the roadmap to copy
+             * \return false, without changing this roadmap, if it is not empty and was not copied from \e other,
+             * or if \e other was cleared, loaded a graph or lost guards or edges since. A new roadmap has to take
+             * a full copy then.
+             */
+            bool copyRoadmap(const SPARSdb &other);
+
+            /**
+             * \brief Take the lazy collision checking state of the edges that are unchecked in this roadmap from
+             * another copy of the same roadmap (see copyRoadmap()). Nothing is done if \e other is not a copy of
+             * the same roadmap.
+             * \param other - the other copy
+             */
+            void copyEdgeCollisionStates(const SPARSdb &other);
+
             /** \brief Returns whether we have reached the iteration failures limit, maxFailures_ */
             bool reachedFailureLimit() const;
 
@@ -781,6 +801,22 @@ namespace ompl
 
             /** \brief Option to enable debugging output */
             bool verbose_{false};
+
+            /** \brief Changes whenever the graph is cleared or a graph is loaded into it, which makes copies of
+             * this roadmap take a full copy again */
+            std::size_t generation_;
+
+            /** \brief The roadmap this one is a copy of (see copyRoadmap()) */
+            const SPARSdb *copySource_{nullptr};
+
+            /** \brief The generation of copySource_ the guards and edges were copied from */
+            std::size_t copyGeneration_{0u};
+
+            /** \brief The vertex of this roadmap for each vertex of copySource_ copied so far */
+            std::vector<Vertex> copiedVertices_;
+
+            /** \brief The number of edges of copySource_ copied so far */
+            std::size_t copiedEdges_{0u};
         };
     }
 }
@@ -46,6 +46,12 @@
 #include <ompl/base/SpaceInformation.h>
 #include <ompl/datastructures/NearestNeighbors.h>
 #include <ompl/tools/thunder/SPARSdb.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace ompl
 {
@@ -66,7 +72,19 @@ namespace ompl
         /** \class ompl::geometric::ThunderDBPtr
             \brief A shared pointer wrapper for ompl::tools::ThunderDB */
 
-        /** \brief Save and load entire paths from file */
+        /** \brief Save and load entire paths from file
+
+            Paths are inserted into the SPARSdb roadmap (see getSPARSdb()), either synchronously by addPath() or
+            by a background thread with addPathAsync(). Queries do not use that roadmap directly: after each
+            insertion, a copy of the roadmap is published as a new epoch and findNearestStartGoal() runs on the
+            latest published copy, so queries never wait for an insertion to finish. Two copies are kept: the one
+            published before the current one is brought up to date with only the guards and edges added since, and
+            published again, unless a query still uses it. The lazy collision checking results are carried over
+            from the current copy.
+
+            Queries on the same copy are serialized by its queryLock, since the lazy collision checking of SPARSdb
+            updates the roadmap. Queries only run concurrently when they use copies of different epochs, e.g., one
+            that started before a publication and one that started after it. */
         class ThunderDB
         {
         public:
@@ -94,6 +112,24 @@ namespace ompl
              */
             bool addPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime);
 
+            /**
+             * \brief Queue a solution path for insertion into the database by a background thread. Queries keep
+             *        using the current roadmap until the insertion is done. As with addPath(), the experience is not
+             *        saved to file until save() is called
+             * \param solutionPath - the path to insert
+             */
+            void addPathAsync(const ompl::geometric::PathGeometric &solutionPath);
+
+            /** \brief Wait until all the paths queued by addPathAsync() have been inserted */
+            void waitForPendingPaths();
+
+            /** \brief Get the number of paths queued by addPathAsync() that have not been inserted yet */
+            std::size_t getNumPendingPaths() const;
+
+            /** \brief Get the epoch of the roadmap that queries use. It is incremented each time a roadmap that
+                includes new experience is published. */
+            std::uint64_t getEpoch() const;
+
             /**
              * \brief Save loaded database to file, except skips saving if no paths have been added
              * \param fileName - name of database file
@@ -116,7 +152,8 @@ namespace ompl
             /** \brief Create the database structure for saving experiences */
             void setSPARSdb(ompl::tools::SPARSdbPtr &prm);
 
-            /** \brief Hook for debugging */
+            /** \brief Hook for debugging. This is the roadmap paths are inserted into, so it should not be used
+                while paths queued by addPathAsync() are pending. */
             ompl::tools::SPARSdbPtr &getSPARSdb();
 
             /** \brief Find the k nearest paths to our queries one */
@@ -150,12 +187,34 @@ namespace ompl
              * \brief Check if anything has been loaded into DB
              * \return true if has no nodes
              */
-            bool isEmpty()
-            {
-                return spars_->getNumVertices() == 0u;
-            }
+            bool isEmpty();
 
         protected:
+            /** \brief A copy of the roadmap that queries run on */
+            struct Snapshot
+            {
+                /** \brief The copy of the roadmap */
+                SPARSdbPtr spars;
+
+                /** \brief The epoch the copy was published at */
+                std::uint64_t epoch;
+
+                /** \brief Lock for the queries, which update the collision state of the edges */
+                std::mutex queryLock;
+            };
+
+            /** \brief Insert a path into spars_. The copy used by queries is not updated. */
+            bool insertPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime);
+
+            /** \brief Publish an up to date copy of spars_ for queries. writeLock_ must be held. */
+            void publishSnapshot();
+
+            /** \brief Get the last published copy of the roadmap, if any */
+            std::shared_ptr<Snapshot> getSnapshot() const;
+
+            /** \brief Insert the paths queued by addPathAsync(), until the database is destroyed */
+            void ingestPaths();
+
             /// The created space information
             base::SpaceInformationPtr si_;  // TODO: is this even necessary?
 
@@ -163,7 +222,7 @@ namespace ompl
             ompl::base::PlannerDataStorage plannerDataStorage_;
 
             // Track unsaved paths to determine if a save is required
-            int numPathsInserted_;
+            std::atomic<int> numPathsInserted_;
 
             // Use SPARSdb's graph datastructure to store experience
             ompl::tools::SPARSdbPtr spars_;
@@ -171,6 +230,39 @@ namespace ompl
             // Allow the database to save to file (new experiences)
             bool saving_enabled_;
 
+            /// Lock for changes to spars_
+            mutable std::mutex writeLock_;
+
+            /// The last published copy of the roadmap
+            std::shared_ptr<Snapshot> snapshot_;
+
+            /// Lock for snapshot_, which is only held to copy or replace the pointer
+            mutable std::mutex snapshotLock_;
+
+            /// The copy published before snapshot_, which is reused for the next epoch once no query holds it
+            std::shared_ptr<Snapshot> retired_;
+
+            /// The number of published copies of the roadmap
+            std::uint64_t epoch_{0};
+
+            /// Paths waiting to be inserted by the background thread
+            std::deque<ompl::geometric::PathGeometric> pendingPaths_;
+
+            /// The number of paths queued by addPathAsync() and not inserted yet
+            std::size_t numPendingPaths_{0};
+
+            /// Lock for pendingPaths_, numPendingPaths_ and stopIngestion_
+            mutable std::mutex pendingLock_;
+
+            /// Signals new paths to the background thread and finished insertions to waitForPendingPaths()
+            std::condition_variable pendingCondition_;
+
+            /// Set when the background thread should stop
+            bool stopIngestion_{false};
+
+            /// The background thread that inserts paths, started by the first call to addPathAsync()
+            std::thread ingestionThread_;
+
         };  // end of class ThunderDB
 
     }  // end of namespace
@@ -44,6 +44,9 @@
 #include <boost/graph/astar_search.hpp>
 #include <boost/graph/incremental_components.hpp>
 #include <boost/property_map/vector_property_map.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <random>
 
 // Allow hooks for visualizing planner
@@ -96,6 +99,17 @@ void ompl::geometric::SPARSdb::CustomVisitor::examine_vertex(Vertex u, const Gra
 
 // SPARSdb methods ////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Generations are unique across all roadmaps, so a roadmap allocated where a deleted one was is not taken
+    // for it either
+    std::size_t nextGeneration()
+    {
+        static std::atomic<std::size_t> generations{0u};
+        return ++generations;
+    }
+}
+
 ompl::geometric::SPARSdb::SPARSdb(const base::SpaceInformationPtr &si)
   : base::Planner(si, "SPARSdb")
   // Numeric variables
@@ -109,6 +123,7 @@ ompl::geometric::SPARSdb::SPARSdb(const base::SpaceInformationPtr &si)
   , interfaceDataProperty_(boost::get(vertex_interface_data_t(), g_))
   // Disjoint set accessors
   , disjointSets_(boost::get(boost::vertex_rank, g_), boost::get(boost::vertex_predecessor, g_))
+  , generation_(nextGeneration())
 {
     specs_.recognizedGoal = base::GOAL_SAMPLEABLE_REGION;
     specs_.approximateSolutions = false;
@@ -186,6 +201,10 @@ void ompl::geometric::SPARSdb::freeMemory()
         stateProperty_[v] = nullptr;
     }
     g_.clear();
+    generation_ = nextGeneration();
+    copySource_ = nullptr;
+    copiedVertices_.clear();
+    copiedEdges_ = 0;
 
     if (nn_)
         nn_->clear();
@@ -1772,6 +1791,9 @@ void ompl::geometric::SPARSdb::setPlannerData(const base::PlannerData &data)
     // Check that the query vertex is initialized (used for internal nearest neighbor searches)
     checkQueryStateInitialization();
 
+    // Copies of this roadmap take the whole loaded graph again
+    generation_ = nextGeneration();
+
     // Add all vertices
     if (verbose_)
     {
@@ -1832,6 +1854,78 @@ void ompl::geometric::SPARSdb::setPlannerData(const base::PlannerData &data)
     verbose_ = wasVerbose;
 }
 
+bool ompl::geometric::SPARSdb::copyRoadmap(const SPARSdb &other)
+{
+    // Check that the query vertex is initialized (used for internal nearest neighbor searches)
+    checkQueryStateInitialization();
+
+    const std::size_t numVertices = boost::num_vertices(other.g_);
+    const std::size_t numEdges = boost::num_edges(other.g_);
+    if (copySource_ != &other)
+    {
+        // Only an empty roadmap (holding just the query vertex) can start copying another one
+        if (boost::num_vertices(g_) > 1 || boost::num_edges(g_) > 0)
+            return false;
+        copySource_ = &other;
+        copyGeneration_ = other.generation_;
+        copiedVertices_.clear();
+        copiedEdges_ = 0;
+    }
+    // The guards and edges copied so far are only a prefix of the other roadmap if it was not cleared or reloaded
+    else if (copyGeneration_ != other.generation_ || numVertices < copiedVertices_.size() ||
+             numEdges < copiedEdges_)
+        return false;
+
+    stretchFactor_ = other.stretchFactor_;
+    sparseDeltaFraction_ = other.sparseDeltaFraction_;
+    denseDeltaFraction_ = other.denseDeltaFraction_;
+    maxFailures_ = other.maxFailures_;
+    sparseDelta_ = other.sparseDelta_;
+    denseDelta_ = other.denseDelta_;
+
+    // Temp disable verbose mode for copying the roadmap
+    bool wasVerbose = verbose_;
+    verbose_ = false;
+
+    // Add the new guards, except for the query vertex of the other roadmap, which has no state. Vertices are
+    // stored in a vector, so the new ones come last.
+    const std::size_t firstVertex = copiedVertices_.size();
+    copiedVertices_.resize(numVertices, queryVertex_);
+    for (std::size_t v = firstVertex; v < numVertices; ++v)
+        if (other.stateProperty_[v] != nullptr)
+            copiedVertices_[v] = addGuard(si_->cloneState(other.stateProperty_[v]), other.colorProperty_[v]);
+
+    // The edges of an undirected graph are listed in the order they were added, so the new ones come last too,
+    // both in the other roadmap and in this one
+    const std::size_t firstEdge = boost::num_edges(g_);
+    auto otherEdges = boost::edges(other.g_);
+    for (auto it = std::next(otherEdges.first, copiedEdges_); it != otherEdges.second; ++it)
+        connectGuards(copiedVertices_[boost::source(*it, other.g_)], copiedVertices_[boost::target(*it, other.g_)]);
+    auto edges = boost::edges(g_);
+    for (auto it = std::next(edges.first, firstEdge), otherIt = std::next(otherEdges.first, copiedEdges_);
+         it != edges.second; ++it, ++otherIt)
+        edgeCollisionStateProperty_[*it] = other.edgeCollisionStateProperty_[*otherIt];
+    copiedEdges_ = numEdges;
+
+    // Re-enable verbose mode, if necessary
+    verbose_ = wasVerbose;
+    return true;
+}
+
+void ompl::geometric::SPARSdb::copyEdgeCollisionStates(const SPARSdb &other)
+{
+    if (copySource_ == nullptr || other.copySource_ != copySource_ || other.copyGeneration_ != copyGeneration_)
+        return;
+
+    // Both roadmaps added the edges of copySource_ in the same order, so the edges they have in common are paired
+    // up by walking the two edge lists together
+    auto edges = boost::edges(g_);
+    auto otherEdges = boost::edges(other.g_);
+    for (std::size_t i = 0; i < std::min(copiedEdges_, other.copiedEdges_); ++i, ++edges.first, ++otherEdges.first)
+        if (edgeCollisionStateProperty_[*edges.first] == NOT_CHECKED)
+            edgeCollisionStateProperty_[*edges.first] = other.edgeCollisionStateProperty_[*otherEdges.first];
+}
+
 void ompl::geometric::SPARSdb::clearEdgeCollisionStates()
 {
     foreach (const Edge e, boost::edges(g_))
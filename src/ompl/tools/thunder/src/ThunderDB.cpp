@@ -53,6 +53,15 @@ ompl::tools::ThunderDB::ThunderDB(const base::StateSpacePtr &space) : numPathsIn
 
 ompl::tools::ThunderDB::~ThunderDB()
 {
+    // Stop the background thread once it has inserted the pending paths
+    {
+        std::lock_guard<std::mutex> _(pendingLock_);
+        stopIngestion_ = true;
+    }
+    pendingCondition_.notify_all();
+    if (ingestionThread_.joinable())
+        ingestionThread_.join();
+
     if (numPathsInserted_)
         OMPL_WARN("The database is being unloaded with unsaved experiences");
 }
@@ -113,10 +122,15 @@ bool ompl::tools::ThunderDB::load(const std::string &fileName)
 
     // Add to SPARSdb
     OMPL_INFORM("Adding plannerData to SPARSdb:");
-    spars_->setPlannerData(*plannerData);
+    {
+        std::lock_guard<std::mutex> _(writeLock_);
+        spars_->setPlannerData(*plannerData);
 
-    // Output the number of connected components
-    OMPL_INFORM("  %d connected components", spars_->getNumConnectedComponents());
+        // Output the number of connected components
+        OMPL_INFORM("  %d connected components", spars_->getNumConnectedComponents());
+
+        publishSnapshot();
+    }
 
     // Close file
     iStream.close();
@@ -127,6 +141,95 @@ bool ompl::tools::ThunderDB::load(const std::string &fileName)
 }
 
 bool ompl::tools::ThunderDB::addPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime)
+{
+    bool result = insertPath(solutionPath, insertionTime);
+
+    // Make the new experience available to queries
+    if (spars_ && saving_enabled_)
+    {
+        std::lock_guard<std::mutex> _(writeLock_);
+        publishSnapshot();
+    }
+    return result;
+}
+
+void ompl::tools::ThunderDB::addPathAsync(const ompl::geometric::PathGeometric &solutionPath)
+{
+    {
+        std::lock_guard<std::mutex> _(pendingLock_);
+        pendingPaths_.push_back(solutionPath);
+        ++numPendingPaths_;
+        if (!ingestionThread_.joinable())
+            ingestionThread_ = std::thread([this]
+                                           {
+                                               ingestPaths();
+                                           });
+    }
+    pendingCondition_.notify_all();
+}
+
+void ompl::tools::ThunderDB::waitForPendingPaths()
+{
+    std::unique_lock<std::mutex> lock(pendingLock_);
+    pendingCondition_.wait(lock, [this]
+                           {
+                               return numPendingPaths_ == 0;
+                           });
+}
+
+std::size_t ompl::tools::ThunderDB::getNumPendingPaths() const
+{
+    std::lock_guard<std::mutex> _(pendingLock_);
+    return numPendingPaths_;
+}
+
+std::uint64_t ompl::tools::ThunderDB::getEpoch() const
+{
+    std::shared_ptr<Snapshot> snapshot = getSnapshot();
+    return snapshot ? snapshot->epoch : 0;
+}
+
+void ompl::tools::ThunderDB::ingestPaths()
+{
+    std::size_t inserted = 0;
+    std::unique_lock<std::mutex> lock(pendingLock_);
+    while (true)
+    {
+        pendingCondition_.wait(lock, [this]
+                               {
+                                   return stopIngestion_ || !pendingPaths_.empty();
+                               });
+        if (pendingPaths_.empty())
+            break;
+
+        ompl::geometric::PathGeometric solutionPath(pendingPaths_.front());
+        pendingPaths_.pop_front();
+        lock.unlock();
+
+        double insertionTime;
+        insertPath(solutionPath, insertionTime);
+        OMPL_INFORM("ThunderDB: Inserted queued experience path in %f seconds", insertionTime);
+        ++inserted;
+
+        lock.lock();
+        // Publish the roadmap once the queue is drained, rather than after every path
+        if (pendingPaths_.empty())
+        {
+            lock.unlock();
+            if (spars_ && saving_enabled_)
+            {
+                std::lock_guard<std::mutex> _(writeLock_);
+                publishSnapshot();
+            }
+            lock.lock();
+            numPendingPaths_ -= inserted;
+            inserted = 0;
+            pendingCondition_.notify_all();
+        }
+    }
+}
+
+bool ompl::tools::ThunderDB::insertPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime)
 {
     // Error check
     if (!spars_)
@@ -150,15 +253,15 @@ bool ompl::tools::ThunderDB::addPath(ompl::geometric::PathGeometric &solutionPat
     // Benchmark runtime
     time::point startTime = time::now();
     {
+        std::lock_guard<std::mutex> _(writeLock_);
         result = spars_->addPathToRoadmap(ptc, solutionPath);
+        OMPL_INFORM("SPARSdb now has %d states", spars_->getNumVertices());
+
+        // Record this new addition
+        numPathsInserted_++;
     }
     insertionTime = time::seconds(time::now() - startTime);
 
-    OMPL_INFORM("SPARSdb now has %d states", spars_->getNumVertices());
-
-    // Record this new addition
-    numPathsInserted_++;
-
     return result;
 }
 
@@ -205,6 +308,7 @@ bool ompl::tools::ThunderDB::save(const std::string &fileName)
 
     // TODO: make this more than 1 planner data perhaps
     auto data(std::make_shared<base::PlannerData>(si_));
+    std::unique_lock<std::mutex> lock(writeLock_);
     spars_->getPlannerData(*data);
     OMPL_INFORM("Get planner data from SPARS2 with \n  %d vertices\n  %d edges\n  %d start states\n  %d goal states",
                 data->numVertices(), data->numEdges(), data->numStartVertices(), data->numGoalVertices());
@@ -247,6 +351,57 @@ bool ompl::tools::ThunderDB::save(const std::string &fileName)
     return true;
 }
 
+void ompl::tools::ThunderDB::publishSnapshot()
+{
+    // Reuse the retired copy if no query holds it anymore: it is no longer published, so nobody can take it again,
+    // and it only needs the guards and edges added since it was published
+    std::shared_ptr<Snapshot> snapshot;
+    if (retired_ && retired_.use_count() == 1 && retired_->spars->copyRoadmap(*spars_))
+        snapshot = retired_;
+    else
+    {
+        snapshot = std::make_shared<Snapshot>();
+        snapshot->spars = std::make_shared<ompl::geometric::SPARSdb>(spars_->getSpaceInformation());
+        if (spars_->getProblemDefinition())
+            snapshot->spars->setProblemDefinition(spars_->getProblemDefinition());
+        snapshot->spars->setup();
+        snapshot->spars->copyRoadmap(*spars_);
+    }
+    retired_.reset();
+    snapshot->epoch = ++epoch_;
+
+    // Keep what the queries on the current copy found out about the edges
+    std::shared_ptr<Snapshot> current = getSnapshot();
+    if (current)
+    {
+        std::lock_guard<std::mutex> _(current->queryLock);
+        snapshot->spars->copyEdgeCollisionStates(*current->spars);
+    }
+
+    {
+        std::lock_guard<std::mutex> _(snapshotLock_);
+        snapshot_ = snapshot;
+    }
+    retired_ = std::move(current);
+}
+
+std::shared_ptr<ompl::tools::ThunderDB::Snapshot> ompl::tools::ThunderDB::getSnapshot() const
+{
+    std::lock_guard<std::mutex> _(snapshotLock_);
+    return snapshot_;
+}
+
+bool ompl::tools::ThunderDB::isEmpty()
+{
+    std::shared_ptr<Snapshot> snapshot = getSnapshot();
+    if (snapshot)
+        return snapshot->spars->getNumVertices() == 0u;
+
+    // Nothing was published yet. The roadmap is empty for queries while its first path is being inserted.
+    std::unique_lock<std::mutex> lock(writeLock_, std::try_to_lock);
+    return !lock.owns_lock() || spars_->getNumVertices() == 0u;
+}
+
 void ompl::tools::ThunderDB::setSPARSdb(ompl::tools::SPARSdbPtr &prm)
 {
     // OMPL_INFORM("-------------------------------------------------------");
@@ -269,7 +424,10 @@ void ompl::tools::ThunderDB::getAllPlannerDatas(std::vector<ompl::base::PlannerD
     }
 
     auto data(std::make_shared<base::PlannerData>(si_));
-    spars_->getPlannerData(*data);
+    {
+        std::lock_guard<std::mutex> _(writeLock_);
+        spars_->getPlannerData(*data);
+    }
     plannerDatas.push_back(data);
 
     // OMPL_DEBUG("ThunderDB::getAllPlannerDatas: Number of planner databases found: %d", plannerDatas.size());
@@ -279,7 +437,25 @@ bool ompl::tools::ThunderDB::findNearestStartGoal(int nearestK, const base::Stat
                                                   ompl::geometric::SPARSdb::CandidateSolution &candidateSolution,
                                                   const base::PlannerTerminationCondition &ptc)
 {
-    bool result = spars_->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    bool result;
+    std::shared_ptr<Snapshot> snapshot = getSnapshot();
+    if (snapshot)
+    {
+        std::lock_guard<std::mutex> _(snapshot->queryLock);
+        result = snapshot->spars->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    }
+    else
+    {
+        // Nothing was published yet, e.g., because the roadmap was filled directly. Use it unless a path is being
+        // inserted, so that the query does not wait.
+        std::unique_lock<std::mutex> lock(writeLock_, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            OMPL_INFORM("ThunderDB: The first experience path is still being inserted");
+            return false;
+        }
+        result = spars_->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    }
 
     if (!result)
     {
@@ -0,0 +1,155 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_UTIL_PHILOX_
+#define OMPL_UTIL_PHILOX_
+
+#include <array>
+#include <cstdint>
+
+namespace ompl
+{
+    /** \brief The Philox4x32-10 counter-based random number engine.
+
+        Each block of four 32-bit numbers is a keyed bijection (ten rounds of multiplications and xors) of a
+        128-bit counter, so the generator needs no state besides the key and the counter, and any position of
+        the sequence can be reached in constant time. The key and the upper half of the counter are derived from
+        a seed and a 64-bit stream identifier; the lower half of the counter numbers the blocks of the stream.
+        Different (seed, stream) pairs therefore give independent sequences, which is what allows every thread or
+        sampler to get its own stream without coordinating with the others.
+
+        @par J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw, "Parallel random numbers: as easy as 1, 2, 3,"
+        in Proc. Int. Conf. for High Performance Computing, Networking, Storage and Analysis (SC), 2011.
+        DOI: <a href="https://doi.org/10.1145/2063384.2063405">10.1145/2063384.2063405</a>.
+
+        The class satisfies the requirements of a uniform random bit generator, so it can be used with the
+        distributions of the standard library. */
+    class Philox4x32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        /** \brief A block of the output, or the counter it is computed from */
+        using Block = std::array<std::uint32_t, 4>;
+
+        /** \brief A key */
+        using Key = std::array<std::uint32_t, 2>;
+
+        /** \brief Constructor. Start the sequence of \e stream for \e seed. */
+        explicit Philox4x32(std::uint32_t seed = 0, std::uint64_t stream = 0)
+        {
+            this->seed(seed, stream);
+        }
+
+        /** \brief Restart at the beginning of the sequence of \e stream for \e seed */
+        void seed(std::uint32_t seed, std::uint64_t stream = 0)
+        {
+            key_ = {{seed, static_cast<std::uint32_t>(stream)}};
+            counter_ = {{0, 0, static_cast<std::uint32_t>(stream >> 32), 0}};
+            index_ = 4;
+        }
+
+        /** \brief Generate the next number of the sequence */
+        result_type operator()()
+        {
+            if (index_ == 4)
+            {
+                output_ = block(counter_, key_);
+                // the lower 64 bits of the counter number the blocks
+                if (++counter_[0] == 0)
+                    ++counter_[1];
+                index_ = 0;
+            }
+            return output_[index_++];
+        }
+
+        /** \brief Skip the next \e count numbers of the sequence */
+        void discard(unsigned long long count)
+        {
+            const unsigned long long buffered = 4 - index_;
+            if (count <= buffered)
+            {
+                index_ += static_cast<unsigned int>(count);
+                return;
+            }
+            count -= buffered;
+            const std::uint64_t blocks = (static_cast<std::uint64_t>(counter_[1]) << 32 | counter_[0]) + count / 4;
+            counter_[0] = static_cast<std::uint32_t>(blocks);
+            counter_[1] = static_cast<std::uint32_t>(blocks >> 32);
+            index_ = 4;
+            if (count % 4 != 0)
+            {
+                (*this)();
+                index_ = static_cast<unsigned int>(count % 4);
+            }
+        }
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return 0xffffffffu;
+        }
+
+        /** \brief Compute the block of output for \e counter and \e key */
+        static Block block(Block counter, Key key)
+        {
+            for (unsigned int round = 0; round < 10; ++round)
+            {
+                if (round > 0)
+                {
+                    key[0] += 0x9E3779B9u;
+                    key[1] += 0xBB67AE85u;
+                }
+                const std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * counter[0];
+                const std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * counter[2];
+                counter = {{static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0], static_cast<std::uint32_t>(p1),
+                            static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1], static_cast<std::uint32_t>(p0)}};
+            }
+            return counter;
+        }
+
+    private:
+        Key key_;
+        Block counter_;
+        Block output_;
+        unsigned int index_;
+    };
+}
+
+#endif
@@ -44,6 +44,7 @@
 #include <algorithm>
 
 #include "ompl/config.h"
+#include "ompl/util/Philox.h"
 #include "ompl/util/ProlateHyperspheroid.h"
 
 namespace ompl
@@ -53,7 +54,13 @@ namespace ompl
         are not const). However, the constructor is thread safe and
         different instances can be used safely in any number of
         threads. It is also guaranteed that all created instances will
-        have a different random seed. */
+        have a different random seed.
+
+        By default, an instance uses a Mersenne twister whose seed is taken from a global sequence of seeds, so the
+        numbers an instance produces depend on the order in which instances are created. Instances that are
+        created with a stream identifier instead use a counter-based generator (Philox4x32) keyed by (seed,
+        stream). Their numbers only depend on the seed and the stream, not on when or in which thread the
+        instance was created, and creating them does not touch the global sequence of seeds. */
     class RNG
     {
     public:
@@ -63,12 +70,26 @@ namespace ompl
         /** \brief Constructor. Set to the specified instance seed. */
         RNG(std::uint_fast32_t localSeed);
 
+        /** \brief Constructor. Use the counter-based generator for stream \e stream of seed \e localSeed.
+            For example, RNG(RNG::getSeed(), id) gives thread \e id the same numbers in every execution that
+            uses the same global seed. */
+        RNG(std::uint_fast32_t localSeed, std::uint64_t stream);
+
+        /** \brief Copy the state of \e other. The copy continues with the same numbers as \e other. */
+        RNG(const RNG &other);
+
+        RNG &operator=(const RNG &other);
+
         /** \brief Generate a random real between 0 and 1 */
         double uniform01()
         {
             return uniDist_(generator_);
         }
 
+        /** \brief Fill \e values with \e count random reals between 0 and 1. The numbers are the same as the
+            ones of \e count calls to uniform01(), but the generator is only selected once for all of them. */
+        void uniform01(double values[], std::size_t count);
+
         /** \brief Generate a random real within given bounds: [\e lower_bound, \e upper_bound) */
         double uniformReal(double lower_bound, double upper_bound)
         {
@@ -95,6 +116,11 @@ namespace ompl
             return normalDist_(generator_);
         }
 
+        /** \brief Fill \e values with \e count random reals from a normal distribution with mean 0 and
+            variance 1. The numbers are the same as the ones of \e count calls to gaussian01(), but the generator is only
+            selected once for all of them. */
+        void gaussian01(double values[], std::size_t count);
+
         /** \brief Generate a random real using a normal distribution with given mean and variance */
         double gaussian(double mean, double stddev)
         {
@@ -131,6 +157,13 @@ namespace ompl
             (repeatable) behaviour across multiple instances of RNG. Useful for debugging. */
         static std::uint_fast32_t getSeed();
 
+        /** \brief Restart the sequence of seeds given to new RNG instances from \e seed, even if some have been
+            generated already. Existing instances are not changed. The instances created afterwards, such as the
+            samplers a planner allocates when it is solving, get the same seeds in any process, which lets
+            tools::Benchmark give such instances the same seeds in every run with any number of processes. The value
+            returned by getSeed() is not changed. */
+        static void restartSeedSequence(std::uint_fast32_t seed);
+
         /** \brief Set the seed used for the instance of a RNG. Use this function to ensure that an instance of
             an RNG generates the same deterministic sequence of numbers. This function resets the member generators*/
         void setLocalSeed(std::uint_fast32_t localSeed);
@@ -144,6 +177,22 @@ namespace ompl
             return localSeed_;
         }
 
+        /** \brief Switch this instance to the counter-based generator, at the start of stream \e stream of seed
+            \e localSeed. Like setLocalSeed(), this resets the member generators. */
+        void setLocalStream(std::uint_fast32_t localSeed, std::uint64_t stream);
+
+        /** \brief Check whether this instance uses the counter-based generator */
+        bool isCounterBased() const
+        {
+            return generator_.counterBased;
+        }
+
+        /** \brief Get the stream of the counter-based generator (0 if it is not used) */
+        std::uint64_t getLocalStream() const
+        {
+            return stream_;
+        }
+
         /** \brief Uniform random sampling of a unit-length vector. I.e., the surface of an n-ball. The return variable
          * \e value is expected to already exist. */
         void uniformNormalVector(std::vector<double> &v);
@@ -186,9 +235,44 @@ namespace ompl
          * dimension. */
         class SphericalData;
 
+        /** \brief Restart the generator from \e seed and reset the distributions */
+        void seedGenerator(std::uint_fast32_t seed);
+
+        /** \brief The generator of an instance: either a Mersenne twister or a counter-based generator. Both
+            produce 32-bit numbers, so the distributions draw from them in the same way. */
+        struct Generator
+        {
+            using result_type = std::mt19937::result_type;
+
+            Generator(std::uint_fast32_t seed) : twister(seed)
+            {
+            }
+
+            result_type operator()()
+            {
+                return counterBased ? philox() : twister();
+            }
+
+            static constexpr result_type min()
+            {
+                return 0;
+            }
+
+            static constexpr result_type max()
+            {
+                return 0xffffffffu;
+            }
+
+            bool counterBased{false};
+            std::mt19937 twister;
+            Philox4x32 philox;
+        };
+
         /** \brief The seed used for the instance of a RNG */
         std::uint_fast32_t localSeed_;
-        std::mt19937 generator_;
+        /** \brief The stream of the counter-based generator */
+        std::uint64_t stream_{0};
+        Generator generator_;
         std::uniform_real_distribution<> uniDist_{0, 1};
         std::normal_distribution<> normalDist_{0, 1};
         // A structure holding boost::uniform_on_sphere distributions and the associated boost::variate_generators for
@@ -0,0 +1,113 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#ifndef OMPL_UTIL_THREAD_POOL_
+#define OMPL_UTIL_THREAD_POOL_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief A fixed set of worker threads that execute queued tasks.
+
+        Planners that parallelize parts of their computation (e.g., checking
+        many motions for validity) can keep an instance of this class for their
+        lifetime instead of starting new threads for every batch of work.
+
+        A process forked while pools exist (e.g., by tools::Benchmark) starts
+        new worker threads for them in the child, as the threads themselves
+        are not copied by fork(). Queued tasks are executed in both processes,
+        while tasks that were being executed when fork() was called are not
+        executed in the child. */
+    class ThreadPool
+    {
+    public:
+        /** \brief Start \e threadCount worker threads */
+        explicit ThreadPool(unsigned int threadCount);
+
+        /** \brief Wait for the queued tasks to finish and stop the worker threads */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /** \brief Get the number of worker threads */
+        unsigned int getThreadCount() const
+        {
+            return threads_.size();
+        }
+
+        /** \brief Queue \e task for execution by one of the worker threads */
+        void post(std::function<void()> task);
+
+        /** \brief Call \e body(i) for every \e i in [0, \e count). The calls are distributed
+            over the worker threads and the calling thread, and this function returns once
+            all of them are done. If some call throws, the first exception is rethrown
+            after the remaining calls complete. This function may be called from within a
+            task executed by the pool. */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)> &body);
+
+        /** \brief Return a reasonable number of threads for parallel work on this machine
+            (at least 1) */
+        static unsigned int getDefaultThreadCount();
+
+    private:
+        /** \brief The loop executed by each worker thread */
+        void worker();
+
+        /** \brief Start \e threadCount worker threads */
+        void start(unsigned int threadCount);
+
+        /** \brief Handlers for fork(), which lock the pools before it and start their threads again in the
+            child */
+        static void prepareFork();
+        static void parentAfterFork();
+        static void childAfterFork();
+
+        std::vector<std::thread> threads_;
+        std::deque<std::function<void()>> tasks_;
+        std::mutex lock_;
+        std::condition_variable cond_;
+        bool stop_{false};
+    };
+}
+
+#endif
@@ -97,6 +97,15 @@ namespace
             sGen_.seed(seed);
         }
 
+        void restart(std::uint_fast32_t seed)
+        {
+            std::lock_guard<std::mutex> slock(rngMutex_);
+            if (seed == 0)
+                seed = 1;
+            // getSeed() keeps reporting the seed the sequence was first started from
+            sGen_.seed(seed);
+        }
+
         std::uint_fast32_t nextSeed()
         {
             std::lock_guard<std::mutex> slock(rngMutex_);
@@ -139,10 +148,10 @@ public:
     using spherical_dist_t = boost::uniform_on_sphere<double, container_type_t>;
 
     /** \brief The resulting variate generator type. */
-    using variate_generator_t = boost::variate_generator<std::mt19937 *, spherical_dist_t>;
+    using variate_generator_t = boost::variate_generator<Generator *, spherical_dist_t>;
 
     /** \brief Constructor */
-    SphericalData(std::mt19937 *generatorPtr) : generatorPtr_(generatorPtr){};
+    SphericalData(Generator *generatorPtr) : generatorPtr_(generatorPtr){};
 
     /** \brief The generator for a specified dimension. Will create if not existent */
     container_type_t generate(unsigned int dim)
@@ -177,7 +186,7 @@ private:
     std::vector<dist_gen_pair_t> dimVector_;
 
     /** \brief A pointer to the generator owned by the outer class. Needed for creating new variate_generators */
-    std::mt19937 *generatorPtr_;
+    Generator *generatorPtr_;
 
     /** \brief Grow the vector until it contains an (empty) entry for the specified dimension. */
     void growVector(unsigned int dim)
@@ -215,6 +224,11 @@ void ompl::RNG::setSeed(std::uint_fast32_t seed)
     getRNGSeedGenerator().setSeed(seed);
 }
 
+void ompl::RNG::restartSeedSequence(std::uint_fast32_t seed)
+{
+    getRNGSeedGenerator().restart(seed);
+}
+
 ompl::RNG::RNG()
   : localSeed_(getRNGSeedGenerator().nextSeed())
   , generator_(localSeed_)
@@ -227,13 +241,54 @@ ompl::RNG::RNG(std::uint_fast32_t localSeed)
 {
 }
 
+ompl::RNG::RNG(std::uint_fast32_t localSeed, std::uint64_t stream)
+  : localSeed_(localSeed)
+  , stream_(stream)
+  , generator_(localSeed_)
+  , sphericalDataPtr_(std::make_shared<SphericalData>(&generator_))
+{
+    generator_.counterBased = true;
+    generator_.philox.seed(static_cast<std::uint32_t>(localSeed_), stream_);
+}
+
+ompl::RNG::RNG(const RNG &other)
+  : localSeed_(other.localSeed_)
+  , stream_(other.stream_)
+  , generator_(other.generator_)
+  , uniDist_(other.uniDist_)
+  , normalDist_(other.normalDist_)
+  , sphericalDataPtr_(std::make_shared<SphericalData>(&generator_))
+{
+}
+
+ompl::RNG &ompl::RNG::operator=(const RNG &other)
+{
+    if (this != &other)
+    {
+        localSeed_ = other.localSeed_;
+        stream_ = other.stream_;
+        generator_ = other.generator_;
+        uniDist_ = other.uniDist_;
+        normalDist_ = other.normalDist_;
+        sphericalDataPtr_->reset();
+    }
+    return *this;
+}
+
 void ompl::RNG::setLocalSeed(std::uint_fast32_t localSeed)
 {
     // Store the seed
     localSeed_ = localSeed;
+    seedGenerator(localSeed_);
+}
 
+void ompl::RNG::seedGenerator(std::uint_fast32_t seed)
+{
     // Change the generator's seed
-    generator_.seed(localSeed_);
+    if (generator_.counterBased)
+        generator_.philox.seed(static_cast<std::uint32_t>(seed), stream_);
+    else
+        generator_.twister.seed(seed);
 
     // Reset the distributions used by the variate generators, as they can cache values
     uniDist_.reset();
@@ -241,6 +296,39 @@ void ompl::RNG::setLocalSeed(std::uint_fast32_t localSeed)
     sphericalDataPtr_->reset();
 }
 
+void ompl::RNG::setLocalStream(std::uint_fast32_t localSeed, std::uint64_t stream)
+{
+    stream_ = stream;
+    generator_.counterBased = true;
+    setLocalSeed(localSeed);
+}
+
+namespace
+{
+    /// Fill \e values from a distribution, drawing from one of the engines of the generator only, so the choice of
+    /// engine is made once for the whole array rather than for every 32-bit number
+    template <typename Distribution, typename Generator>
+    void fill(Distribution &dist, Generator &generator, double values[], std::size_t count)
+    {
+        if (generator.counterBased)
+            for (std::size_t i = 0; i < count; ++i)
+                values[i] = dist(generator.philox);
+        else
+            for (std::size_t i = 0; i < count; ++i)
+                values[i] = dist(generator.twister);
+    }
+}
+
+void ompl::RNG::uniform01(double values[], std::size_t count)
+{
+    fill(uniDist_, generator_, values, count);
+}
+
+void ompl::RNG::gaussian01(double values[], std::size_t count)
+{
+    fill(normalDist_, generator_, values, count);
+}
+
 double ompl::RNG::halfNormalReal(double r_min, double r_max, double focus)
 {
     assert(r_min <= r_max);
@@ -0,0 +1,218 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#include "ompl/util/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <new>
+#include <unordered_set>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+/// @cond IGNORE
+namespace
+{
+    /* The existing pools, which need new worker threads in a forked child. Never destroyed, as pools with static
+       storage duration may still be destroyed after them. */
+    std::mutex &poolsLock()
+    {
+        static auto *lock = new std::mutex;
+        return *lock;
+    }
+
+    std::unordered_set<ompl::ThreadPool *> &pools()
+    {
+        static auto *pools = new std::unordered_set<ompl::ThreadPool *>;
+        return *pools;
+    }
+}
+/// @endcond
+
+ompl::ThreadPool::ThreadPool(unsigned int threadCount)
+{
+#ifndef _WIN32
+    static std::once_flag once;
+    std::call_once(once, [] { pthread_atfork(&prepareFork, &parentAfterFork, &childAfterFork); });
+#endif
+    std::lock_guard<std::mutex> slock(poolsLock());
+    pools().insert(this);
+    start(threadCount);
+}
+
+ompl::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> slock(lock_);
+        stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto &thread : threads_)
+        thread.join();
+
+    // Only now, so that a child forked while the threads stop still has a pool to destroy
+    std::lock_guard<std::mutex> slock(poolsLock());
+    pools().erase(this);
+}
+
+void ompl::ThreadPool::start(unsigned int threadCount)
+{
+    threads_.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        threads_.emplace_back([this] { worker(); });
+}
+
+void ompl::ThreadPool::prepareFork()
+{
+    // No pool is created or destroyed, and no worker holds the lock of a pool, while the process is copied
+    poolsLock().lock();
+    for (ThreadPool *pool : pools())
+        pool->lock_.lock();
+}
+
+void ompl::ThreadPool::parentAfterFork()
+{
+    for (ThreadPool *pool : pools())
+        pool->lock_.unlock();
+    poolsLock().unlock();
+}
+
+void ompl::ThreadPool::childAfterFork()
+{
+    // Only the thread that called fork() exists in the child. The locks are initialized again rather than unlocked,
+    // and so are the condition variables, which may still count the waiting workers of the parent.
+    new (&poolsLock()) std::mutex;
+    for (ThreadPool *pool : pools())
+    {
+        new (&pool->lock_) std::mutex;
+        new (&pool->cond_) std::condition_variable;
+
+        // The thread objects refer to threads of the parent, which can neither be joined nor detached here, so they
+        // are never destroyed
+        const auto threadCount = static_cast<unsigned int>(pool->threads_.size());
+        new std::vector<std::thread>(std::move(pool->threads_));
+        pool->threads_.clear();
+        pool->start(threadCount);
+    }
+}
+
+void ompl::ThreadPool::post(std::function<void()> task)
+{
+    if (threads_.empty())
+    {
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> slock(lock_);
+        tasks_.push_back(std::move(task));
+    }
+    cond_.notify_one();
+}
+
+void ompl::ThreadPool::worker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> slock(lock_);
+            cond_.wait(slock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty())
+                return;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void ompl::ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> &body)
+{
+    if (count == 0)
+        return;
+
+    // Helpers that start after all the indices have been claimed return without touching body,
+    // so waiting for the number of completed calls (rather than for the helpers) is enough. This
+    // also keeps nested calls from deadlocking when all the workers are busy.
+    struct Shared
+    {
+        std::atomic<std::size_t> next{0};
+        std::size_t completed{0};
+        std::exception_ptr error;
+        std::mutex lock;
+        std::condition_variable done;
+    };
+    auto shared = std::make_shared<Shared>();
+    const std::function<void(std::size_t)> *fn = &body;
+    auto run = [shared, fn, count]
+    {
+        std::size_t i;
+        while ((i = shared->next++) < count)
+        {
+            std::exception_ptr error;
+            try
+            {
+                (*fn)(i);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> slock(shared->lock);
+            if (error && !shared->error)
+                shared->error = error;
+            if (++shared->completed == count)
+                shared->done.notify_all();
+        }
+    };
+
+    std::size_t helpers = std::min<std::size_t>(threads_.size(), count - 1);
+    for (std::size_t i = 0; i < helpers; ++i)
+        post(run);
+    run();
+
+    std::unique_lock<std::mutex> slock(shared->lock);
+    shared->done.wait(slock, [&shared, count] { return shared->completed == count; });
+    if (shared->error)
+        std::rethrow_exception(shared->error);
+}
+
+unsigned int ompl::ThreadPool::getDefaultThreadCount()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
@@ -125,6 +125,7 @@ namespace ompl
             BOOST_CHECK(clonedState != source.get());
             //Make sure the states are the same.
             BOOST_CHECK(space_->equalStates(clonedState, source.get()));
+            space_->freeState(const_cast<base::State *>(clonedState));
         }
 
         /** \brief Call all tests for the state space */
@@ -37,12 +37,17 @@
 #define BOOST_TEST_MODULE "PlannerData"
 #include <boost/test/unit_test.hpp>
 #include <boost/serialization/export.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
+#include "ompl/base/FlatRoadmap.h"
 #include "ompl/base/PlannerData.h"
 #include "ompl/base/PlannerDataStorage.h"
 #include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/planners/prm/PRM.h"
 
 using namespace ompl;
 
@@ -563,3 +568,94 @@ BOOST_AUTO_TEST_CASE(Serialization)
     for (auto & state : states)
         space->freeState(state);
 }
+
+BOOST_AUTO_TEST_CASE(FlatRoadmapStorage)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1000.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    si->setup();
+    base::PlannerData data(si);
+    std::vector<base::State*> states;
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        states.push_back(space->allocState());
+        states[i]->as<base::RealVectorStateSpace::StateType>()->values[0] = (double)i;
+        states[i]->as<base::RealVectorStateSpace::StateType>()->values[1] = (double)(2 * i);
+        BOOST_CHECK (data.addVertex(base::PlannerDataVertex(states[i], i + 7)) == i);
+    }
+    data.markStartState(states[0]);
+    data.markGoalState(states[3]);
+    data.markGoalState(states[states.size()-1]);
+
+    // undirected edges, stored in both directions as the roadmap planners do
+    unsigned int num_edges_to_add = 2000;
+    ompl::RNG rng;
+    for (unsigned int i = 0; i < num_edges_to_add; ++i)
+    {
+        unsigned int v2, v1 = rng.uniformInt(0, states.size()-1);
+        do v2 = rng.uniformInt(0, states.size()-1); while (v2 == v1 || data.edgeExists(v1, v2));
+
+        base::Cost weight(std::abs((double)v1 - (double)v2));
+        BOOST_CHECK( data.addEdge(v1, v2, base::PlannerDataEdge(), weight) );
+        BOOST_CHECK( data.addEdge(v2, v1, base::PlannerDataEdge(), weight) );
+    }
+
+    base::FlatRoadmap::store(data, "testroadmap");
+    base::FlatRoadmap roadmap(space, "testroadmap");
+
+    BOOST_CHECK_EQUAL ( roadmap.numVertices(), states.size() );
+    BOOST_CHECK_EQUAL ( roadmap.numEdges(), 2 * num_edges_to_add );
+    BOOST_CHECK ( roadmap.isStartVertex(0) );
+    BOOST_CHECK ( !roadmap.isStartVertex(3) );
+    BOOST_CHECK ( roadmap.isGoalVertex(3) );
+    BOOST_CHECK ( roadmap.isGoalVertex(states.size()-1) );
+    BOOST_CHECK ( !roadmap.isGoalVertex(0) );
+
+    base::State *copy = space->allocState();
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        roadmap.copyState(i, copy);
+        BOOST_CHECK ( space->equalStates(copy, states[i]) );
+        BOOST_CHECK_EQUAL ( roadmap.getTag(i), (int)i + 7 );
+
+        std::vector<unsigned int> neighbors;
+        data.getEdges(i, neighbors);
+        std::sort (neighbors.begin(), neighbors.end());
+        BOOST_REQUIRE_EQUAL ( roadmap.getNeighborCount(i), neighbors.size() );
+
+        const std::uint32_t *neighbors2 = roadmap.getNeighbors(i);
+        const double *weights = roadmap.getEdgeWeights(i);
+        for (size_t j = 0; j < neighbors.size(); ++j)
+        {
+            BOOST_CHECK_EQUAL ( neighbors2[j], neighbors[j] );
+            BOOST_CHECK_EQUAL ( weights[j], std::abs((double)i - (double)neighbors[j]) );
+            BOOST_CHECK ( roadmap.edgeExists(i, neighbors[j]) );
+        }
+    }
+    space->freeState(copy);
+
+    // the planner creates each undirected edge once
+    geometric::PRM prm(si, roadmap);
+    BOOST_CHECK_EQUAL ( prm.milestoneCount(), states.size() );
+    BOOST_CHECK_EQUAL ( prm.edgeCount(), num_edges_to_add );
+
+    // a roadmap can only be opened with the space it was created for
+    auto otherSpace(std::make_shared<base::RealVectorStateSpace>(3));
+    BOOST_CHECK_THROW ( base::FlatRoadmap(otherSpace, "testroadmap"), ompl::Exception );
+    BOOST_CHECK_THROW ( base::FlatRoadmap(space, "testroadmap_missing"), ompl::Exception );
+
+    // an edge to a vertex that does not exist is rejected on opening; the last target precedes the
+    // edge weights at the end of the file
+    {
+        std::fstream file("testroadmap", std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-(std::streamoff)(2 * num_edges_to_add * sizeof(double) + sizeof(std::uint32_t)), std::ios::end);
+        std::uint32_t target = states.size();
+        file.write(reinterpret_cast<const char *>(&target), sizeof(target));
+    }
+    BOOST_CHECK_THROW ( base::FlatRoadmap(space, "testroadmap"), ompl::Exception );
+
+    for (auto & state : states)
+        space->freeState(state);
+}
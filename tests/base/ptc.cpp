@@ -36,6 +36,7 @@
 
 #define BOOST_TEST_MODULE "PlannerTerminationCondition"
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -86,6 +87,65 @@ BOOST_AUTO_TEST_CASE(TestThreadedTermination)
   BOOST_CHECK(ptc_long());
 }
 
+BOOST_AUTO_TEST_CASE(TestWaitForTermination)
+{
+  // a timed condition wakes up waiting threads when its deadline passes
+  const base::PlannerTerminationCondition ptc = base::timedPlannerTerminationCondition(0.05);
+  time::point start = time::now();
+  BOOST_CHECK(ptc.waitFor(10.0));
+  BOOST_CHECK(time::seconds(time::now() - start) < 5.0);
+
+  // a waiting thread is woken up by terminate()
+  const base::PlannerTerminationCondition never = base::plannerNonTerminatingCondition();
+  start = time::now();
+  std::thread terminator([&never] {
+    std::this_thread::sleep_for(ompl::time::seconds(0.05));
+    never.terminate();
+  });
+  BOOST_CHECK(never.waitFor(10.0));
+  BOOST_CHECK(time::seconds(time::now() - start) < 5.0);
+  terminator.join();
+
+  // without an event, the wait times out
+  BOOST_CHECK(!base::plannerNonTerminatingCondition().waitFor(0.01));
+}
+
+BOOST_AUTO_TEST_CASE(TestManyTimedTerminations)
+{
+  // all the deadlines are handled by the same timer, in order
+  std::vector<base::PlannerTerminationCondition> conditions;
+  for (unsigned int i = 0; i < 500; ++i)
+    conditions.push_back(base::timedPlannerTerminationCondition(i % 2 == 0 ? 0.02 : 100.0));
+  // a loaded machine may fire the deadlines late, so each one is waited for, up to a bound
+  for (unsigned int i = 0; i < conditions.size(); i += 2)
+    BOOST_CHECK(conditions[i].waitFor(5.0));
+  for (unsigned int i = 1; i < conditions.size(); i += 2)
+    BOOST_CHECK(!conditions[i]);
+  conditions.clear();
+}
+
+BOOST_AUTO_TEST_CASE(TestSlowPeriodicTermination)
+{
+  // a periodic condition whose function blocks delays neither deadlines nor other periodic conditions
+  std::atomic<bool> release(false), called(false);
+  base::PlannerTerminationCondition slow([&release, &called] {
+    called = true;
+    while (!release)
+      std::this_thread::sleep_for(ompl::time::seconds(0.001));
+    return false;
+  }, 0.001);
+  while (!called)
+    std::this_thread::sleep_for(ompl::time::seconds(0.001));
+
+  time::point start = time::now();
+  BOOST_CHECK(base::timedPlannerTerminationCondition(0.02).waitFor(10.0));
+  BOOST_CHECK(base::PlannerTerminationCondition([] { return true; }, 0.001).waitFor(10.0));
+  BOOST_CHECK(time::seconds(time::now() - start) < 5.0);
+
+  BOOST_CHECK(!slow);
+  release = true;
+}
+
 BOOST_AUTO_TEST_CASE(TestIterationTermination)
 {
   base::IterationTerminationCondition iptc(10);
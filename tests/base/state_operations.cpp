@@ -42,6 +42,8 @@
 #include "ompl/base/ScopedState.h"
 #include "ompl/base/spaces/SE3StateSpace.h"
 #include "ompl/base/SpaceInformation.h"
+#include "ompl/base/DiscreteMotionValidator.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
 #include "ompl/util/Time.h"
 
 using namespace ompl;
@@ -321,3 +323,66 @@ BOOST_AUTO_TEST_CASE(PartialCopy)
         BOOST_CHECK(copyStateData(q, dummy.get(), r3, state[r3].get()) == base::NO_DATA_COPIED);
     }
 }
+
+/** \brief States are invalid inside a vertical strip; counts the calls to isValidBatch() */
+class StripValidityChecker : public base::StateValidityChecker
+{
+public:
+    StripValidityChecker(const base::SpaceInformationPtr &si) : base::StateValidityChecker(si)
+    {
+    }
+
+    bool isValid(const base::State *state) const override
+    {
+        double x = state->as<base::RealVectorStateSpace::StateType>()->values[0];
+        return x < 0.45 || x > 0.55;
+    }
+
+    bool isValidBatch(const base::State *const *states, std::size_t count, bool *valid) const override
+    {
+        ++batches_;
+        return base::StateValidityChecker::isValidBatch(states, count, valid);
+    }
+
+    mutable unsigned int batches_{0};
+};
+
+BOOST_AUTO_TEST_CASE(BatchMotionValidation)
+{
+    auto m(std::make_shared<base::RealVectorStateSpace>(2));
+    m->setBounds(0, 1);
+    m->setLongestValidSegmentFraction(0.001);
+    auto si(std::make_shared<base::SpaceInformation>(m));
+    auto checker(std::make_shared<StripValidityChecker>(si));
+    si->setStateValidityChecker(checker);
+    si->setup();
+
+    base::DiscreteMotionValidator single(si);
+    base::DiscreteMotionValidator batched(si);
+    batched.setBatchSize(16);
+    BOOST_CHECK_EQUAL(batched.getBatchSize(), 16u);
+
+    base::ScopedState<> s1(m), s2(m), last1(m), last2(m);
+    for (int i = 0 ; i < 200 ; ++i)
+    {
+        do
+            s1.random();
+        while (!si->isValid(s1.get()));
+        s2.random();
+
+        BOOST_CHECK_EQUAL(single.checkMotion(s1.get(), s2.get()), batched.checkMotion(s1.get(), s2.get()));
+
+        std::pair<base::State *, double> lv1(last1.get(), 0.0), lv2(last2.get(), 0.0);
+        bool r1 = single.checkMotion(s1.get(), s2.get(), lv1);
+        bool r2 = batched.checkMotion(s1.get(), s2.get(), lv2);
+        BOOST_CHECK_EQUAL(r1, r2);
+        if (!r1)
+        {
+            BOOST_OMPL_EXPECT_NEAR(lv1.second, lv2.second, 1e-12);
+            BOOST_OMPL_EXPECT_NEAR(m->distance(last1.get(), last2.get()), 0.0, 1e-12);
+        }
+    }
+    BOOST_CHECK(checker->batches_ > 0u);
+    BOOST_CHECK_EQUAL(single.getValidMotionCount(), batched.getValidMotionCount());
+    BOOST_CHECK_EQUAL(single.getInvalidMotionCount(), batched.getInvalidMotionCount());
+}
@@ -52,6 +52,7 @@
 #include "ompl/base/spaces/DubinsStateSpace.h"
 
 #include <boost/math/constants/constants.hpp>
+#include <thread>
 
 #include "StateSpaceTest.h"
 
@@ -413,3 +414,223 @@ BOOST_AUTO_TEST_CASE(Compound_Simple)
     BOOST_CHECK(m3->includes(m3));
     BOOST_CHECK(t->includes(t));
 }
+
+BOOST_AUTO_TEST_CASE(Compound_Pooled)
+{
+    auto r(std::make_shared<base::RealVectorStateSpace>(7));
+    r->setBounds(-1, 1);
+    auto m1(std::make_shared<base::SE2StateSpace>());
+    base::RealVectorBounds b(2);
+    b.setLow(0);
+    b.setHigh(1);
+    m1->setBounds(b);
+    base::StateSpacePtr s = m1 + r + std::make_shared<base::SO3StateSpace>();
+
+    // a state allocated before the pool is active must remain freeable
+    base::State *early = s->allocState();
+
+    s->setStatePoolEnabled(true);
+    s->setup();
+    BOOST_REQUIRE(s->getStatePool() != nullptr);
+    BOOST_CHECK_EQUAL(s->getStatePool()->getUsedBlockCount(), 0u);
+
+    StateSpaceTest mt(s, 1000, 1e-12);
+    mt.test();
+
+    std::vector<base::State *> states(100);
+    for (auto &state : states)
+        state = s->allocState();
+    BOOST_CHECK_EQUAL(s->getStatePool()->getUsedBlockCount(), states.size());
+
+    base::ScopedState<> a(s), c(s);
+    a.random();
+    s->copyState(states[0], a.get());
+    c = states[0];
+    BOOST_CHECK_EQUAL(a, c);
+    BOOST_CHECK(s->getStatePool()->owns(states[0]));
+    BOOST_CHECK(s->getStatePool()->owns(states[0]->as<base::CompoundState>()->components[1]));
+    BOOST_CHECK_EQUAL(s->getStatePool()->owns(early), false);
+
+    s->freeState(early);
+    s->releaseStatePool();
+    BOOST_CHECK(s->getStatePool()->getReservedBlockCount() > 0u);
+    for (auto &state : states)
+        s->freeState(state);
+    BOOST_CHECK_EQUAL(s->getStatePool()->getUsedBlockCount(), 2u);
+
+    s->setStatePoolEnabled(false);
+    base::State *late = s->allocState();
+    BOOST_CHECK_EQUAL(s->getStatePool()->owns(late), false);
+    s->freeState(late);
+}
+
+BOOST_AUTO_TEST_CASE(Sampler_Streams)
+{
+    auto r1(std::make_shared<base::RealVectorStateSpace>(2)), r2(std::make_shared<base::RealVectorStateSpace>(2));
+    r1->setBounds(0, 1);
+    r2->setBounds(0, 1);
+    auto se3(std::make_shared<base::SE3StateSpace>());
+    base::RealVectorBounds bounds(3);
+    bounds.setLow(0);
+    bounds.setHigh(1);
+    se3->setBounds(bounds);
+    base::StateSpacePtr s = r1 + r2 + se3;
+    s->setup();
+
+    // samplers with the same stream give the same states, no matter when they were created
+    base::StateSamplerPtr first = s->allocStateSampler(), other = s->allocStateSampler();
+    base::StateSamplerPtr second = s->allocStateSampler();
+    first->setLocalStream(7, 3);
+    second->setLocalStream(7, 3);
+    other->setLocalStream(7, 4);
+    base::ScopedState<> a(s), b(s), c(s);
+    for (int i = 0; i < 20; ++i)
+    {
+        first->sampleUniform(a.get());
+        second->sampleUniform(b.get());
+        other->sampleUniform(c.get());
+        BOOST_CHECK_EQUAL(a, b);
+        BOOST_CHECK(a != c);
+        // components of the same type do not get the same numbers
+        BOOST_CHECK(a[0] != a[2]);
+    }
+
+    // valid state samplers pass the stream on to their state sampler
+    auto si(std::make_shared<base::SpaceInformation>(s));
+    si->setStateValidityChecker([](const base::State *) { return true; });
+    si->setup();
+    base::ValidStateSamplerPtr vfirst = si->allocValidStateSampler(), vsecond = si->allocValidStateSampler();
+    vfirst->setLocalStream(7, 3);
+    vsecond->setLocalStream(7, 3);
+    for (int i = 0; i < 20; ++i)
+    {
+        BOOST_CHECK(vfirst->sample(a.get()));
+        BOOST_CHECK(vsecond->sample(b.get()));
+        BOOST_CHECK_EQUAL(a, b);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(StatePool_Concurrent)
+{
+    base::StatePool pool(40);
+    const unsigned int threadCount = 4, blockCount = 2000;
+    std::vector<std::vector<void *>> blocks(threadCount);
+
+    // every thread allocates blocks and frees the blocks of another thread
+    auto work = [&](unsigned int t, bool allocate)
+    {
+        if (allocate)
+        {
+            for (unsigned int i = 0; i < blockCount; ++i)
+            {
+                auto *block = static_cast<unsigned int *>(pool.allocate());
+                *block = t * blockCount + i;
+                blocks[t].push_back(block);
+            }
+            return;
+        }
+        for (unsigned int i = 0; i < blockCount; ++i)
+        {
+            void *block = blocks[(t + 1) % threadCount][i];
+            BOOST_CHECK(pool.owns(block));
+            BOOST_CHECK_EQUAL(*static_cast<unsigned int *>(block), ((t + 1) % threadCount) * blockCount + i);
+            pool.deallocate(block);
+        }
+    };
+
+    for (bool allocate : {true, false})
+    {
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < threadCount; ++t)
+            threads.emplace_back(work, t, allocate);
+        for (auto &thread : threads)
+            thread.join();
+        BOOST_CHECK_EQUAL(pool.getUsedBlockCount(), allocate ? threadCount * blockCount : 0u);
+    }
+    BOOST_CHECK(pool.getReservedBlockCount() >= threadCount * blockCount);
+
+    int onStack = 0;
+    std::unique_ptr<int> onHeap(new int(0));
+    BOOST_CHECK_EQUAL(pool.owns(&onStack), false);
+    BOOST_CHECK_EQUAL(pool.owns(onHeap.get()), false);
+
+    void *block = pool.allocate();
+    BOOST_CHECK_EQUAL(pool.release(), false);
+    pool.deallocate(block);
+    BOOST_CHECK_EQUAL(pool.getReservedBlockCount(), 0u);
+    BOOST_CHECK_EQUAL(pool.owns(block), false);
+}
+
+static void checkBatchDistances(const base::StateSpacePtr &s, bool packed)
+{
+    s->setup();
+    BOOST_CHECK_EQUAL(s->getPackedValueCount() > 0, packed);
+
+    base::ScopedState<> query(s);
+    query.random();
+    std::vector<base::State *> states(150);
+    for (auto &state : states)
+    {
+        state = s->allocState();
+        base::ScopedState<> tmp(s);
+        tmp.random();
+        s->copyState(state, tmp.get());
+    }
+    s->copyState(states[17], query.get());
+
+    base::StateBatch batch(s);
+    batch.add(states);
+    BOOST_CHECK_EQUAL(batch.size(), states.size());
+    BOOST_CHECK_EQUAL(batch.isPacked(), packed);
+
+    std::vector<double> d1(states.size()), d2(states.size());
+    s->distanceBatch(query.get(), batch, d1.data());
+    s->distanceBatch(query.get(), states.data(), states.size(), d2.data());
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+        double d = s->distance(query.get(), states[i]);
+        BOOST_OMPL_EXPECT_NEAR(d1[i], d, 1e-9);
+        BOOST_OMPL_EXPECT_NEAR(d2[i], d, 1e-9);
+    }
+    BOOST_OMPL_EXPECT_NEAR(d1[17], 0.0, 1e-6);
+
+    for (auto &state : states)
+        s->freeState(state);
+}
+
+BOOST_AUTO_TEST_CASE(Batch_Distance)
+{
+    auto r(std::make_shared<base::RealVectorStateSpace>(7));
+    r->setBounds(-1, 1);
+    checkBatchDistances(r, true);
+    checkBatchDistances(std::make_shared<base::SO2StateSpace>(), true);
+    checkBatchDistances(std::make_shared<base::SO3StateSpace>(), true);
+
+    base::RealVectorBounds b(2);
+    b.setLow(-3);
+    b.setHigh(3);
+    auto se2(std::make_shared<base::SE2StateSpace>());
+    se2->setBounds(b);
+    checkBatchDistances(se2, true);
+
+    base::RealVectorBounds b3(3);
+    b3.setLow(-3);
+    b3.setHigh(3);
+    auto se3(std::make_shared<base::SE3StateSpace>());
+    se3->setBounds(b3);
+    checkBatchDistances(se3, true);
+
+    auto r2(std::make_shared<base::RealVectorStateSpace>(3));
+    r2->setBounds(-1, 1);
+    auto compound(std::make_shared<base::CompoundStateSpace>());
+    compound->addSubspace(se2, 0.5);
+    compound->addSubspace(r2, 2.0);
+    compound->addSubspace(std::make_shared<base::SO3StateSpace>(), 1.0);
+    checkBatchDistances(compound, true);
+
+    // spaces with their own distance function fall back to calling distance()
+    auto dubins(std::make_shared<base::DubinsStateSpace>());
+    dubins->setBounds(b);
+    checkBatchDistances(dubins, false);
+    checkBatchDistances(se2 + std::make_shared<base::TimeStateSpace>(), false);
+}
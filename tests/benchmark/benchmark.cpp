@@ -0,0 +1,325 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#define BOOST_TEST_MODULE "Benchmark"
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/planners/informedtrees/AITstar.h"
+#include "ompl/geometric/planners/prm/PRM.h"
+#include "ompl/geometric/planners/rrt/RRT.h"
+#include "ompl/tools/benchmark/Benchmark.h"
+#include "ompl/tools/benchmark/ResultsStream.h"
+
+using namespace ompl;
+
+/* Benchmark RRT and PRM on an empty square, using processCount processes */
+static tools::Benchmark::CompleteExperiment runBenchmark(unsigned int processCount, std::string *log = nullptr,
+                                                         const std::string &stream = std::string(),
+                                                         double goalBias = 0.05)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    geometric::SimpleSetup setup(space);
+    setup.setStateValidityChecker([](const base::State *) { return true; });
+    base::ScopedState<> start(space), goal(space);
+    start[0] = start[1] = 0.1;
+    goal[0] = goal[1] = 0.9;
+    setup.setStartAndGoalStates(start, goal, 0.05);
+
+    tools::Benchmark benchmark(setup, "processes");
+    auto rrt(std::make_shared<geometric::RRT>(setup.getSpaceInformation()));
+    rrt->setGoalBias(goalBias);
+    benchmark.addPlanner(rrt);
+    benchmark.addPlanner(std::make_shared<geometric::PRM>(setup.getSpaceInformation()));
+    tools::Benchmark::Request request(1.0, 4096.0, 5, 0.001, false, false, false, processCount);
+    request.streamFilename = stream;
+    benchmark.benchmark(request);
+    if (log != nullptr)
+    {
+        std::stringstream out;
+        BOOST_CHECK(benchmark.saveResultsToStream(out));
+        *log = out.str();
+    }
+    return benchmark.getRecordedExperimentData();
+}
+
+BOOST_AUTO_TEST_CASE(MultipleProcesses)
+{
+    std::string log;
+    const auto single = runBenchmark(1);
+    const auto multiple = runBenchmark(3, &log);
+    const auto other = runBenchmark(2);
+
+    BOOST_REQUIRE_EQUAL(multiple.planners.size(), 2u);
+    for (std::size_t i = 0; i < multiple.planners.size(); ++i)
+    {
+        const auto &planner = multiple.planners[i];
+        BOOST_CHECK_EQUAL(planner.name, single.planners[i].name);
+        BOOST_CHECK(planner.common == single.planners[i].common);
+        BOOST_CHECK(planner.progressPropertyNames == single.planners[i].progressPropertyNames);
+        BOOST_CHECK_EQUAL(planner.runsProgressData.size(), single.planners[i].runsProgressData.size());
+        BOOST_REQUIRE_EQUAL(planner.runs.size(), 5u);
+
+        std::set<std::string> seeds;
+        for (std::size_t j = 0; j < planner.runs.size(); ++j)
+        {
+            const auto &run = planner.runs[j];
+            BOOST_CHECK_EQUAL(run.at("solved BOOLEAN"), "1");
+            // the seed of a run does not depend on the number of processes
+            BOOST_CHECK_EQUAL(run.at("random seed INTEGER"), other.planners[i].runs[j].at("random seed INTEGER"));
+            seeds.insert(run.at("random seed INTEGER"));
+        }
+        BOOST_CHECK_EQUAL(seeds.size(), planner.runs.size());
+    }
+
+    // the merged results are written in the usual format
+    BOOST_CHECK(log.find("2 planners") != std::string::npos);
+    BOOST_CHECK(log.find("5 runs") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ReproducibleRuns)
+{
+    const auto single = runBenchmark(1, nullptr, std::string(), 0.0);
+    const auto multiple = runBenchmark(3, nullptr, std::string(), 0.0);
+
+    // RRT does not depend on timing and, without goal bias, only uses the sampler it allocates for each run, so
+    // each run gives the same result with any number of processes
+    const auto &rrt = single.planners[0];
+    BOOST_REQUIRE_EQUAL(rrt.runs.size(), 5u);
+    BOOST_REQUIRE_EQUAL(multiple.planners[0].runs.size(), 5u);
+    std::set<std::string> graphStates;
+    for (std::size_t j = 0; j < rrt.runs.size(); ++j)
+    {
+        const auto &run = rrt.runs[j];
+        const auto &other = multiple.planners[0].runs[j];
+        for (const char *property : {"random seed INTEGER", "graph states INTEGER", "graph motions INTEGER",
+                                     "solution length REAL", "solution segments INTEGER"})
+            BOOST_CHECK_EQUAL(run.at(property), other.at(property));
+        graphStates.insert(run.at("graph states INTEGER"));
+    }
+    // different runs are still seeded differently
+    BOOST_CHECK(graphStates.size() > 1);
+}
+
+/* RRT that never returns from run 2 of the benchmark */
+class HangingRRT : public geometric::RRT
+{
+public:
+    HangingRRT(const base::SpaceInformationPtr &si, const tools::Benchmark &benchmark)
+      : RRT(si), benchmark_(benchmark)
+    {
+        setName("HangingRRT");
+    }
+
+    base::PlannerStatus solve(const base::PlannerTerminationCondition &ptc) override
+    {
+        while (benchmark_.getStatus().activeRun == 2)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return RRT::solve(ptc);
+    }
+
+private:
+    const tools::Benchmark &benchmark_;
+};
+
+/* Benchmark planner on an empty square in two processes, with a short grace period */
+static tools::Benchmark::CompleteExperiment runInTwoProcesses(
+    const std::function<base::PlannerPtr(const base::SpaceInformationPtr &, const tools::Benchmark &)> &allocPlanner)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    geometric::SimpleSetup setup(space);
+    setup.setStateValidityChecker([](const base::State *) { return true; });
+    base::ScopedState<> start(space), goal(space);
+    start[0] = start[1] = 0.1;
+    goal[0] = goal[1] = 0.9;
+    setup.setStartAndGoalStates(start, goal, 0.05);
+
+    tools::Benchmark benchmark(setup, "watchdog");
+    benchmark.addPlanner(allocPlanner(setup.getSpaceInformation(), benchmark));
+    tools::Benchmark::Request request(0.2, 4096.0, 5, 0.05, false, false, false, 2);
+    request.gracePeriod = 2.0;
+    benchmark.benchmark(request);
+    return benchmark.getRecordedExperimentData();
+}
+
+BOOST_AUTO_TEST_CASE(HungWorker)
+{
+    const auto exp = runInTwoProcesses([](const base::SpaceInformationPtr &si, const tools::Benchmark &benchmark)
+                                       { return std::make_shared<HangingRRT>(si, benchmark); });
+    BOOST_REQUIRE_EQUAL(exp.planners.size(), 1u);
+    const auto &runs = exp.planners[0].runs;
+    BOOST_REQUIRE_EQUAL(runs.size(), 5u);
+    // the hung run is recorded as crashed, while the next run of its worker is executed by a new one
+    for (std::size_t j = 0; j < runs.size(); ++j)
+        BOOST_CHECK_EQUAL(runs[j].at("status ENUM"),
+                          std::to_string((int)(j == 2 ? base::PlannerStatus::CRASH :
+                                                        base::PlannerStatus::EXACT_SOLUTION)));
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolInWorkers)
+{
+    // the thread pool of AIT* is created before the workers are forked
+    const auto exp = runInTwoProcesses([](const base::SpaceInformationPtr &si, const tools::Benchmark &)
+                                       {
+                                           auto planner(std::make_shared<geometric::AITstar>(si));
+                                           planner->setThreadCount(4);
+                                           return planner;
+                                       });
+    BOOST_REQUIRE_EQUAL(exp.planners.size(), 1u);
+    BOOST_REQUIRE_EQUAL(exp.planners[0].runs.size(), 5u);
+    for (const auto &run : exp.planners[0].runs)
+        BOOST_CHECK(run.at("status ENUM") != std::to_string((int)base::PlannerStatus::CRASH));
+}
+
+static void checkStream(const std::string &filename, unsigned int processCount)
+{
+    const auto recorded = runBenchmark(processCount, nullptr, filename);
+    BOOST_REQUIRE_EQUAL(recorded.planners.size(), 2u);
+    for (const auto &planner : recorded.planners)
+        BOOST_CHECK(planner.runs.empty());
+
+    tools::Benchmark::CompleteExperiment exp;
+    BOOST_REQUIRE(tools::ResultsStream::read(filename, exp));
+    BOOST_CHECK_EQUAL(exp.name, recorded.name);
+    BOOST_CHECK_EQUAL(exp.seed, recorded.seed);
+    BOOST_CHECK_EQUAL(exp.runCount, 5u);
+    BOOST_CHECK_EQUAL(exp.totalDuration, recorded.totalDuration);
+    BOOST_CHECK(time::seconds(exp.startTime - recorded.startTime) < 1e-3);
+    BOOST_CHECK_EQUAL(exp.setupInfo, recorded.setupInfo);
+    BOOST_REQUIRE_EQUAL(exp.planners.size(), 2u);
+    for (std::size_t i = 0; i < exp.planners.size(); ++i)
+    {
+        const auto &planner = exp.planners[i];
+        BOOST_CHECK_EQUAL(planner.name, recorded.planners[i].name);
+        BOOST_CHECK(planner.common == recorded.planners[i].common);
+        BOOST_CHECK(planner.progressPropertyNames == recorded.planners[i].progressPropertyNames);
+        BOOST_REQUIRE_EQUAL(planner.runs.size(), 5u);
+        for (const auto &run : planner.runs)
+        {
+            BOOST_CHECK_EQUAL(run.at("solved BOOLEAN"), "1");
+            BOOST_CHECK_EQUAL(run.at("status ENUM"), std::to_string((int)base::PlannerStatus::EXACT_SOLUTION));
+            BOOST_CHECK(run.count("time REAL") == 1);
+            BOOST_CHECK(run.count("graph states INTEGER") == 1);
+        }
+    }
+    // only PRM reports progress properties
+    BOOST_CHECK(exp.planners[0].runsProgressData.empty());
+    BOOST_CHECK_EQUAL(exp.planners[1].runsProgressData.size(), 5u);
+    for (const auto &run : exp.planners[1].runsProgressData)
+        for (const auto &data : run)
+            BOOST_CHECK_EQUAL(data.size(), exp.planners[1].progressPropertyNames.size());
+}
+
+BOOST_AUTO_TEST_CASE(StreamResults)
+{
+    const std::string filename = "benchmark_stream_test.results";
+    checkStream(filename, 1);
+    checkStream(filename, 2);
+
+    // a file that ends with an incomplete record can be read up to that record
+    std::ifstream in(filename.c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size() - 3);
+    out.close();
+    tools::Benchmark::CompleteExperiment exp;
+    BOOST_CHECK(tools::ResultsStream::read(filename, exp));
+    BOOST_CHECK_EQUAL(exp.planners.size(), 2u);
+    BOOST_CHECK_EQUAL(exp.totalDuration, 0.0);
+    std::remove(filename.c_str());
+}
+
+/* Keeps the warnings that are logged */
+class WarningRecorder : public msg::OutputHandler
+{
+public:
+    void log(const std::string &text, msg::LogLevel level, const char * /*filename*/, int /*line*/) override
+    {
+        if (level == msg::LOG_WARN)
+            warnings.push_back(text);
+    }
+
+    std::vector<std::string> warnings;
+};
+
+BOOST_AUTO_TEST_CASE(MistypedValues)
+{
+    const std::string filename = "benchmark_mistyped_test.results";
+    tools::Benchmark::CompleteExperiment exp;
+    exp.name = "mistyped";
+    exp.runCount = 2;
+    tools::Benchmark::PlannerExperiment planner;
+    planner.name = "planner";
+    planner.progressPropertyNames.push_back("cost REAL");
+
+    WarningRecorder recorder;
+    msg::useOutputHandler(&recorder);
+    {
+        tools::ResultsStream stream(filename);
+        stream.writeExperiment(exp);
+        stream.writePlanner(0, planner, true);
+        stream.writeRun(0, 0, {{"time REAL", "0.5"}, {"solved BOOLEAN", "maybe"}});
+        stream.writeRun(0, 1, {{"time REAL", "fast"}, {"solved BOOLEAN", "1"}});
+        stream.addProgress(0, 0, {{"cost REAL", "inf"}});
+        stream.addProgress(0, 0, {{"cost REAL", "n/a"}});
+        stream.writeDuration(1.0);
+    }
+    msg::restorePreviousOutputHandler();
+
+    // values that do not have the type of their property are left out, with a warning naming the property
+    BOOST_REQUIRE_EQUAL(recorder.warnings.size(), 3u);
+    BOOST_CHECK(recorder.warnings[0].find("solved BOOLEAN") != std::string::npos);
+    BOOST_CHECK(recorder.warnings[0].find("maybe") != std::string::npos);
+    BOOST_CHECK(recorder.warnings[1].find("time REAL") != std::string::npos);
+    BOOST_CHECK(recorder.warnings[2].find("cost REAL") != std::string::npos);
+
+    tools::Benchmark::CompleteExperiment read;
+    BOOST_REQUIRE(tools::ResultsStream::read(filename, read));
+    BOOST_REQUIRE_EQUAL(read.planners.size(), 1u);
+    const auto &runs = read.planners[0].runs;
+    BOOST_REQUIRE_EQUAL(runs.size(), 2u);
+    BOOST_CHECK(runs[0].count("time REAL") == 1u && runs[0].count("solved BOOLEAN") == 0u);
+    BOOST_CHECK(runs[1].count("time REAL") == 0u && runs[1].count("solved BOOLEAN") == 1u);
+    std::remove(filename.c_str());
+}
@@ -49,6 +49,7 @@
 #include "ompl/control/planners/syclop/SyclopEST.h"
 #include "ompl/control/planners/syclop/SyclopRRT.h"
 #include "ompl/control/planners/syclop/GridDecomposition.h"
+#include "ompl/control/SimpleDirectedControlSampler.h"
 
 #include "../../resources/environment2D.h"
 
@@ -538,4 +539,100 @@ OMPL_PLANNER_TEST(SyclopRRT, 99.0, 0.05)
 OMPL_PLANNER_TEST(SyclopEST, 99.0, 0.05)
 OMPL_PLANNER_TEST(PDST, 99.0, 0.05)
 
+/** A control sampler whose random sequence only depends on a fixed seed */
+class SeededControlSampler : public control::RealVectorControlUniformSampler
+{
+public:
+    SeededControlSampler(const control::ControlSpace *space) : control::RealVectorControlUniformSampler(space)
+    {
+        rng_.setLocalSeed(42);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(control_BatchPropagation)
+{
+    control::SpaceInformationPtr si = mySpaceInformation(env);
+    base::StateSamplerPtr sampler = si->allocStateSampler();
+    control::ControlSamplerPtr csampler = si->allocControlSampler();
+    RNG rng;
+
+    const unsigned int n = 50;
+    std::vector<const base::State *> states;
+    std::vector<const control::Control *> controls;
+    std::vector<base::State *> results;
+    std::vector<unsigned int> steps;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        base::State *state = si->allocState();
+        do
+            sampler->sampleUniform(state);
+        while (!si->isValid(state));
+        control::Control *control = si->allocControl();
+        csampler->sample(control);
+        states.push_back(state);
+        controls.push_back(control);
+        results.push_back(si->allocState());
+        steps.push_back(rng.uniformInt(0, 25));
+    }
+
+    std::vector<unsigned int> batchSteps(steps);
+    si->propagateWhileValidBatch(states, controls, batchSteps, results);
+
+    base::State *result = si->allocState();
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        BOOST_CHECK_EQUAL(si->propagateWhileValid(states[i], controls[i], steps[i], result), batchSteps[i]);
+        BOOST_CHECK(si->equalStates(result, results[i]));
+    }
+    si->freeState(result);
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        si->freeState(const_cast<base::State *>(states[i]));
+        si->freeControl(const_cast<control::Control *>(controls[i]));
+        si->freeState(results[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(control_ParallelDirectedSampling)
+{
+    control::SpaceInformationPtr si = mySpaceInformation(env);
+    si->getControlSpace()->setControlSamplerAllocator([](const control::ControlSpace *space)
+                                                      {
+                                                          return std::make_shared<SeededControlSampler>(space);
+                                                      });
+
+    control::SimpleDirectedControlSampler serial(si.get(), 20);
+    control::SimpleDirectedControlSampler parallel(si.get(), 20);
+    parallel.setThreadPool(std::make_shared<ThreadPool>(3));
+
+    base::StateSamplerPtr sampler = si->allocStateSampler();
+    base::State *source = si->allocState();
+    base::State *dest1 = si->allocState();
+    base::State *dest2 = si->allocState();
+    control::Control *control1 = si->allocControl();
+    control::Control *control2 = si->allocControl();
+
+    for (int i = 0; i < 100; ++i)
+    {
+        do
+            sampler->sampleUniform(source);
+        while (!si->isValid(source));
+        sampler->sampleUniform(dest1);
+        si->copyState(dest2, dest1);
+
+        unsigned int steps1 = serial.sampleTo(control1, source, dest1);
+        unsigned int steps2 = parallel.sampleTo(control2, source, dest2);
+        BOOST_CHECK_EQUAL(steps1, steps2);
+        BOOST_CHECK(si->equalStates(dest1, dest2));
+        BOOST_CHECK(si->equalControls(control1, control2));
+    }
+
+    si->freeControl(control1);
+    si->freeControl(control2);
+    si->freeState(source);
+    si->freeState(dest1);
+    si->freeState(dest2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,248 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#define BOOST_TEST_MODULE "ODESolver"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/base/spaces/SE2StateSpace.h"
+#include "ompl/control/ODESolver.h"
+#include "ompl/control/spaces/RealVectorControlSpace.h"
+
+using namespace ompl;
+
+// q' = (u0, u1, 0) for a system with three state values and two controls
+static void planarODE(const control::ODESolver::StateType &q, const control::Control *control,
+                      control::ODESolver::StateType &qdot)
+{
+    const double *u = control->as<control::RealVectorControlSpace::ControlType>()->values;
+    qdot.resize(q.size());
+    qdot[0] = u[0];
+    qdot[1] = u[1];
+    qdot[2] = 0.0;
+}
+
+static void planarFixedODE(const std::array<double, 3> & /*q*/, const control::Control *control,
+                           std::array<double, 3> &qdot)
+{
+    const double *u = control->as<control::RealVectorControlSpace::ControlType>()->values;
+    qdot[0] = u[0];
+    qdot[1] = u[1];
+    qdot[2] = 0.0;
+}
+
+// every value grows at unit rate, for any dimension
+static void unitODE(const control::ODESolver::StateType &q, const control::Control * /*control*/,
+                    control::ODESolver::StateType &qdot)
+{
+    qdot.assign(q.size(), 1.0);
+}
+
+// the same system, for a batch of n systems with values stored dimension by dimension
+static void planarBatchODE(const control::ODESolver::StateType &q, const std::vector<const control::Control *> &controls,
+                           control::ODESolver::StateType &qdot)
+{
+    const std::size_t n = controls.size();
+    qdot.resize(q.size());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double *u = controls[i]->as<control::RealVectorControlSpace::ControlType>()->values;
+        qdot[i] = u[0];
+        qdot[n + i] = u[1];
+        qdot[2 * n + i] = 0.0;
+    }
+}
+
+static control::SpaceInformationPtr planarSpaceInformation(const base::StateSpacePtr &space)
+{
+    auto cspace(std::make_shared<control::RealVectorControlSpace>(space, 2));
+    cspace->setBounds(base::RealVectorBounds(2));
+    auto si(std::make_shared<control::SpaceInformation>(space, cspace));
+    si->setStateValidityChecker([](const base::State *) { return true; });
+    si->setPropagationStepSize(0.1);
+    return si;
+}
+
+static void checkPropagation(const control::SpaceInformationPtr &si, const control::StatePropagatorPtr &propagator)
+{
+    si->setStatePropagator(propagator);
+    si->setup();
+
+    const base::StateSpacePtr &space = si->getStateSpace();
+    base::State *state = si->allocState();
+    base::State *result = si->allocState();
+    control::Control *control = si->allocControl();
+    control->as<control::RealVectorControlSpace::ControlType>()->values[0] = 1.5;
+    control->as<control::RealVectorControlSpace::ControlType>()->values[1] = -0.5;
+
+    std::vector<double> initial{1.0, 2.0, 0.25}, reals;
+    space->copyFromReals(state, initial);
+    for (int i = 0; i < 3; ++i)
+    {
+        // the same buffers and steppers are reused by every call
+        propagator->propagate(state, control, 0.5, result);
+        space->copyToReals(reals, result);
+        BOOST_CHECK_SMALL(reals[0] - 1.75, 1e-9);
+        BOOST_CHECK_SMALL(reals[1] - 1.75, 1e-9);
+        BOOST_CHECK_SMALL(reals[2] - 0.25, 1e-9);
+    }
+
+    si->freeControl(control);
+    si->freeState(result);
+    si->freeState(state);
+}
+
+BOOST_AUTO_TEST_CASE(BasicSolver)
+{
+    // values stored contiguously
+    auto rv(std::make_shared<base::RealVectorStateSpace>(3));
+    rv->setBounds(-10, 10);
+    auto si = planarSpaceInformation(rv);
+    checkPropagation(si, control::ODESolver::getStatePropagator(
+                             std::make_shared<control::ODEBasicSolver<>>(si, &planarODE)));
+
+    // values scattered over the components of a compound state
+    auto se2(std::make_shared<base::SE2StateSpace>());
+    base::RealVectorBounds bounds(2);
+    bounds.setLow(-10);
+    bounds.setHigh(10);
+    se2->setBounds(bounds);
+    si = planarSpaceInformation(se2);
+    checkPropagation(si, control::ODESolver::getStatePropagator(
+                             std::make_shared<control::ODEBasicSolver<>>(si, &planarODE)));
+}
+
+BOOST_AUTO_TEST_CASE(FixedSizeSolver)
+{
+    auto rv(std::make_shared<base::RealVectorStateSpace>(3));
+    rv->setBounds(-10, 10);
+    auto si = planarSpaceInformation(rv);
+    checkPropagation(si, control::ODESolver::getStatePropagator(
+                             std::make_shared<control::ODEFixedSizeSolver<3>>(si, &planarFixedODE)));
+
+    auto se2(std::make_shared<base::SE2StateSpace>());
+    base::RealVectorBounds bounds(2);
+    bounds.setLow(-10);
+    bounds.setHigh(10);
+    se2->setBounds(bounds);
+    si = planarSpaceInformation(se2);
+    checkPropagation(si, control::ODESolver::getStatePropagator(
+                             std::make_shared<control::ODEFixedSizeSolver<3>>(si, &planarFixedODE)));
+
+    // the dimension of the solver must match the state space
+    base::State *state = si->allocState();
+    control::Control *control = si->allocControl();
+    control::StatePropagatorPtr mismatched = control::ODESolver::getStatePropagator(
+        std::make_shared<control::ODEFixedSizeSolver<2>>(si, nullptr));
+    BOOST_CHECK_THROW(mismatched->propagate(state, control, 0.5, state), Exception);
+    si->freeControl(control);
+    si->freeState(state);
+}
+
+template <typename Solver>
+static void checkDimensions(double tolerance)
+{
+    // the steppers of a thread are shared by the solvers of the same type, so they must adapt to the
+    // dimension of each state they integrate
+    for (unsigned int dim : {2u, 9u, 3u, 17u})
+    {
+        auto rv(std::make_shared<base::RealVectorStateSpace>(dim));
+        rv->setBounds(-10, 10);
+        auto si = planarSpaceInformation(rv);
+        si->setStatePropagator(control::ODESolver::getStatePropagator(std::make_shared<Solver>(si, &unitODE)));
+        si->setup();
+
+        base::State *state = si->allocState();
+        control::Control *control = si->allocControl();
+        for (unsigned int d = 0; d < dim; ++d)
+            state->as<base::RealVectorStateSpace::StateType>()->values[d] = d;
+        si->getStatePropagator()->propagate(state, control, 0.5, state);
+        for (unsigned int d = 0; d < dim; ++d)
+            BOOST_CHECK_SMALL(state->as<base::RealVectorStateSpace::StateType>()->values[d] - d - 0.5, tolerance);
+        si->freeControl(control);
+        si->freeState(state);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SolversOfDifferentDimensions)
+{
+    checkDimensions<control::ODEBasicSolver<>>(1e-9);
+    // the error solver takes fixed steps until it passes the duration
+    checkDimensions<control::ODEErrorSolver<>>(0.02);
+}
+
+BOOST_AUTO_TEST_CASE(BatchSolver)
+{
+    auto rv(std::make_shared<base::RealVectorStateSpace>(3));
+    rv->setBounds(-10, 10);
+    auto si = planarSpaceInformation(rv);
+    control::StatePropagatorPtr propagator = control::ODESolver::getStatePropagator(
+        std::make_shared<control::ODEBatchSolver<>>(si, &planarBatchODE));
+    checkPropagation(si, propagator);
+
+    const unsigned int n = 5;
+    std::vector<const base::State *> states;
+    std::vector<const control::Control *> controls;
+    std::vector<base::State *> results;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        base::State *state = si->allocState();
+        control::Control *control = si->allocControl();
+        for (unsigned int d = 0; d < 3; ++d)
+            state->as<base::RealVectorStateSpace::StateType>()->values[d] = i + d;
+        control->as<control::RealVectorControlSpace::ControlType>()->values[0] = i;
+        control->as<control::RealVectorControlSpace::ControlType>()->values[1] = -(double)i;
+        states.push_back(state);
+        controls.push_back(control);
+        results.push_back(si->allocState());
+    }
+
+    propagator->propagateBatch(states, controls, 0.5, results);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        const double *values = results[i]->as<base::RealVectorStateSpace::StateType>()->values;
+        BOOST_CHECK_SMALL(values[0] - (i + 0.5 * i), 1e-9);
+        BOOST_CHECK_SMALL(values[1] - (i + 1 - 0.5 * i), 1e-9);
+        BOOST_CHECK_SMALL(values[2] - (i + 2), 1e-9);
+    }
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        si->freeState(const_cast<base::State *>(states[i]));
+        si->freeControl(const_cast<control::Control *>(controls[i]));
+        si->freeState(results[i]);
+    }
+}
@@ -36,10 +36,19 @@
 
 #define BOOST_TEST_MODULE "Heap"
 #include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+#include <algorithm>
+#include <map>
+#include <memory>
 #include "ompl/datastructures/BinaryHeap.h"
+#include "ompl/datastructures/DAryHeap.h"
+#include "ompl/datastructures/PairingHeap.h"
+#include "ompl/util/RandomNumbers.h"
 
 using namespace ompl;
 
+using HeapTypes = boost::mpl::list<BinaryHeap<int>, DAryHeap<int>, DAryHeap<int, std::less<int>, 2>, PairingHeap<int>>;
+
 BOOST_AUTO_TEST_CASE(Simple)
 {
     BinaryHeap<int> h;
@@ -86,3 +95,151 @@ BOOST_AUTO_TEST_CASE(Simple)
     h.insert(-1);
     BOOST_CHECK(h.top()->data == -1);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SimpleHeaps, Heap, HeapTypes)
+{
+    Heap h;
+    BOOST_CHECK(h.empty());
+    h.insert(2);
+    BOOST_CHECK(h.size() == 1);
+    typename Heap::Element *e2 = h.insert(3);
+    typename Heap::Element *e3 = h.insert(1);
+    BOOST_CHECK(h.size() == 3);
+
+    BOOST_CHECK(h.top() == e3);
+    h.insert(9);
+    h.insert(-2);
+    h.insert(5);
+    h.remove(e3);
+    BOOST_CHECK(h.size() == 5);
+    BOOST_CHECK(h.top()->data == -2);
+    e2->data = -5;
+    h.update(e2);
+    BOOST_CHECK(h.top()->data == -5);
+
+    std::vector<int> s;
+    h.getContent(s);
+    h.sort(s);
+    BOOST_CHECK(s.size() == 5);
+
+    BOOST_CHECK_EQUAL(-5, s[0]);
+    BOOST_CHECK_EQUAL(-2, s[1]);
+    BOOST_CHECK_EQUAL(2, s[2]);
+    BOOST_CHECK_EQUAL(5, s[3]);
+    BOOST_CHECK_EQUAL(9, s[4]);
+    h.clear();
+    BOOST_CHECK(h.empty());
+    BOOST_CHECK(h.empty());
+    h.insert(2);
+    typename Heap::Element *eY = h.insert(2);
+    h.insert(2);
+    typename Heap::Element *eX = h.insert(1);
+    BOOST_CHECK(h.top()->data == 1);
+    h.remove(eY);
+    BOOST_CHECK(h.top()->data == 1);
+    h.remove(eX);
+    BOOST_CHECK(h.top()->data == 2);
+    h.insert(-1);
+    BOOST_CHECK(h.top()->data == -1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(RandomOperations, Heap, HeapTypes)
+{
+    // apply random insertions, removals and updates, and compare the top of the heap to a multimap
+    Heap h;
+    std::multimap<int, typename Heap::Element *> reference;
+    RNG rng;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        double r = rng.uniform01();
+        if (reference.empty() || r < 0.4)
+        {
+            int key = rng.uniformInt(-1000, 1000);
+            reference.emplace(key, h.insert(key));
+        }
+        else if (r < 0.55)
+        {
+            auto range = reference.equal_range(h.top()->data);
+            auto it = std::find_if(range.first, range.second, [&h](const std::pair<const int, typename Heap::Element *> &entry)
+                                   {
+                                       return entry.second == h.top();
+                                   });
+            BOOST_REQUIRE(it != range.second);
+            reference.erase(it);
+            h.pop();
+        }
+        else
+        {
+            auto it = reference.begin();
+            std::advance(it, rng.uniformInt(0, reference.size() - 1));
+            typename Heap::Element *element = it->second;
+            reference.erase(it);
+            if (r < 0.8)
+                h.remove(element);
+            else
+            {
+                element->data = rng.uniformInt(-1000, 1000);
+                h.update(element);
+                reference.emplace(element->data, element);
+            }
+        }
+        BOOST_REQUIRE_EQUAL(h.size(), reference.size());
+        if (!reference.empty())
+            BOOST_REQUIRE_EQUAL(h.top()->data, reference.begin()->first);
+    }
+
+    std::vector<int> content;
+    h.getContent(content);
+    BOOST_CHECK_EQUAL(content.size(), reference.size());
+
+    // all elements leave the heap in order
+    h.rebuild();
+    for (auto &entry : reference)
+    {
+        BOOST_REQUIRE(!h.empty());
+        BOOST_CHECK_EQUAL(h.top()->data, entry.first);
+        h.pop();
+    }
+    BOOST_CHECK(h.empty());
+}
+
+using TopHeapTypes = boost::mpl::list<BinaryHeap<int>, DAryHeap<int>>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GetTop, Heap, TopHeapTypes)
+{
+    // the smallest elements are reported in order without modifying the heap
+    Heap h;
+    RNG rng;
+    std::vector<int> content;
+    for (int i = 0; i < 1000; ++i)
+        content.push_back(h.insert(rng.uniformInt(-1000, 1000))->data);
+    std::sort(content.begin(), content.end());
+
+    std::vector<typename Heap::Element *> top;
+    h.getTop(50, top);
+    BOOST_REQUIRE_EQUAL(top.size(), 50u);
+    for (std::size_t i = 0; i < top.size(); ++i)
+        BOOST_CHECK_EQUAL(top[i]->data, content[i]);
+    BOOST_CHECK_EQUAL(h.size(), 1000u);
+    BOOST_CHECK(h.top() == top[0]);
+
+    top.clear();
+    h.getTop(2000, top);
+    BOOST_CHECK_EQUAL(top.size(), 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(RecycledElementsReleaseData)
+{
+    // removed data is not kept alive by the heap
+    auto data = std::make_shared<int>(1);
+    std::weak_ptr<int> observer(data);
+    auto compare = [](const std::shared_ptr<int> &a, const std::shared_ptr<int> &b) { return *a < *b; };
+    DAryHeap<std::shared_ptr<int>, std::function<bool(const std::shared_ptr<int> &, const std::shared_ptr<int> &)>>
+        h(compare);
+    h.insert(data);
+    data.reset();
+    BOOST_CHECK(!observer.expired());
+    h.pop();
+    BOOST_CHECK(observer.expired());
+}
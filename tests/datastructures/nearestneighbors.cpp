@@ -38,18 +38,25 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
 #include <unordered_set>
 
 #include "ompl/config.h"
 #include "ompl/datastructures/NearestNeighborsSqrtApprox.h"
 #include "ompl/datastructures/NearestNeighborsGNAT.h"
 #include "ompl/datastructures/NearestNeighborsGNATNoThreadSafety.h"
+#include "ompl/datastructures/NearestNeighborsConcurrentGNAT.h"
+#include "ompl/datastructures/NearestNeighborsKDTree.h"
 #if OMPL_HAVE_FLANN
 #include "ompl/datastructures/NearestNeighborsFLANN.h"
 #endif
 #include "ompl/base/ScopedState.h"
 #include "ompl/base/spaces/DiscreteStateSpace.h"
+#include "ompl/base/spaces/SE2StateSpace.h"
 #include "ompl/base/spaces/SE3StateSpace.h"
+#include "ompl/util/Time.h"
 
 using namespace ompl;
 
@@ -101,6 +108,14 @@ public:
     {
     }
 };
+template<typename _T>
+class NearestNeighborsConcurrentGNATs : public NearestNeighborsConcurrentGNAT<_T>
+{
+public:
+    NearestNeighborsConcurrentGNATs() : NearestNeighborsConcurrentGNAT<_T>(8,4,2,6,5,5)
+    {
+    }
+};
 
 
 NearestNeighborConfig nnConfig;
@@ -114,7 +129,26 @@ bool find(base::State* s, std::vector<base::State*> states)
     return false;
 }
 
-void stateSpaceTest(base::StateSpace& space, NearestNeighbors<base::State*>& proximity, bool approximate=false)
+// Let proximity keep the states packed, with the distance kernels of the space
+void setPackedDistance(const base::StateSpace& space, NearestNeighbors<base::State*>& proximity)
+{
+    NearestNeighbors<base::State*>::PackedDistance packedDist;
+    packedDist.valueCount = space.getPackedValueCount();
+    packedDist.pack = [&space](base::State * const &a, double *values, std::size_t stride)
+        {
+            space.packState(a, values, stride);
+        };
+    packedDist.distances = [&space](base::State * const &a, const double *values, std::size_t stride,
+        std::size_t count, double *dist)
+        {
+            std::fill(dist, dist + count, 0.);
+            space.accumulatePackedDistances(a, values, stride, count, 1., dist);
+        };
+    proximity.setPackedDistance(packedDist);
+}
+
+void stateSpaceTest(base::StateSpace& space, NearestNeighbors<base::State*>& proximity, bool approximate=false,
+    bool batch=false, bool packed=false)
 {
     int i, j;
     base::StateSamplerPtr sampler(space.allocStateSampler());
@@ -130,6 +164,14 @@ void stateSpaceTest(base::StateSpace& space, NearestNeighbors<base::State*>& pro
         {
             return space.distance(a, b);
         });
+    if (batch)
+        proximity.setBatchDistanceFunction(
+            [&space](const base::State *a, base::State * const *b, std::size_t count, double *dist)
+            {
+                space.distanceBatch(a, b, count, dist);
+            });
+    if (packed)
+        setPackedDistance(space, proximity);
 
     for(i=0; i<n; ++i)
     {
@@ -312,6 +354,346 @@ NN_TEST_CASES(Linear, false)
 NN_TEST_CASES(SqrtApprox, true)
 NN_TEST_CASES(GNATs, false)
 NN_TEST_CASES(GNATNoThreadSafetys, false)
+#define NN_BATCH_TEST_CASES(T)                                \
+BOOST_AUTO_TEST_CASE(BatchInt##T)                             \
+{                                                             \
+    NearestNeighbors##T<base::State*> proximity;              \
+    stateSpaceTest(nnConfig.space0, proximity, false, true);  \
+}                                                             \
+BOOST_AUTO_TEST_CASE(BatchSE3##T)                             \
+{                                                             \
+    NearestNeighbors##T<base::State*> proximity;              \
+    stateSpaceTest(nnConfig.space1, proximity, false, true);  \
+}
+
+NN_BATCH_TEST_CASES(Linear)
+NN_BATCH_TEST_CASES(GNATs)
+NN_BATCH_TEST_CASES(GNATNoThreadSafetys)
+
+BOOST_AUTO_TEST_CASE(PackedSE3Linear)
+{
+    NearestNeighborsLinear<base::State*> proximity;
+    stateSpaceTest(nnConfig.space1, proximity, false, false, true);
+}
+BOOST_AUTO_TEST_CASE(PackedSE3SqrtApprox)
+{
+    NearestNeighborsSqrtApprox<base::State*> proximity;
+    stateSpaceTest(nnConfig.space1, proximity, true, false, true);
+}
+
+// The packed states must give the same answers as the distance function, also after removals in the middle
+// and when the packing is enabled after states were added
+BOOST_AUTO_TEST_CASE(PackedMatchesUnpacked)
+{
+    base::SE3StateSpace &space = nnConfig.space1;
+    base::StateSamplerPtr sampler(space.allocStateSampler());
+    auto distFun = [&space](const base::State *a, const base::State *b) { return space.distance(a, b); };
+    NearestNeighborsLinear<base::State*> linear, packedLinear;
+    NearestNeighborsSqrtApprox<base::State*> sqrtApprox, packedSqrtApprox;
+    std::vector<NearestNeighbors<base::State*>*> all = {&linear, &packedLinear, &sqrtApprox, &packedSqrtApprox};
+    for (auto *proximity : all)
+        proximity->setDistanceFunction(distFun);
+
+    std::vector<base::State*> states(n), nghbr, nghbrPacked;
+    for (auto &state : states)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    packedLinear.add(std::vector<base::State*>(states.begin(), states.begin() + n / 2));
+    setPackedDistance(space, packedLinear);
+    packedLinear.add(std::vector<base::State*>(states.begin() + n / 2, states.end()));
+    setPackedDistance(space, packedSqrtApprox);
+    linear.add(states);
+    sqrtApprox.add(states);
+    packedSqrtApprox.add(states);
+    for (int i = 0; i < n; i += 3)
+        for (auto *proximity : all)
+            proximity->remove(states[i]);
+
+    base::State *query = space.allocState();
+    for (int i = 0; i < n; ++i)
+    {
+        sampler->sampleUniform(query);
+        BOOST_CHECK_EQUAL(linear.nearest(query), packedLinear.nearest(query));
+        BOOST_CHECK_EQUAL(sqrtApprox.nearest(query), packedSqrtApprox.nearest(query));
+        linear.nearestK(query, k, nghbr);
+        packedLinear.nearestK(query, k, nghbrPacked);
+        BOOST_CHECK(nghbr == nghbrPacked);
+        linear.nearestR(query, 1., nghbr);
+        packedLinear.nearestR(query, 1., nghbrPacked);
+        BOOST_CHECK(nghbr == nghbrPacked);
+    }
+    space.freeState(query);
+    for (auto &state : states)
+        space.freeState(state);
+}
+
+NN_TEST_CASES(ConcurrentGNATs, false)
+
+// Add half of the states up front; then let threadCount threads add the other half while running
+// k-nearest neighbor queries. Check the final contents against a linear search and return the time
+// spent by the threads.
+double concurrentAccessTest(base::StateSpace& space, NearestNeighbors<base::State*>& proximity,
+    unsigned int threadCount)
+{
+    const std::size_t total = 20 * n, queries = 100 * n;
+    base::StateSamplerPtr sampler(space.allocStateSampler());
+    std::vector<base::State*> states(total), qstates(queries);
+    NearestNeighborsLinear<base::State*> proximityLinear;
+
+    proximity.setDistanceFunction([&space](const base::State *a, const base::State *b)
+        {
+            return space.distance(a, b);
+        });
+    proximityLinear.setDistanceFunction([&space](const base::State *a, const base::State *b)
+        {
+            return space.distance(a, b);
+        });
+    for (auto & state : states)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    for (auto & state : qstates)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    proximity.add(std::vector<base::State*>(states.begin(), states.begin() + total / 2));
+    proximityLinear.add(states);
+
+    // Boost.Test assertions are not thread safe, so the threads only count short results
+    std::atomic<unsigned int> shortResults(0);
+    ompl::time::point start = ompl::time::now();
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0 ; t < threadCount ; ++t)
+        threads.emplace_back([&, t]
+            {
+                std::vector<base::State*> nbh;
+                for (std::size_t i = total / 2 + t ; i < total ; i += threadCount)
+                    proximity.add(states[i]);
+                for (std::size_t i = t ; i < queries ; i += threadCount)
+                {
+                    proximity.nearestK(qstates[i], k, nbh);
+                    if (nbh.size() != (unsigned int)k)
+                        ++shortResults;
+                }
+            });
+    for (auto & thread : threads)
+        thread.join();
+    double elapsed = ompl::time::seconds(ompl::time::now() - start);
+    BOOST_CHECK_EQUAL(shortResults.load(), 0u);
+
+    BOOST_CHECK_EQUAL(proximity.size(), total);
+    std::vector<base::State*> nbh, nbhGroundTruth;
+    for (std::size_t i = 0 ; i < queries ; i += 50)
+    {
+        proximity.nearestK(qstates[i], k, nbh);
+        proximityLinear.nearestK(qstates[i], k, nbhGroundTruth);
+        BOOST_REQUIRE_EQUAL(nbh.size(), nbhGroundTruth.size());
+        for (std::size_t j = 0 ; j < nbh.size() ; ++j)
+            BOOST_OMPL_EXPECT_NEAR(space.distance(qstates[i], nbh[j]),
+                space.distance(qstates[i], nbhGroundTruth[j]), eps);
+    }
+
+    for (auto & state : states)
+        space.freeState(state);
+    for (auto & state : qstates)
+        space.freeState(state);
+    return elapsed;
+}
+
+// Reports how the time taken by concurrent additions and queries scales with the number of threads.
+// Timings depend on the machine, so only the results are checked.
+BOOST_AUTO_TEST_CASE(ConcurrentGNATThreadScaling)
+{
+    for (unsigned int threadCount : {1u, 2u, 4u, 8u})
+    {
+        NearestNeighborsConcurrentGNAT<base::State*> proximity;
+        BOOST_CHECK(proximity.supportsConcurrentAccess());
+        double elapsed = concurrentAccessTest(nnConfig.space1, proximity, threadCount);
+        std::cout << "NearestNeighborsConcurrentGNAT: concurrent adds and queries with " << threadCount
+            << " thread(s) took " << elapsed << " seconds" << std::endl;
+    }
+}
+
+// The kd-tree indexes the packed coordinates of the states of a given space; the test spaces are
+// owned by the fixture, so they are wrapped in shared pointers that do not delete them. Leaves are
+// kept small so that splits are exercised.
+base::StateSpacePtr unownedSpace(base::StateSpace& space)
+{
+    return base::StateSpacePtr(&space, [](base::StateSpace *) {});
+}
+
+NearestNeighborsKDTree<base::State*> makeKDTree(base::StateSpace& space)
+{
+    return NearestNeighborsKDTree<base::State*>(unownedSpace(space),
+        [](base::State * const &s) -> const base::State * { return s; }, 4);
+}
+
+BOOST_AUTO_TEST_CASE(SE3KDTree)
+{
+    NearestNeighborsKDTree<base::State*> proximity = makeKDTree(nnConfig.space1);
+    stateSpaceTest(nnConfig.space1, proximity);
+}
+
+BOOST_AUTO_TEST_CASE(RandomAccessPatternSE3KDTree)
+{
+    NearestNeighborsKDTree<base::State*> proximity = makeKDTree(nnConfig.space1);
+    randomAccessPatternTest(nnConfig.space1, proximity);
+}
+
+BOOST_AUTO_TEST_CASE(SE2KDTree)
+{
+    // the rotation is sampled over the whole circle, so the tree has to account for wrap-around
+    base::SE2StateSpace space;
+    base::RealVectorBounds b(2);
+    b.setLow(0);
+    b.setHigh(1);
+    space.setBounds(b);
+    NearestNeighborsKDTree<base::State*> proximity = makeKDTree(space);
+    stateSpaceTest(space, proximity);
+    randomAccessPatternTest(space, proximity);
+}
+
+BOOST_AUTO_TEST_CASE(RealVectorKDTree)
+{
+    base::RealVectorStateSpace space(5);
+    space.setBounds(-1, 1);
+    NearestNeighborsKDTree<base::State*> proximity = makeKDTree(space);
+    stateSpaceTest(space, proximity);
+    randomAccessPatternTest(space, proximity);
+}
+
+BOOST_AUTO_TEST_CASE(UnsupportedSpaceKDTree)
+{
+    BOOST_CHECK(!NearestNeighborsKDTree<base::State*>::isSpaceSupported(unownedSpace(nnConfig.space0)));
+    BOOST_CHECK_THROW(makeKDTree(nnConfig.space0), ompl::Exception);
+}
+
+// With approximation factor epsilon, the k-th neighbor may be up to (1 + epsilon) times farther than the
+// true k-th nearest neighbor, and range queries must report every element within radius / (1 + epsilon)
+// but nothing outside the radius.
+void approximateSearchTest(base::StateSpace& space, NearestNeighbors<base::State*>& proximity, double epsilon)
+{
+    RNG rng;
+    base::StateSamplerPtr sampler(space.allocStateSampler());
+    std::vector<base::State*> states(10 * n), nghbr, nghbrGroundTruth;
+    NearestNeighborsLinear<base::State*> proximityLinear;
+
+    BOOST_CHECK(proximity.supportsApproximateSearch());
+    BOOST_CHECK_THROW(proximity.setApproximationFactor(-1.), ompl::Exception);
+    proximity.setApproximationFactor(epsilon);
+    BOOST_CHECK_EQUAL(proximity.getApproximationFactor(), epsilon);
+    proximity.setDistanceFunction([&space](const base::State *a, const base::State *b)
+        {
+            return space.distance(a, b);
+        });
+    proximityLinear.setDistanceFunction([&space](const base::State *a, const base::State *b)
+        {
+            return space.distance(a, b);
+        });
+    for (auto & state : states)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    proximity.add(states);
+    proximityLinear.add(states);
+
+    base::State *s = space.allocState();
+    for (int i = 0; i < n; ++i)
+    {
+        sampler->sampleUniform(s);
+        proximity.nearestK(s, k, nghbr);
+        proximityLinear.nearestK(s, k, nghbrGroundTruth);
+        BOOST_REQUIRE_EQUAL(nghbr.size(), nghbrGroundTruth.size());
+        BOOST_CHECK_LE(space.distance(s, nghbr.back()),
+            (1. + epsilon) * space.distance(s, nghbrGroundTruth.back()) + eps);
+
+        double r = rng.uniformReal(0, 1);
+        proximity.nearestR(s, r, nghbr);
+        proximityLinear.nearestR(s, r / (1. + epsilon), nghbrGroundTruth);
+        BOOST_CHECK_GE(nghbr.size(), nghbrGroundTruth.size());
+        for (auto & nb : nghbr)
+            BOOST_CHECK_LE(space.distance(s, nb), r);
+    }
+    space.freeState(s);
+
+    // removal is not affected by the approximation
+    for (auto & state : states)
+        BOOST_CHECK(proximity.remove(state));
+    BOOST_CHECK_EQUAL(proximity.size(), 0u);
+    for (auto & state : states)
+        space.freeState(state);
+}
+
+BOOST_AUTO_TEST_CASE(ApproximateSearch)
+{
+    for (double epsilon : {0., .2, 1.})
+    {
+        NearestNeighborsGNATs<base::State*> gnat;
+        approximateSearchTest(nnConfig.space1, gnat, epsilon);
+        NearestNeighborsGNATNoThreadSafetys<base::State*> gnatNoThreadSafety;
+        approximateSearchTest(nnConfig.space1, gnatNoThreadSafety, epsilon);
+        NearestNeighborsConcurrentGNATs<base::State*> concurrentGnat;
+        approximateSearchTest(nnConfig.space1, concurrentGnat, epsilon);
+        NearestNeighborsKDTree<base::State*> kdTree = makeKDTree(nnConfig.space1);
+        approximateSearchTest(nnConfig.space1, kdTree, epsilon);
+    }
+}
+
+// Queries with a caller-provided context and output array must match the regular queries
+BOOST_AUTO_TEST_CASE(GNATQueryContext)
+{
+    base::StateSpace& space = nnConfig.space1;
+    base::StateSamplerPtr sampler(space.allocStateSampler());
+    std::vector<base::State*> states(10 * n), nghbr, nghbrContext;
+    NearestNeighborsGNATs<base::State*> proximity;
+    NearestNeighborsGNATs<base::State*>::QueryContext context;
+    base::State* buffer[k];
+
+    proximity.setDistanceFunction([&space](const base::State *a, const base::State *b)
+        {
+            return space.distance(a, b);
+        });
+    for (auto & state : states)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    proximity.add(states);
+
+    base::State *s = space.allocState();
+    for (int i = 0; i < n; ++i)
+    {
+        sampler->sampleUniform(s);
+        proximity.nearestK(s, k, nghbr);
+        proximity.nearestK(s, k, nghbrContext, context);
+        BOOST_CHECK(nghbr == nghbrContext);
+
+        BOOST_REQUIRE_EQUAL(proximity.nearestK(s, k, buffer, context), (std::size_t)k);
+        BOOST_CHECK(std::equal(nghbr.begin(), nghbr.end(), buffer));
+        BOOST_REQUIRE_EQUAL(proximity.nearestK(s, k, buffer), (std::size_t)k);
+        BOOST_CHECK(std::equal(nghbr.begin(), nghbr.end(), buffer));
+
+        proximity.nearestR(s, .5, nghbr);
+        proximity.nearestR(s, .5, nghbrContext, context);
+        BOOST_CHECK(nghbr == nghbrContext);
+    }
+    // fewer elements than requested neighbors
+    NearestNeighborsGNATs<base::State*> small;
+    small.setDistanceFunction(proximity.getDistanceFunction());
+    small.add(std::vector<base::State*>(states.begin(), states.begin() + k / 2));
+    BOOST_CHECK_EQUAL(small.nearestK(s, k, buffer, context), (std::size_t)(k / 2));
+    BOOST_CHECK_EQUAL(small.nearestK(s, 0, buffer, context), 0u);
+
+    space.freeState(s);
+    for (auto & state : states)
+        space.freeState(state);
+}
+
 #if OMPL_HAVE_FLANN
 NN_TEST_CASES(FLANNLinear, false)
 NN_TEST_CASES(FLANNHierarchicalClustering, true)
@@ -341,6 +341,18 @@ protected:
     }
 };
 
+class ParallelAITstarTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) const override
+    {
+        auto aitstar(std::make_shared<geometric::AITstar>(si));
+        aitstar->setThreadCount(4);
+        return aitstar;
+    }
+};
+
 class BITstarTest : public TestPlanner
 {
 protected:
@@ -351,6 +363,18 @@ protected:
     }
 };
 
+class ParallelBITstarTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) const override
+    {
+        auto bitstar(std::make_shared<geometric::BITstar>(si));
+        bitstar->setThreadCount(4);
+        return bitstar;
+    }
+};
+
 class ABITstarTest : public TestPlanner
 {
 protected:
@@ -417,7 +441,9 @@ BOOST_FIXTURE_TEST_SUITE(MyPlanTestFixture, PlanTest)
 
 OMPL_PLANNER_TEST(ABITstar)
 OMPL_PLANNER_TEST(AITstar)
+OMPL_PLANNER_TEST(ParallelAITstar)
 OMPL_PLANNER_TEST(BITstar)
+OMPL_PLANNER_TEST(ParallelBITstar)
 OMPL_PLANNER_TEST(CForest)
 OMPL_PLANNER_TEST(PRM)
 OMPL_PLANNER_TEST(PRMstar)
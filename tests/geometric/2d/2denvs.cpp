@@ -503,6 +503,18 @@ protected:
     }
 };
 
+class ParallelPRMTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        auto prm(std::make_shared<geometric::PRM>(si));
+        prm->setThreadCount(2);
+        return prm;
+    }
+};
+
 class PRMstarTest : public TestPlanner
 {
 protected:
@@ -538,6 +550,19 @@ protected:
 
 };
 
+class ParallelLazyPRMstarTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        auto prm(std::make_shared<geometric::LazyPRMstar>(si));
+        prm->setValidationThreads(2);
+        return prm;
+    }
+
+};
+
 class SPARSTest : public TestPlanner
 {
 protected:
@@ -758,9 +783,11 @@ OMPL_PLANNER_TEST(EST, 95.0, 0.02)
 OMPL_PLANNER_TEST(STRIDE, 95.0, 0.02)
 
 OMPL_PLANNER_TEST(PRM, 95.0, 0.04)
+OMPL_PLANNER_TEST(ParallelPRM, 95.0, 0.04)
 OMPL_PLANNER_TEST(PRMstar, 95.0, 0.04)
 //OMPL_PLANNER_TEST(LazyPRM, 98.0, 0.04)
 OMPL_PLANNER_TEST(LazyPRMstar, 95.0, 0.04)
+OMPL_PLANNER_TEST(ParallelLazyPRMstar, 95.0, 0.04)
 OMPL_PLANNER_TEST(SPARS, 95.0, 0.04)
 OMPL_PLANNER_TEST(SPARStwo, 95.0, 0.04)
 
@@ -38,6 +38,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <thread>
 
 #include <ompl/base/Constraint.h>
 #include <ompl/base/ConstrainedSpaceInformation.h>
@@ -452,3 +453,175 @@ OMPL_PLANNER_TEST(PRM, AT, 95.0, 1.0)
 OMPL_PLANNER_TEST(PRM, TB, 95.0, 1.0)
 
 BOOST_AUTO_TEST_SUITE_END()
+
+/* A constraint of co-dimension 4 in R^6 that uses the numerical Jacobian */
+class Parabolas : public ob::Constraint
+{
+public:
+    Parabolas() : ob::Constraint(6, 4)
+    {
+    }
+
+    void function(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> out) const override
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+            out[i] = x[i] + x[i + 1] * x[i + 1] - 1;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(ProjectionSolvers)
+{
+    const std::vector<ob::Constraint::ProjectionSolver> solvers = {
+        ob::Constraint::ProjectionSolver::SVD, ob::Constraint::ProjectionSolver::QR,
+        ob::Constraint::ProjectionSolver::LDLT, ob::Constraint::ProjectionSolver::BROYDEN};
+    const std::vector<ob::ConstraintPtr> constraints = {std::make_shared<Sphere>(), std::make_shared<Parabolas>()};
+
+    for (const auto &constraint : constraints)
+    {
+        BOOST_CHECK(constraint->getProjectionSolver() == ob::Constraint::ProjectionSolver::SVD);
+        const bool numerical = constraint == constraints.back();
+        std::vector<ob::Constraint::ProjectionStatistics> statistics;
+        for (const auto solver : solvers)
+        {
+            RNG rng(1);
+            constraint->setProjectionSolver(solver);
+            constraint->clearProjectionStatistics();
+
+            Eigen::VectorXd x(constraint->getAmbientDimension());
+            for (unsigned int i = 0; i < 50; ++i)
+            {
+                for (unsigned int j = 0; j < x.size(); ++j)
+                    x[j] = rng.uniformReal(-1.0, 1.0);
+                BOOST_CHECK(constraint->project(x));
+                BOOST_CHECK(constraint->isSatisfied(x));
+            }
+            statistics.push_back(constraint->getProjectionStatistics());
+            BOOST_CHECK_EQUAL(statistics.back().projections, 50u);
+            BOOST_CHECK_EQUAL(statistics.back().failures, 0u);
+            BOOST_CHECK(statistics.back().jacobianEvaluations <= statistics.back().iterations);
+        }
+
+        // Newton steps do not depend on how the linear system is solved
+        BOOST_CHECK_EQUAL(statistics[0].iterations, statistics[1].iterations);
+        BOOST_CHECK_EQUAL(statistics[0].iterations, statistics[2].iterations);
+        BOOST_CHECK_EQUAL(statistics[2].jacobianEvaluations, statistics[2].iterations);
+        // while Broyden's method evaluates the Jacobian less often when Newton's method needs several steps
+        if (numerical)
+            BOOST_CHECK(statistics[3].jacobianEvaluations < statistics[2].jacobianEvaluations);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ProjectionStatisticsThreads)
+{
+    auto constraint = std::make_shared<Sphere>();
+    Eigen::VectorXd y = Eigen::VectorXd::Ones(3);
+    constraint->project(y);
+    constraint->clearProjectionStatistics();
+
+    // Projections of threads that are still running and of threads that exited are counted
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < 4; ++t)
+        threads.emplace_back([&constraint, t]
+                             {
+                                 RNG rng(t + 1);
+                                 Eigen::VectorXd x(3);
+                                 for (unsigned int i = 0; i < 100; ++i)
+                                 {
+                                     for (unsigned int j = 0; j < 3; ++j)
+                                         x[j] = rng.uniformReal(-1.0, 1.0);
+                                     constraint->project(x);
+                                 }
+                             });
+    for (auto &thread : threads)
+        thread.join();
+    constraint->project(y);
+    BOOST_CHECK_EQUAL(constraint->getProjectionStatistics().projections, 401u);
+
+    constraint->clearProjectionStatistics();
+    BOOST_CHECK_EQUAL(constraint->getProjectionStatistics().projections, 0u);
+    constraint->project(y);
+    BOOST_CHECK_EQUAL(constraint->getProjectionStatistics().projections, 1u);
+
+    // A copy starts with cleared statistics
+    Sphere copy(*constraint);
+    BOOST_CHECK_EQUAL(copy.getProjectionStatistics().projections, 0u);
+    copy.project(y);
+    BOOST_CHECK_EQUAL(copy.getProjectionStatistics().projections, 1u);
+    BOOST_CHECK_EQUAL(constraint->getProjectionStatistics().projections, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(GeodesicCache)
+{
+    auto space(std::make_shared<ob::RealVectorStateSpace>(3));
+    ob::RealVectorBounds bounds(3);
+    bounds.setLow(-2);
+    bounds.setHigh(2);
+    space->setBounds(bounds);
+
+    auto css(std::make_shared<ob::ProjectedStateSpace>(space, std::make_shared<Sphere>()));
+    auto csi(std::make_shared<ob::ConstrainedSpaceInformation>(css));
+    csi->setStateValidityChecker(isValid);
+    csi->setup();
+
+    ob::ConstrainedMotionValidator unbatched(csi);
+    ob::ConstrainedMotionValidator batched(csi);
+    batched.setBatchSize(4);
+
+    ob::StateSamplerPtr sampler = css->allocStateSampler();
+    ob::State *s1 = css->allocState();
+    ob::State *s2 = css->allocState();
+    ob::State *a = css->allocState();
+    ob::State *b = css->allocState();
+    std::pair<ob::State *, double> lastA(css->allocState(), 0.);
+    std::pair<ob::State *, double> lastB(css->allocState(), 0.);
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        css->setGeodesicCacheSize(0);
+        sampler->sampleUniform(s1);
+        sampler->sampleUniformNear(s2, s1, 0.5);
+        css->interpolate(s1, s2, 0.5, a);
+        bool valid = unbatched.checkMotion(s1, s2);
+        bool reached = unbatched.checkMotion(s1, s2, lastA);
+
+        // Batched validation gives the same results
+        BOOST_CHECK_EQUAL(batched.checkMotion(s1, s2), valid);
+        BOOST_CHECK_EQUAL(batched.checkMotion(s1, s2, lastB), reached);
+        if (!reached)
+            BOOST_CHECK(css->equalStates(lastA.first, lastB.first));
+
+        // and so does interpolation along cached geodesics
+        css->setGeodesicCacheSize(10000);
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            css->interpolate(s1, s2, 0.5, b);
+            BOOST_CHECK(css->equalStates(a, b));
+            BOOST_CHECK_EQUAL(unbatched.checkMotion(s1, s2), valid);
+        }
+        ob::GeodesicCache *cache = css->getGeodesicCache();
+        BOOST_REQUIRE(cache != nullptr);
+        BOOST_CHECK_EQUAL(cache->getMisses(), 1u);
+        BOOST_CHECK_EQUAL(cache->getHits(), 5u);
+
+        // A geodesic is recomputed when its endpoints change
+        sampler->sampleUniformNear(s2, s1, 0.5);
+        css->interpolate(s1, s2, 0.5, b);
+        BOOST_CHECK_EQUAL(cache->getMisses(), 2u);
+        BOOST_CHECK_EQUAL(cache->getHits(), 5u);
+    }
+
+    // The cache stays within its capacity
+    css->setGeodesicCacheSize(50);
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        sampler->sampleUniform(s1);
+        sampler->sampleUniformNear(s2, s1, 0.5);
+        css->interpolate(s1, s2, 0.5, a);
+        BOOST_CHECK(css->getGeodesicCache()->getStateCount() <= 50u);
+    }
+    css->clear();
+    BOOST_CHECK_EQUAL(css->getGeodesicCache()->getStateCount(), 0u);
+
+    for (auto s : {s1, s2, a, b, lastA.first, lastB.first})
+        css->freeState(s);
+}
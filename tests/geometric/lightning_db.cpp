@@ -0,0 +1,264 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#define BOOST_TEST_MODULE "LightningDB"
+#include <boost/test/unit_test.hpp>
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+
+#include "ompl/base/ScopedState.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/planners/experience/LightningRetrieveRepair.h"
+#include "ompl/geometric/planners/rrt/RRTConnect.h"
+#include "ompl/tools/lightning/LightningDB.h"
+#include "ompl/util/RandomNumbers.h"
+
+using namespace ompl;
+
+/* Create a random path of 2 to 10 states in the unit square */
+static geometric::PathGeometric randomPath(const base::SpaceInformationPtr &si, RNG &rng)
+{
+    geometric::PathGeometric path(si);
+    base::ScopedState<base::RealVectorStateSpace> state(si);
+    const int count = rng.uniformInt(2, 10);
+    for (int i = 0; i < count; ++i)
+    {
+        state[0] = rng.uniform01();
+        state[1] = rng.uniform01();
+        path.append(state.get());
+    }
+    return path;
+}
+
+static bool samePath(const base::SpaceInformationPtr &si, const geometric::PathGeometric &path,
+                     const base::PlannerDataPtr &data)
+{
+    if (path.getStateCount() != data->numVertices())
+        return false;
+    for (std::size_t i = 0; i < path.getStateCount(); ++i)
+        if (!si->equalStates(path.getState(i), data->getVertex(i).getState()))
+            return false;
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(StoreSaveLoad)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    RNG rng(3);
+    const std::string filename = "lightning_db_test.db";
+
+    std::vector<geometric::PathGeometric> paths;
+    std::size_t states = 0;
+    tools::LightningDB db(space);
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        paths.push_back(randomPath(si, rng));
+        states += paths.back().getStateCount();
+        double time;
+        db.addPath(paths.back(), time);
+    }
+    BOOST_CHECK_EQUAL(db.getExperiencesCount(), 20u);
+    BOOST_CHECK_EQUAL(db.getStatesCount(), states);
+    BOOST_CHECK_EQUAL(db.getNumUnsavedPaths(), 20);
+
+    // the retrieved paths are the nearest ones, in either direction
+    base::ScopedState<base::RealVectorStateSpace> start(si), goal(si);
+    start[0] = start[1] = 0.2;
+    goal[0] = goal[1] = 0.8;
+    std::vector<double> distances;
+    for (const auto &path : paths)
+    {
+        const base::State *s = path.getState(0), *g = path.getState(path.getStateCount() - 1);
+        distances.push_back(std::min(si->distance(start.get(), s) + si->distance(goal.get(), g),
+                                     si->distance(start.get(), g) + si->distance(goal.get(), s)));
+    }
+    std::vector<double> sorted(distances);
+    std::sort(sorted.begin(), sorted.end());
+    auto nearest = db.findNearestStartGoal(3, start.get(), goal.get());
+    BOOST_REQUIRE_EQUAL(nearest.size(), 3u);
+    auto best = std::find(distances.begin(), distances.end(), sorted[0]) - distances.begin();
+    BOOST_CHECK(samePath(si, paths[best], nearest[0]));
+
+    BOOST_REQUIRE(db.save(filename));
+    BOOST_CHECK_EQUAL(db.getNumUnsavedPaths(), 0);
+    const auto size = boost::filesystem::file_size(filename);
+
+    // load the database and add paths, which are appended to the file
+    tools::LightningDB loaded(space);
+    BOOST_REQUIRE(loaded.load(filename));
+    BOOST_CHECK_EQUAL(loaded.getExperiencesCount(), 20u);
+    BOOST_CHECK_EQUAL(loaded.getStatesCount(), states);
+    std::size_t added = 0;
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        paths.push_back(randomPath(si, rng));
+        added += paths.back().getStateCount();
+        loaded.addPathHelper(paths.back());
+    }
+    BOOST_REQUIRE(loaded.saveIfChanged(filename));
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(filename),
+                      size + 5 * sizeof(std::uint32_t) + added * space->getSerializationLength());
+
+    tools::LightningDB reloaded(space);
+    BOOST_REQUIRE(reloaded.load(filename));
+    std::vector<base::PlannerDataPtr> datas;
+    reloaded.getAllPlannerDatas(datas);
+    BOOST_REQUIRE_EQUAL(datas.size(), paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i)
+        BOOST_CHECK(samePath(si, paths[i], datas[i]));
+
+    // an interrupted save loses only the path that was being written
+    boost::filesystem::resize_file(filename, boost::filesystem::file_size(filename) - 3);
+    tools::LightningDB truncated(space);
+    BOOST_REQUIRE(truncated.load(filename));
+    BOOST_CHECK_EQUAL(truncated.getExperiencesCount(), 24u);
+
+    // a database for a different space is not loaded
+    tools::LightningDB other(std::make_shared<base::RealVectorStateSpace>(3));
+    BOOST_CHECK(!other.load(filename));
+    std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(LoadPlannerDatas)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    RNG rng(5);
+    const std::string filename = "lightning_db_legacy_test.db";
+
+    // write a file in the previous format: the number of paths, then each path as PlannerData
+    std::vector<geometric::PathGeometric> paths;
+    {
+        std::ofstream out(filename.c_str(), std::ios::binary);
+        double numPaths = 4;
+        out << numPaths;
+        base::PlannerDataStorage storage;
+        for (unsigned int i = 0; i < numPaths; ++i)
+        {
+            paths.push_back(randomPath(si, rng));
+            base::PlannerData data(si);
+            for (std::size_t j = 0; j < paths.back().getStateCount(); ++j)
+                data.addVertex(base::PlannerDataVertex(paths.back().getState(j)));
+            storage.store(data, out);
+        }
+    }
+
+    tools::LightningDB db(space);
+    BOOST_REQUIRE(db.load(filename));
+    std::vector<base::PlannerDataPtr> datas;
+    db.getAllPlannerDatas(datas);
+    BOOST_REQUIRE_EQUAL(datas.size(), paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i)
+        BOOST_CHECK(samePath(si, paths[i], datas[i]));
+
+    // saving converts the file to the compact format
+    BOOST_REQUIRE(db.save(filename));
+    tools::LightningDB converted(space);
+    BOOST_REQUIRE(converted.load(filename));
+    BOOST_CHECK_EQUAL(converted.getExperiencesCount(), paths.size());
+    std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(RepairCandidates)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    // a wall in the middle of the square, which paths go over
+    si->setStateValidityChecker([](const base::State *state)
+                                {
+                                    const double *v = state->as<base::RealVectorStateSpace::StateType>()->values;
+                                    return v[0] < 0.4 || v[0] > 0.6 || v[1] > 0.7;
+                                });
+    si->setup();
+
+    auto path = [&si](const std::vector<std::pair<double, double>> &points)
+    {
+        geometric::PathGeometric result(si);
+        base::ScopedState<base::RealVectorStateSpace> state(si);
+        for (const auto &p : points)
+        {
+            state[0] = p.first;
+            state[1] = p.second;
+            result.append(state.get());
+        }
+        return result;
+    };
+    auto db(std::make_shared<tools::LightningDB>(space));
+    // a path through the wall, closest to the query, and a valid path over it
+    geometric::PathGeometric through(path({{0.1, 0.1}, {0.3, 0.1}, {0.5, 0.1}, {0.7, 0.1}, {0.9, 0.1}}));
+    geometric::PathGeometric over(path({{0.1, 0.15}, {0.1, 0.9}, {0.9, 0.9}, {0.9, 0.15}}));
+    db->addPathHelper(through);
+    db->addPathHelper(over);
+
+    base::ScopedState<base::RealVectorStateSpace> start(si), goal(si);
+    start[0] = 0.1;
+    start[1] = 0.1;
+    goal[0] = 0.9;
+    goal[1] = 0.1;
+
+    for (unsigned int threads = 1; threads <= 2; ++threads)
+    {
+        for (unsigned int candidates = 1; candidates <= 2; ++candidates)
+        {
+            auto pdef(std::make_shared<base::ProblemDefinition>(si));
+            pdef->setStartAndGoalStates(start, goal);
+            geometric::LightningRetrieveRepair planner(si, db);
+            planner.setProblemDefinition(pdef);
+            planner.setNumNearestSolutions(2);
+            planner.setNumRepairCandidates(candidates);
+            // scoring and repairing on the calling thread only, unless more threads are requested
+            BOOST_CHECK_EQUAL(planner.getThreadCount(), 1u);
+            BOOST_CHECK(planner.params().setParam("threads", std::to_string(threads)));
+            BOOST_CHECK_EQUAL(planner.getThreadCount(), threads);
+            planner.setRepairPlannerAllocator([](const base::SpaceInformationPtr &si)
+                                              {
+                                                  return std::make_shared<geometric::RRTConnect>(si);
+                                              });
+            planner.setup();
+            BOOST_REQUIRE(planner.solve(base::timedPlannerTerminationCondition(10.0)));
+            BOOST_CHECK_EQUAL(planner.getLastRecalledNearestPaths().size(), 2u);
+            BOOST_CHECK(pdef->getSolutionPath()->as<geometric::PathGeometric>()->check());
+            // the path over the wall scores best and is repaired first when it is the only one
+            if (candidates == 1)
+                BOOST_CHECK_EQUAL(planner.getChosenRecallPath()->numVertices(), 4u);
+        }
+    }
+}
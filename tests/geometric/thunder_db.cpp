@@ -0,0 +1,184 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+
+#define BOOST_TEST_MODULE "ThunderDB"
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "ompl/base/ScopedState.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/tools/thunder/ThunderDB.h"
+
+using namespace ompl;
+
+/* Create a straight path across the unit square at height y */
+static geometric::PathGeometric horizontalPath(const base::SpaceInformationPtr &si, double y)
+{
+    geometric::PathGeometric path(si);
+    base::ScopedState<base::RealVectorStateSpace> state(si);
+    for (double x = 0.05; x < 1.0; x += 0.3)
+    {
+        state[0] = x;
+        state[1] = y;
+        path.append(state.get());
+    }
+    return path;
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentInsertionAndQueries)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    si->setStateValidityChecker([](const base::State *)
+                                {
+                                    return true;
+                                });
+    si->setup();
+
+    base::ScopedState<base::RealVectorStateSpace> start(si), goal(si);
+    start[0] = 0.05;
+    goal[0] = 0.95;
+    start[1] = goal[1] = 0.5;
+    auto pdef(std::make_shared<base::ProblemDefinition>(si));
+    pdef->setStartAndGoalStates(start, goal);
+
+    tools::ThunderDB db(space);
+    auto spars(std::make_shared<geometric::SPARSdb>(si));
+    spars->setProblemDefinition(pdef);
+    spars->setup();
+    db.setSPARSdb(spars);
+    BOOST_CHECK_EQUAL(db.getEpoch(), 0u);
+
+    geometric::PathGeometric first(horizontalPath(si, 0.5));
+    double insertionTime;
+    db.addPath(first, insertionTime);
+    BOOST_CHECK_EQUAL(db.getEpoch(), 1u);
+    BOOST_CHECK(!db.isEmpty());
+
+    // queries run on the published roadmap while more paths are inserted in the background
+    std::atomic<bool> inserting(true);
+    std::atomic<unsigned int> queries(0), found(0);
+    std::thread query([&]
+                      {
+                          do
+                          {
+                              geometric::SPARSdb::CandidateSolution solution;
+                              if (db.findNearestStartGoal(1, start.get(), goal.get(), solution,
+                                                          base::plannerNonTerminatingCondition()))
+                              {
+                                  ++found;
+                                  BOOST_CHECK(solution.getStateCount() >= 2);
+                              }
+                              ++queries;
+                          } while (inserting);
+                      });
+    for (double y = 0.1; y < 1.0; y += 0.2)
+        db.addPathAsync(horizontalPath(si, y));
+    db.waitForPendingPaths();
+    inserting = false;
+    query.join();
+
+    BOOST_CHECK_EQUAL(db.getNumPendingPaths(), 0u);
+    BOOST_CHECK_EQUAL(db.getNumPathsInserted(), 6);
+    BOOST_CHECK(db.getEpoch() > 1u);
+    BOOST_CHECK(queries > 0u);
+    BOOST_CHECK_EQUAL(found.load(), queries.load());
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalRoadmapCopies)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    si->setStateValidityChecker([](const base::State *)
+                                {
+                                    return true;
+                                });
+    si->setup();
+    auto pdef(std::make_shared<base::ProblemDefinition>(si));
+    auto makeRoadmap = [&]
+    {
+        auto spars(std::make_shared<geometric::SPARSdb>(si));
+        spars->setProblemDefinition(pdef);
+        spars->setup();
+        return spars;
+    };
+
+    auto spars(makeRoadmap()), copy(makeRoadmap()), other(makeRoadmap());
+    geometric::PathGeometric path(horizontalPath(si, 0.5));
+    spars->addPathToRoadmap(base::plannerNonTerminatingCondition(), path);
+    BOOST_REQUIRE(copy->copyRoadmap(*spars));
+    BOOST_CHECK_EQUAL(copy->getNumVertices(), spars->getNumVertices());
+    BOOST_CHECK_EQUAL(copy->getNumEdges(), spars->getNumEdges());
+
+    // later copies only add what is new
+    const unsigned int firstCount = copy->getNumVertices();
+    for (double y = 0.1; y < 1.0; y += 0.2)
+    {
+        geometric::PathGeometric more(horizontalPath(si, y));
+        spars->addPathToRoadmap(base::plannerNonTerminatingCondition(), more);
+        BOOST_REQUIRE(copy->copyRoadmap(*spars));
+        BOOST_CHECK_EQUAL(copy->getNumVertices(), spars->getNumVertices());
+        BOOST_CHECK_EQUAL(copy->getNumEdges(), spars->getNumEdges());
+        BOOST_CHECK_EQUAL(copy->getNumConnectedComponents(), spars->getNumConnectedComponents());
+    }
+
+    BOOST_CHECK(copy->getNumVertices() > firstCount);
+
+    // a cleared roadmap is not taken for a grown one, even once it has as many guards and edges again
+    const unsigned int copiedVertices = copy->getNumVertices(), copiedEdges = copy->getNumEdges();
+    spars->clear();
+    spars->setup();
+    for (double y : {0.5, 0.1, 0.3, 0.7, 0.9, 0.2, 0.4, 0.6, 0.8})
+    {
+        geometric::PathGeometric more(horizontalPath(si, y));
+        spars->addPathToRoadmap(base::plannerNonTerminatingCondition(), more);
+    }
+    BOOST_REQUIRE(spars->getNumVertices() >= copiedVertices && spars->getNumEdges() >= copiedEdges);
+    BOOST_CHECK(!copy->copyRoadmap(*spars));
+    BOOST_CHECK_EQUAL(copy->getNumVertices(), copiedVertices);
+    auto fresh(makeRoadmap());
+    BOOST_REQUIRE(fresh->copyRoadmap(*spars));
+    BOOST_CHECK_EQUAL(fresh->getNumVertices(), spars->getNumVertices());
+    BOOST_CHECK_EQUAL(fresh->getNumEdges(), spars->getNumEdges());
+
+    // a roadmap that holds a copy of another one cannot take a copy of a third one
+    BOOST_REQUIRE(other->copyRoadmap(*copy));
+    BOOST_CHECK(!other->copyRoadmap(*spars));
+    BOOST_CHECK_EQUAL(other->getNumVertices(), copy->getNumVertices());
+}
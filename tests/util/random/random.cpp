@@ -43,6 +43,7 @@
 #include <cmath>
 #include <vector>
 #include <cstdio>
+#include <thread>
 
 // workaround for bug in boost versions < 1.61
 // see fix at https://github.com/boostorg/random/commit/29e8bd59a24ac2f6023c3706916f829b0d416297
@@ -409,3 +410,91 @@ BOOST_AUTO_TEST_CASE(SampleInPhs)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(PhiloxKnownAnswers)
+{
+    // known-answer tests of Philox4x32-10 from the Random123 distribution
+    BOOST_CHECK(Philox4x32::block({{0u, 0u, 0u, 0u}}, {{0u, 0u}}) ==
+                (Philox4x32::Block{{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}}));
+    BOOST_CHECK(Philox4x32::block({{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}},
+                                  {{0xffffffffu, 0xffffffffu}}) ==
+                (Philox4x32::Block{{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}}));
+    BOOST_CHECK(Philox4x32::block({{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+                                  {{0xa4093822u, 0x299f31d0u}}) ==
+                (Philox4x32::Block{{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}));
+
+    // skipping numbers gives the same sequence as generating them
+    Philox4x32 a(7, 3), b(7, 3);
+    for (unsigned int skip : {0u, 1u, 3u, 4u, 5u, 13u})
+    {
+        for (unsigned int i = 0; i < skip; ++i)
+            a();
+        b.discard(skip);
+        BOOST_CHECK_EQUAL(a(), b());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CounterBasedStreams)
+{
+    const std::size_t N = 1000;
+    RNG r1(5, 0), r2(5, 1), r3(6, 0), r4(5, 0);
+    BOOST_CHECK(r1.isCounterBased());
+    BOOST_CHECK_EQUAL(r2.getLocalStream(), 1u);
+    int same12 = 0, same13 = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        double v1 = r1.uniform01();
+        same12 += v1 == r2.uniform01();
+        same13 += v1 == r3.uniform01();
+        BOOST_CHECK_EQUAL(v1, r4.uniform01());
+    }
+    BOOST_CHECK_EQUAL(same12, 0);
+    BOOST_CHECK_EQUAL(same13, 0);
+
+    // the numbers of a stream do not depend on the thread or order in which instances are created
+    std::vector<double> expected(N), values(N);
+    RNG(9, 42).uniform01(expected.data(), N);
+    std::thread t([&values] { RNG(9, 42).uniform01(values.data(), N); });
+    t.join();
+    BOOST_CHECK(values == expected);
+
+    // resetting the seed restarts the stream
+    r1.setLocalSeed(5);
+    BOOST_CHECK(r1.isCounterBased());
+    r4.setLocalStream(5, 0);
+    for (std::size_t i = 0; i < N; ++i)
+        BOOST_CHECK_EQUAL(r1.gaussian01(), r4.gaussian01());
+
+    // an instance can be switched to a stream
+    RNG r5;
+    BOOST_CHECK(!r5.isCounterBased());
+    r5.setLocalStream(9, 42);
+    r5.uniform01(values.data(), N);
+    BOOST_CHECK(values == expected);
+
+    double sum = 0.0;
+    for (double v : values)
+        sum += v;
+    BOOST_OMPL_EXPECT_NEAR(sum / N, 0.5, 0.05);
+}
+
+BOOST_AUTO_TEST_CASE(BulkGeneration)
+{
+    const std::size_t N = 257;
+    for (bool counterBased : {false, true})
+    {
+        RNG r1(11), r2(11);
+        if (counterBased)
+        {
+            r1.setLocalStream(11, 2);
+            r2.setLocalStream(11, 2);
+        }
+        std::vector<double> values(N);
+        r1.uniform01(values.data(), N);
+        for (std::size_t i = 0; i < N; ++i)
+            BOOST_CHECK_EQUAL(values[i], r2.uniform01());
+        r1.gaussian01(values.data(), N);
+        for (std::size_t i = 0; i < N; ++i)
+            BOOST_CHECK_EQUAL(values[i], r2.gaussian01());
+    }
+}